@@ -23,6 +23,7 @@
 #include "cmemory.h"
 #include "bmpset.h"
 #include "uassert.h"
+#include "usimd.h"
 
 U_NAMESPACE_BEGIN
 
@@ -49,6 +50,7 @@ BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
 
     initBits();
     overrideIllegal();
+    initSpanRanges();
 }
 
 BMPSet::BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength) :
@@ -58,6 +60,10 @@ BMPSet::BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t
     uprv_memcpy(table7FF, otherBMPSet.table7FF, sizeof(table7FF));
     uprv_memcpy(bmpBlockBits, otherBMPSet.bmpBlockBits, sizeof(bmpBlockBits));
     uprv_memcpy(list4kStarts, otherBMPSet.list4kStarts, sizeof(list4kStarts));
+    uprv_memcpy(&ranges16, &otherBMPSet.ranges16, sizeof(ranges16));
+    uprv_memcpy(&rangesASCII, &otherBMPSet.rangesASCII, sizeof(rangesASCII));
+    ranges16AreContained=otherBMPSet.ranges16AreContained;
+    rangesASCIIAreContained=otherBMPSet.rangesASCIIAreContained;
 }
 
 BMPSet::~BMPSet() {
@@ -254,6 +260,79 @@ void BMPSet::overrideIllegal() {
     }
 }
 
+/*
+ * Collects the set's ranges below rangeLimit, or those of its complement,
+ * up to USIMD_MAX_RANGES of them.
+ * @return the total number of such ranges
+ */
+static int32_t getRanges(const int32_t *list, int32_t listLength, UChar32 rangeLimit,
+                         UBool complement, USimdRanges &r) {
+    int32_t count=0;
+    UChar32 prev=0;  // limit of the previous range of the set
+    for(int32_t i=0; i<(listLength-1) && list[i]<rangeLimit; i+=2) {
+        UChar32 start=list[i];
+        UChar32 limit=list[i+1]<rangeLimit ? list[i+1] : rangeLimit;
+        if(complement) {
+            UChar32 setStart=start;
+            start=prev;
+            prev=limit;
+            limit=setStart;
+            if(start>=limit) {
+                continue;
+            }
+        }
+        if(count<USIMD_MAX_RANGES) {
+            r.starts[count]=(uint16_t)start;
+            r.deltas[count]=(uint16_t)(limit-1-start);
+        }
+        ++count;
+    }
+    if(complement && prev<rangeLimit) {
+        if(count<USIMD_MAX_RANGES) {
+            r.starts[count]=(uint16_t)prev;
+            r.deltas[count]=(uint16_t)(rangeLimit-1-prev);
+        }
+        ++count;
+    }
+    return count;
+}
+
+/*
+ * Sets r to the ranges of the set or of its complement below the first
+ * of the limits for which one of them has few enough ranges for usimd.h.
+ * @return TRUE if r holds ranges of code points in the set
+ */
+UBool BMPSet::initRanges(USimdRanges &r, const UChar32 limits[], int32_t limitsLength) const {
+    r.count=-1;
+    r.limit=0;
+    for(int32_t i=0; i<limitsLength; ++i) {
+        UChar32 rangeLimit=limits[i];
+        r.limit=(uint16_t)rangeLimit;
+        if((r.count=getRanges(list, listLength, rangeLimit, FALSE, r))<=USIMD_MAX_RANGES) {
+            return TRUE;
+        }
+        if((r.count=getRanges(list, listLength, rangeLimit, TRUE, r))<=USIMD_MAX_RANGES) {
+            return FALSE;
+        }
+    }
+    r.count=-1;
+    return TRUE;
+}
+
+/*
+ * Ranges for the vectorized span loops: U+0000..U+07FF covers all of
+ * ASCII and two-byte UTF-8, U+0000..U+00FF at least Latin-1.
+ */
+void BMPSet::initSpanRanges() {
+    static const UChar32 limits16[2]={ 0x800, 0x100 };
+    static const UChar32 limitsASCII[1]={ 0x80 };
+    ranges16AreContained=initRanges(ranges16, limits16, UPRV_LENGTHOF(limits16));
+    rangesASCIIAreContained=initRanges(rangesASCII, limitsASCII, UPRV_LENGTHOF(limitsASCII));
+#if !USIMD_HAVE_RANGE_SPANS
+    ranges16.count=rangesASCII.count=-1;
+#endif
+}
+
 int32_t BMPSet::findCodePoint(UChar32 c, int32_t lo, int32_t hi) const {
     /* Examples:
                                        findCodePoint(c)
@@ -315,12 +394,38 @@ BMPSet::contains(UChar32 c) const {
     }
 }
 
+/*
+ * Vectorized spans:
+ * The inline span functions in bmpset.h first run the per-code point loops
+ * of the ...Chunk() functions only up to a chunk limit.
+ * If the span continues there, then they call one of the ...WithVectors() functions
+ * which alternate between skipping whole vectors of qualifying ASCII/Latin-1
+ * or two-byte UTF-8 characters via the usimd.h range span functions,
+ * and the per-code point loops on the following chunk of text.
+ * The vector loops leave everything else to the per-code point loops,
+ * so the results are the same as without them.
+ * Short spans end before the first chunk limit and hardly pay for this.
+ * When a vector loop skips less text than the chunk before it, the next chunk
+ * is longer, to limit the overhead on text with mixed characters.
+ */
+inline int32_t BMPSet::nextChunkLength(int32_t chunk, int32_t skipped) {
+    if(skipped>=chunk) {
+        return SPAN_MIN_CHUNK;
+    } else if(chunk<SPAN_MAX_CHUNK) {
+        return chunk*2;
+    } else {
+        return chunk;
+    }
+}
+
 /*
  * Check for sufficient length for trail unit for each surrogate pair.
  * Handle single surrogates as surrogate code points as usual in ICU.
+ * Stops at the first code point at or after chunkLimit.
  */
 const UChar *
-BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+BMPSet::spanChunk(const UChar *s, const UChar *chunkLimit, const UChar *limit,
+                  USetSpanCondition spanCondition) const {
     UChar c, c2;
 
     if(spanCondition) {
@@ -362,7 +467,7 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
                 }
                 ++s;
             }
-        } while(++s<limit);
+        } while(++s<chunkLimit);
     } else {
         // span not
         do {
@@ -402,14 +507,40 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
                 }
                 ++s;
             }
-        } while(++s<limit);
+        } while(++s<chunkLimit);
     }
     return s;
 }
 
-/* Symmetrical with span(). */
 const UChar *
-BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+BMPSet::spanWithVectors(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+    if(ranges16.count<0) {
+        return spanChunk(s, limit, limit, spanCondition);
+    }
+    UBool inRanges=(spanCondition!=USET_SPAN_NOT_CONTAINED)==ranges16AreContained;
+    int32_t chunk=SPAN_MIN_CHUNK;
+    for(;;) {
+        int32_t skipped=usimd_spanUCharsInRanges(s, (int32_t)(limit-s), &ranges16, inRanges);
+        s+=skipped;
+        if(s==limit) {
+            return s;
+        }
+        chunk=nextChunkLength(chunk, skipped);
+        const UChar *chunkLimit=(limit-s)>(chunk+SPAN_MIN_VECTOR_TEXT) ? s+chunk : limit;
+        s=spanChunk(s, chunkLimit, limit, spanCondition);
+        if(s<chunkLimit || s==limit) {
+            return s;
+        }
+    }
+}
+
+/*
+ * Symmetrical with spanChunk().
+ * Returns the start of the span, or a position at or before chunkStart.
+ */
+const UChar *
+BMPSet::spanBackChunk(const UChar *s, const UChar *chunkStart, const UChar *limit,
+                      USetSpanCondition spanCondition) const {
     UChar c, c2;
 
     if(spanCondition) {
@@ -451,8 +582,8 @@ BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondi
                 }
                 --limit;
             }
-            if(s==limit) {
-                return s;
+            if(limit<=chunkStart) {
+                return limit;
             }
         }
     } else {
@@ -494,34 +625,59 @@ BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondi
                 }
                 --limit;
             }
-            if(s==limit) {
-                return s;
+            if(limit<=chunkStart) {
+                return limit;
             }
         }
     }
     return limit+1;
 }
 
+const UChar *
+BMPSet::spanBackWithVectors(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+    if(ranges16.count<0) {
+        return spanBackChunk(s, s, limit, spanCondition);
+    }
+    UBool inRanges=(spanCondition!=USET_SPAN_NOT_CONTAINED)==ranges16AreContained;
+    int32_t chunk=SPAN_MIN_CHUNK;
+    for(;;) {
+        int32_t skipped=usimd_spanBackUCharsInRanges(s, (int32_t)(limit-s), &ranges16, inRanges);
+        limit-=skipped;
+        if(s==limit) {
+            return s;
+        }
+        chunk=nextChunkLength(chunk, skipped);
+        const UChar *chunkStart=(limit-s)>(chunk+SPAN_MIN_VECTOR_TEXT) ? limit-chunk : s;
+        limit=spanBackChunk(s, chunkStart, limit, spanCondition);
+        if(limit>chunkStart || limit==s) {
+            return limit;
+        }
+    }
+}
+
 /*
  * Precheck for sufficient trail bytes at end of string only once per span.
  * Check validity.
+ * Stops at the first character at or after s+chunkLength.
  */
 const uint8_t *
-BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+BMPSet::spanUTF8Chunk(const uint8_t *s, int32_t chunkLength, int32_t length,
+                      USetSpanCondition spanCondition) const {
     const uint8_t *limit=s+length;
+    const uint8_t *chunkLimit=s+chunkLength;
     uint8_t b=*s;
     if(U8_IS_SINGLE(b)) {
         // Initial all-ASCII span.
         if(spanCondition) {
             do {
-                if(!latin1Contains[b] || ++s==limit) {
+                if(!latin1Contains[b] || ++s==chunkLimit) {
                     return s;
                 }
                 b=*s;
             } while(U8_IS_SINGLE(b));
         } else {
             do {
-                if(latin1Contains[b] || ++s==limit) {
+                if(latin1Contains[b] || ++s==chunkLimit) {
                     return s;
                 }
                 b=*s;
@@ -535,6 +691,7 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
     }
 
     const uint8_t *limit0=limit;
+    uint8_t t1, t2, t3;
 
     /*
      * Make sure that the last 1/2/3/4-byte sequence before limit is complete
@@ -572,9 +729,10 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
         }
     }
 
-    uint8_t t1, t2, t3;
-
-    while(s<limit) {
+    if(chunkLimit>limit) {
+        chunkLimit=limit;
+    }
+    while(s<chunkLimit) {
         b=*s;
         if(U8_IS_SINGLE(b)) {
             // ASCII
@@ -582,8 +740,8 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
                 do {
                     if(!latin1Contains[b]) {
                         return s;
-                    } else if(++s==limit) {
-                        return limit0;
+                    } else if(++s==chunkLimit) {
+                        return s<limit ? s : limit0;
                     }
                     b=*s;
                 } while(U8_IS_SINGLE(b));
@@ -591,8 +749,8 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
                 do {
                     if(latin1Contains[b]) {
                         return s;
-                    } else if(++s==limit) {
-                        return limit0;
+                    } else if(++s==chunkLimit) {
+                        return s<limit ? s : limit0;
                     }
                     b=*s;
                 } while(U8_IS_SINGLE(b));
@@ -660,8 +818,49 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
             return s-1;
         }
     }
+    return s<limit ? s : limit0;
+}
 
-    return limit0;
+const uint8_t *
+BMPSet::spanUTF8WithVectors(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+    if(ranges16.count<0 && rangesASCII.count<0) {
+        return spanUTF8Chunk(s, length, length, spanCondition);
+    }
+    if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
+        spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
+    }
+    const uint8_t *limit=s+length;
+    UBool inRanges16=spanCondition==ranges16AreContained;
+    UBool inRangesASCII=spanCondition==rangesASCIIAreContained;
+    int32_t chunk=SPAN_MIN_CHUNK;
+    for(;;) {
+        // Alternate between ASCII and two-byte vectors while either makes progress.
+        int32_t skipped=0, n;
+        do {
+            n=0;
+            if(rangesASCII.count>=0) {
+                n=usimd_spanBytesInRanges(s+skipped, (int32_t)(limit-s)-skipped,
+                                          &rangesASCII, inRangesASCII);
+            }
+            if(ranges16.count>=0) {
+                n+=usimd_spanUTF8TwoBytesInRanges(s+skipped+n, (int32_t)(limit-s)-skipped-n,
+                                                  &ranges16, inRanges16);
+            }
+            skipped+=n;
+        } while(n!=0);
+        s+=skipped;
+        if(s==limit) {
+            return s;
+        }
+        chunk=nextChunkLength(chunk, skipped);
+        length=(int32_t)(limit-s);
+        int32_t chunkLength=length>(chunk+SPAN_MIN_VECTOR_TEXT) ? chunk : length;
+        const uint8_t *p=spanUTF8Chunk(s, chunkLength, length, spanCondition);
+        if(p<(s+chunkLength) || p==limit) {
+            return p;
+        }
+        s=p;
+    }
 }
 
 /*
@@ -670,9 +869,12 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
  * possible to tell from the last byte in a multi-byte sequence how many
  * preceding bytes there should be. Therefore, going backwards through UTF-8
  * is much harder than going forward.
+ *
+ * Returns the start of the span, or a length at or below chunkStart.
  */
 int32_t
-BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+BMPSet::spanBackUTF8Chunk(const uint8_t *s, int32_t chunkStart, int32_t length,
+                          USetSpanCondition spanCondition) const {
     if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
         spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
     }
@@ -687,8 +889,8 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
                 do {
                     if(!latin1Contains[b]) {
                         return length+1;
-                    } else if(length==0) {
-                        return 0;
+                    } else if(length==chunkStart) {
+                        return length;
                     }
                     b=s[--length];
                 } while(U8_IS_SINGLE(b));
@@ -696,8 +898,8 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
                 do {
                     if(latin1Contains[b]) {
                         return length+1;
-                    } else if(length==0) {
-                        return 0;
+                    } else if(length==chunkStart) {
+                        return length;
                     }
                     b=s[--length];
                 } while(U8_IS_SINGLE(b));
@@ -734,8 +936,46 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
                 return prev+1;
             }
         }
-    } while(length>0);
-    return 0;
+    } while(length>chunkStart);
+    return length;
+}
+
+int32_t
+BMPSet::spanBackUTF8WithVectors(const uint8_t *s, int32_t length,
+                                USetSpanCondition spanCondition) const {
+    if(ranges16.count<0 && rangesASCII.count<0) {
+        return spanBackUTF8Chunk(s, 0, length, spanCondition);
+    }
+    if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
+        spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
+    }
+    UBool inRanges16=spanCondition==ranges16AreContained;
+    UBool inRangesASCII=spanCondition==rangesASCIIAreContained;
+    int32_t chunk=SPAN_MIN_CHUNK;
+    for(;;) {
+        // Alternate between ASCII and two-byte vectors while either makes progress.
+        int32_t skipped=0, n;
+        do {
+            n=0;
+            if(rangesASCII.count>=0) {
+                n=usimd_spanBackBytesInRanges(s, length-skipped, &rangesASCII, inRangesASCII);
+            }
+            if(ranges16.count>=0) {
+                n+=usimd_spanBackUTF8TwoBytesInRanges(s, length-skipped-n, &ranges16, inRanges16);
+            }
+            skipped+=n;
+        } while(n!=0);
+        length-=skipped;
+        if(length==0) {
+            return 0;
+        }
+        chunk=nextChunkLength(chunk, skipped);
+        int32_t chunkStart=length>(chunk+SPAN_MIN_VECTOR_TEXT) ? length-chunk : 0;
+        length=spanBackUTF8Chunk(s, chunkStart, length, spanCondition);
+        if(length>chunkStart || length==0) {
+            return length;
+        }
+    }
 }
 
 U_NAMESPACE_END
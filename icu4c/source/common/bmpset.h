@@ -21,6 +21,7 @@
 
 #include "unicode/utypes.h"
 #include "unicode/uniset.h"
+#include "usimd.h"
 
 U_NAMESPACE_BEGIN
 
@@ -48,32 +49,67 @@ class BMPSet : public UMemory {
      * It must be s<limit and spanCondition==0 or 1.
      * @return The string pointer which limits the span.
      */
-    const UChar *span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const;
+    inline const UChar *span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const;
 
     /*
      * Span the trailing substring for which each character c has spanCondition==contains(c).
      * It must be s<limit and spanCondition==0 or 1.
      * @return The string pointer which starts the span.
      */
-    const UChar *spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const;
+    inline const UChar *spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const;
 
     /*
      * Span the initial substring for which each character c has spanCondition==contains(c).
      * It must be length>0 and spanCondition==0 or 1.
      * @return The string pointer which limits the span.
      */
-    const uint8_t *spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const;
+    inline const uint8_t *spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const;
 
     /*
      * Span the trailing substring for which each character c has spanCondition==contains(c).
      * It must be length>0 and spanCondition==0 or 1.
      * @return The start of the span.
      */
-    int32_t spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const;
+    inline int32_t spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const;
 
 private:
     void initBits();
     void overrideIllegal();
+    void initSpanRanges();
+    UBool initRanges(USimdRanges &r, const UChar32 limits[], int32_t limitsLength) const;
+
+    /*
+     * The inline span functions run these per-code point loops up to a chunk limit,
+     * and continue long spans with the ...WithVectors() functions; see bmpset.cpp.
+     * Short spans cost no more than without the vectors.
+     */
+    enum {
+        /* Number of code units to span one code point at a time before trying vectors. */
+        SPAN_MIN_CHUNK=64,
+        /* Limit for the growing chunks after vectors did not skip much. */
+        SPAN_MAX_CHUNK=1024,
+        /* Do not bother with vectors for the rest of the text when it is shorter. */
+        SPAN_MIN_VECTOR_TEXT=32
+    };
+
+    static inline int32_t nextChunkLength(int32_t chunk, int32_t skipped);
+
+    const UChar *spanChunk(const UChar *s, const UChar *chunkLimit, const UChar *limit,
+                           USetSpanCondition spanCondition) const;
+    const UChar *spanBackChunk(const UChar *s, const UChar *chunkStart, const UChar *limit,
+                               USetSpanCondition spanCondition) const;
+    const uint8_t *spanUTF8Chunk(const uint8_t *s, int32_t chunkLength, int32_t length,
+                                 USetSpanCondition spanCondition) const;
+    int32_t spanBackUTF8Chunk(const uint8_t *s, int32_t chunkStart, int32_t length,
+                              USetSpanCondition spanCondition) const;
+    const UChar *spanWithVectors(const UChar *s, const UChar *limit,
+                                 USetSpanCondition spanCondition) const;
+    const UChar *spanBackWithVectors(const UChar *s, const UChar *limit,
+                                     USetSpanCondition spanCondition) const;
+    const uint8_t *spanUTF8WithVectors(const uint8_t *s, int32_t length,
+                                       USetSpanCondition spanCondition) const;
+    int32_t spanBackUTF8WithVectors(const uint8_t *s, int32_t length,
+                                    USetSpanCondition spanCondition) const;
 
     /**
      * Same as UnicodeSet::findCodePoint(UChar32 c) const except that the
@@ -146,6 +182,20 @@ class BMPSet : public UMemory {
      */
     int32_t list4kStarts[18];
 
+    /*
+     * Ranges for the usimd.h range span functions, or count<0 if not used.
+     * ranges16 describes U+0000..U+07FF (or only Latin-1) for UTF-16 and two-byte UTF-8,
+     * rangesASCII describes ASCII for single bytes.
+     * Each holds either the ranges of the set or those of its complement,
+     * whichever fit into USIMD_MAX_RANGES.
+     */
+    USimdRanges ranges16;
+    USimdRanges rangesASCII;
+    /* TRUE if ranges16 holds ranges of code points in the set, FALSE for the complement. */
+    UBool ranges16AreContained;
+    /* TRUE if rangesASCII holds ranges of code points in the set, FALSE for the complement. */
+    UBool rangesASCIIAreContained;
+
     /*
      * The inversion list of the parent set, for the slower contains() implementation
      * for mixed BMP blocks and for supplementary code points.
@@ -159,6 +209,50 @@ inline UBool BMPSet::containsSlow(UChar32 c, int32_t lo, int32_t hi) const {
     return (UBool)(findCodePoint(c, lo, hi) & 1);
 }
 
+inline const UChar *
+BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+    const UChar *chunkLimit=
+        (limit-s)>(SPAN_MIN_CHUNK+SPAN_MIN_VECTOR_TEXT) ? s+SPAN_MIN_CHUNK : limit;
+    s=spanChunk(s, chunkLimit, limit, spanCondition);
+    if(s<chunkLimit || s==limit) {
+        return s;
+    }
+    return spanWithVectors(s, limit, spanCondition);
+}
+
+inline const UChar *
+BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+    const UChar *chunkStart=
+        (limit-s)>(SPAN_MIN_CHUNK+SPAN_MIN_VECTOR_TEXT) ? limit-SPAN_MIN_CHUNK : s;
+    limit=spanBackChunk(s, chunkStart, limit, spanCondition);
+    if(limit>chunkStart || limit==s) {
+        return limit;
+    }
+    return spanBackWithVectors(s, limit, spanCondition);
+}
+
+inline const uint8_t *
+BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+    int32_t chunkLength=
+        length>(SPAN_MIN_CHUNK+SPAN_MIN_VECTOR_TEXT) ? (int32_t)SPAN_MIN_CHUNK : length;
+    const uint8_t *p=spanUTF8Chunk(s, chunkLength, length, spanCondition);
+    if(p<(s+chunkLength) || p==(s+length)) {
+        return p;
+    }
+    return spanUTF8WithVectors(p, (int32_t)(s+length-p), spanCondition);
+}
+
+inline int32_t
+BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+    int32_t chunkStart=
+        length>(SPAN_MIN_CHUNK+SPAN_MIN_VECTOR_TEXT) ? length-SPAN_MIN_CHUNK : 0;
+    length=spanBackUTF8Chunk(s, chunkStart, length, spanCondition);
+    if(length>chunkStart || length==0) {
+        return length;
+    }
+    return spanBackUTF8WithVectors(s, length, spanCondition);
+}
+
 U_NAMESPACE_END
 
 #endif
@@ -68,12 +68,15 @@ class LanguageBreakEngine : public UMemory {
   * @param startPos The start of the run within the supplied text.
   * @param endPos The end of the run within the supplied text.
   * @param foundBreaks A Vector of int32_t to receive the breaks.
+  * @param numThreads The maximum number of threads that the engine may use
+  * for a long run. The breaks are the same as with one thread.
   * @return The number of breaks found.
   */
   virtual int32_t findBreaks( UText *text,
                               int32_t startPos,
                               int32_t endPos,
-                              UVector32 &foundBreaks ) const = 0;
+                              UVector32 &foundBreaks,
+                              int32_t numThreads ) const = 0;
 
 };
 
@@ -185,12 +188,14 @@ class UnhandledEngine : public LanguageBreakEngine {
   * @param startPos The start of the run within the supplied text.
   * @param endPos The end of the run within the supplied text.
   * @param foundBreaks An allocated C array of the breaks found, if any
+  * @param numThreads Ignored.
   * @return The number of breaks found.
   */
   virtual int32_t findBreaks( UText *text,
                               int32_t startPos,
                               int32_t endPos,
-                              UVector32 &foundBreaks ) const;
+                              UVector32 &foundBreaks,
+                              int32_t numThreads ) const;
 
  /**
   * <p>Tell the engine to handle a particular character and break type.</p>
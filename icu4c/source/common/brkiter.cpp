@@ -30,6 +30,7 @@
 #include "unicode/ures.h"
 #include "unicode/ustring.h"
 #include "unicode/filteredbrk.h"
+#include "unicode/localpointer.h"
 #include "ucln_cmn.h"
 #include "cstring.h"
 #include "umutex.h"
@@ -38,6 +39,7 @@
 #include "uresimp.h"
 #include "uassert.h"
 #include "ubrkimpl.h"
+#include "unifiedcache.h"
 #include "charstr.h"
 
 // *****************************************************************************
@@ -363,6 +365,78 @@ BreakIterator::getAvailableLocales(void)
 
 // -------------------------------------
 
+/**
+ * A break iterator that is never used for iteration, only cloned.
+ * createInstance() keeps these in the unified cache so that each new
+ * break iterator is a clone that shares the prototype's rule data,
+ * instead of another resource bundle lookup and data load.
+ */
+class BreakIteratorPrototype : public SharedObject {
+public:
+    BreakIteratorPrototype(BreakIterator *adopted) : fPrototype(adopted) {}
+    virtual ~BreakIteratorPrototype();
+    const BreakIterator *get() const { return fPrototype; }
+private:
+    BreakIterator *fPrototype;
+    BreakIteratorPrototype(const BreakIteratorPrototype &);
+    BreakIteratorPrototype &operator=(const BreakIteratorPrototype &);
+};
+
+BreakIteratorPrototype::~BreakIteratorPrototype() {
+    delete fPrototype;
+}
+
+template<>
+const BreakIteratorPrototype *LocaleCacheKey<BreakIteratorPrototype>::createObject(
+        const void * /*creationContext*/, UErrorCode &status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return NULL;
+}
+
+class BreakIteratorCacheKey : public LocaleCacheKey<BreakIteratorPrototype> {
+private:
+    int32_t fKind;
+public:
+    BreakIteratorCacheKey(const Locale &loc, int32_t kind)
+            : LocaleCacheKey<BreakIteratorPrototype>(loc), fKind(kind) {}
+    BreakIteratorCacheKey(const BreakIteratorCacheKey &other)
+            : LocaleCacheKey<BreakIteratorPrototype>(other), fKind(other.fKind) {}
+    virtual ~BreakIteratorCacheKey();
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (uint32_t)LocaleCacheKey<BreakIteratorPrototype>::hashCode() + (uint32_t)fKind);
+    }
+    virtual UBool operator==(const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!LocaleCacheKey<BreakIteratorPrototype>::operator==(other)) {
+            return FALSE;
+        }
+        // We know that this and other are of same class if we get this far.
+        return static_cast<const BreakIteratorCacheKey &>(other).fKind == fKind;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new BreakIteratorCacheKey(*this);
+    }
+    virtual const BreakIteratorPrototype *createObject(
+            const void * /*unused*/, UErrorCode &status) const {
+        LocalPointer<BreakIterator> bi(BreakIterator::makeInstance(fLoc, fKind, status));
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        BreakIteratorPrototype *result = new BreakIteratorPrototype(bi.getAlias());
+        if (result == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        bi.orphan();
+        result->addRef();
+        return result;
+    }
+};
+
+BreakIteratorCacheKey::~BreakIteratorCacheKey() {}
+
 BreakIterator*
 BreakIterator::createInstance(const Locale& loc, int32_t kind, UErrorCode& status)
 {
@@ -393,7 +467,22 @@ BreakIterator::createInstance(const Locale& loc, int32_t kind, UErrorCode& statu
     else
 #endif
     {
-        return makeInstance(loc, kind, status);
+        const UnifiedCache *cache = UnifiedCache::getInstance(status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        BreakIteratorCacheKey key(loc, kind);
+        const BreakIteratorPrototype *prototype = NULL;
+        cache->get(key, prototype, status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        BreakIterator *result = prototype->get()->clone();
+        prototype->removeRef();
+        if (result == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        return result;
     }
 }
 
@@ -15,13 +15,17 @@
 #include "dictbe.h"
 #include "unicode/uniset.h"
 #include "unicode/chariter.h"
+#include "unicode/localpointer.h"
 #include "unicode/ubrk.h"
 #include "uvectr32.h"
 #include "uvector.h"
 #include "uassert.h"
 #include "unicode/normlzr.h"
+#include "unicode/utf16.h"
 #include "cmemory.h"
 #include "dictionarydata.h"
+#include "mutex.h"
+#include "uparallel.h"
 
 U_NAMESPACE_BEGIN
 
@@ -44,7 +48,8 @@ int32_t
 DictionaryBreakEngine::findBreaks( UText *text,
                                  int32_t startPos,
                                  int32_t endPos,
-                                 UVector32 &foundBreaks ) const {
+                                 UVector32 &foundBreaks,
+                                 int32_t numThreads ) const {
     (void)startPos;            // TODO: remove this param?
     int32_t result = 0;
 
@@ -63,12 +68,144 @@ DictionaryBreakEngine::findBreaks( UText *text,
     }
     rangeStart = start;
     rangeEnd = current;
-    result = divideUpDictionaryRange(text, rangeStart, rangeEnd, foundBreaks);
+    if (numThreads > 1) {
+        result = divideUpDictionaryRangeInParallel(text, rangeStart, rangeEnd, foundBreaks, numThreads);
+    } else {
+        result = divideUpDictionaryRange(text, rangeStart, rangeEnd, foundBreaks);
+    }
     utext_setNativeIndex(text, current);
     
     return result;
 }
 
+int32_t
+DictionaryBreakEngine::divideUpDictionaryRangeFrom( UText * /* text */,
+                                                    int32_t /* start */,
+                                                    int32_t /* limit */,
+                                                    int32_t /* rangeEnd */,
+                                                    UVector32 & /* foundBreaks */ ) const {
+    return -1;
+}
+
+UBool
+DictionaryBreakEngine::supportsRangeFrom() const {
+    return FALSE;
+}
+
+namespace {
+
+// Minimum number of code units per thread for dividing up one range in parallel.
+const int32_t MIN_DICTIONARY_UNITS_PER_THREAD = 0x1000;
+
+// One part of a range that is divided up on another thread.
+struct DictionaryRangePart : public UMemory {
+    DictionaryRangePart() : start(0), limit(0), text(NULL), errorCode(U_ZERO_ERROR), breaks(errorCode) {}
+    ~DictionaryRangePart() { utext_close(text); }
+
+    int32_t start, limit;
+    UText *text;
+    UErrorCode errorCode;
+    UVector32 breaks;
+};
+
+}  // namespace
+
+int32_t
+DictionaryBreakEngine::divideUpDictionaryRangeInParallel( UText *text,
+                                                          int32_t rangeStart,
+                                                          int32_t rangeEnd,
+                                                          UVector32 &foundBreaks,
+                                                          int32_t numThreads ) const {
+    int32_t length = rangeEnd - rangeStart;
+    if (numThreads > length / MIN_DICTIONARY_UNITS_PER_THREAD) {
+        numThreads = length / MIN_DICTIONARY_UNITS_PER_THREAD;
+    }
+    LocalArray<DictionaryRangePart> parts;
+    if (numThreads > 1 && supportsRangeFrom()) {
+        parts.adoptInstead(new DictionaryRangePart[numThreads - 1]);
+    }
+    if (parts.isNull()) {
+        return divideUpDictionaryRange(text, rangeStart, rangeEnd, foundBreaks);
+    }
+
+    // Split near equal offsets, at code point boundaries.
+    // Each thread works on its own read-only clone of the text.
+    int32_t firstLimit = rangeEnd;
+    int32_t prevStart = rangeStart;
+    for (int32_t i = 0; i < numThreads - 1; ++i) {
+        DictionaryRangePart &part = parts[i];
+        utext_setNativeIndex(text, rangeStart + (int32_t)(((int64_t)length * (i + 1)) / numThreads));
+        part.start = (int32_t)utext_getNativeIndex(text);
+        if (part.start <= prevStart) {
+            part.start = prevStart;
+        }
+        part.limit = rangeEnd;
+        if (i == 0) {
+            firstLimit = part.start;
+        } else {
+            parts[i - 1].limit = part.start;
+        }
+        prevStart = part.start;
+        part.text = utext_clone(NULL, text, FALSE, TRUE, &part.errorCode);
+    }
+    int32_t startSize = foundBreaks.size();
+    parallelFor(numThreads, [&](int32_t i) {
+        if (i == 0) {
+            divideUpDictionaryRangeFrom(text, rangeStart, firstLimit, rangeEnd, foundBreaks);
+        } else {
+            DictionaryRangePart &part = parts[i - 1];
+            if (U_SUCCESS(part.errorCode) && part.start < part.limit) {
+                divideUpDictionaryRangeFrom(part.text, part.start, part.limit, rangeEnd, part.breaks);
+            }
+        }
+    });
+
+    // The breaks of this thread are the ones that divideUpDictionaryRange() finds.
+    // Continue them one break at a time until they reach one of the breaks of the next part;
+    // from there on, that part has the same breaks. Normally that happens within a few words.
+    UErrorCode status = U_ZERO_ERROR;
+    for (int32_t i = 0; i < numThreads - 1; ++i) {
+        const DictionaryRangePart &part = parts[i];
+        int32_t size = U_SUCCESS(part.errorCode) ? part.breaks.size() : 0;
+        int32_t pos = foundBreaks.size() > startSize ? foundBreaks.peeki() : rangeStart;
+        int32_t j = 0;
+        UBool joined = pos == part.start;
+        while (!joined) {
+            while (j < size && part.breaks.elementAti(j) < pos) {
+                ++j;
+            }
+            if (j == size) {
+                // Not within this part, or the part was not divided up.
+                break;
+            }
+            if (part.breaks.elementAti(j) == pos) {
+                ++j;
+                joined = TRUE;
+            } else if (divideUpDictionaryRangeFrom(text, pos, pos + 1, rangeEnd, foundBreaks) > 0) {
+                pos = foundBreaks.peeki();
+            } else {
+                break;
+            }
+        }
+        if (joined) {
+            while (j < size) {
+                foundBreaks.push(part.breaks.elementAti(j++), status);
+            }
+        }
+    }
+    // If the last part could not be used, then finish the range on this thread.
+    int32_t pos = foundBreaks.size() > startSize ? foundBreaks.peeki() : rangeStart;
+    if (pos < rangeEnd) {
+        divideUpDictionaryRangeFrom(text, pos, rangeEnd, rangeEnd, foundBreaks);
+    }
+
+    // Don't return a break for the end of the dictionary range if there is one there.
+    if (foundBreaks.size() > startSize && foundBreaks.peeki() >= rangeEnd) {
+        (void) foundBreaks.popi();
+    }
+    return foundBreaks.size() - startSize;
+}
+
 void
 DictionaryBreakEngine::setCharacters( const UnicodeSet &set ) {
     fSet = set;
@@ -227,9 +364,29 @@ ThaiBreakEngine::divideUpDictionaryRange( UText *text,
     if (utext_getNativeIndex(text) >= rangeEnd) {
         return 0;       // Not enough characters for two words
     }
-    utext_setNativeIndex(text, rangeStart);
 
+    int32_t wordsFound = divideUpDictionaryRangeFrom(text, rangeStart, rangeEnd, rangeEnd, foundBreaks);
 
+    // Don't return a break for the end of the dictionary range if there is one there.
+    if (foundBreaks.peeki() >= rangeEnd) {
+        (void) foundBreaks.popi();
+        wordsFound -= 1;
+    }
+
+    return wordsFound;
+}
+
+UBool
+ThaiBreakEngine::supportsRangeFrom() const {
+    return TRUE;
+}
+
+int32_t
+ThaiBreakEngine::divideUpDictionaryRangeFrom( UText *text,
+                                              int32_t start,
+                                              int32_t limit,
+                                              int32_t rangeEnd,
+                                              UVector32 &foundBreaks ) const {
     uint32_t wordsFound = 0;
     int32_t cpWordLength = 0;    // Word Length in Code Points.
     int32_t cuWordLength = 0;    // Word length in code units (UText native indexing)
@@ -237,9 +394,9 @@ ThaiBreakEngine::divideUpDictionaryRange( UText *text,
     UErrorCode status = U_ZERO_ERROR;
     PossibleWord words[THAI_LOOKAHEAD];
     
-    utext_setNativeIndex(text, rangeStart);
+    utext_setNativeIndex(text, start);
     
-    while (U_SUCCESS(status) && (current = (int32_t)utext_getNativeIndex(text)) < rangeEnd) {
+    while (U_SUCCESS(status) && (current = (int32_t)utext_getNativeIndex(text)) < limit) {
         cpWordLength = 0;
         cuWordLength = 0;
 
@@ -400,12 +557,6 @@ ThaiBreakEngine::divideUpDictionaryRange( UText *text,
         }
     }
 
-    // Don't return a break for the end of the dictionary range if there is one there.
-    if (foundBreaks.peeki() >= rangeEnd) {
-        (void) foundBreaks.popi();
-        wordsFound -= 1;
-    }
-
     return wordsFound;
 }
 
@@ -465,6 +616,28 @@ LaoBreakEngine::divideUpDictionaryRange( UText *text,
         return 0;       // Not enough characters for two words
     }
 
+    int32_t wordsFound = divideUpDictionaryRangeFrom(text, rangeStart, rangeEnd, rangeEnd, foundBreaks);
+
+    // Don't return a break for the end of the dictionary range if there is one there.
+    if (foundBreaks.peeki() >= rangeEnd) {
+        (void) foundBreaks.popi();
+        wordsFound -= 1;
+    }
+
+    return wordsFound;
+}
+
+UBool
+LaoBreakEngine::supportsRangeFrom() const {
+    return TRUE;
+}
+
+int32_t
+LaoBreakEngine::divideUpDictionaryRangeFrom( UText *text,
+                                             int32_t start,
+                                             int32_t limit,
+                                             int32_t rangeEnd,
+                                             UVector32 &foundBreaks ) const {
     uint32_t wordsFound = 0;
     int32_t cpWordLength = 0;
     int32_t cuWordLength = 0;
@@ -472,9 +645,9 @@ LaoBreakEngine::divideUpDictionaryRange( UText *text,
     UErrorCode status = U_ZERO_ERROR;
     PossibleWord words[LAO_LOOKAHEAD];
     
-    utext_setNativeIndex(text, rangeStart);
+    utext_setNativeIndex(text, start);
     
-    while (U_SUCCESS(status) && (current = (int32_t)utext_getNativeIndex(text)) < rangeEnd) {
+    while (U_SUCCESS(status) && (current = (int32_t)utext_getNativeIndex(text)) < limit) {
         cuWordLength = 0;
         cpWordLength = 0;
 
@@ -596,12 +769,6 @@ LaoBreakEngine::divideUpDictionaryRange( UText *text,
         }
     }
 
-    // Don't return a break for the end of the dictionary range if there is one there.
-    if (foundBreaks.peeki() >= rangeEnd) {
-        (void) foundBreaks.popi();
-        wordsFound -= 1;
-    }
-
     return wordsFound;
 }
 
@@ -658,6 +825,28 @@ BurmeseBreakEngine::divideUpDictionaryRange( UText *text,
         return 0;       // Not enough characters for two words
     }
 
+    int32_t wordsFound = divideUpDictionaryRangeFrom(text, rangeStart, rangeEnd, rangeEnd, foundBreaks);
+
+    // Don't return a break for the end of the dictionary range if there is one there.
+    if (foundBreaks.peeki() >= rangeEnd) {
+        (void) foundBreaks.popi();
+        wordsFound -= 1;
+    }
+
+    return wordsFound;
+}
+
+UBool
+BurmeseBreakEngine::supportsRangeFrom() const {
+    return TRUE;
+}
+
+int32_t
+BurmeseBreakEngine::divideUpDictionaryRangeFrom( UText *text,
+                                                 int32_t start,
+                                                 int32_t limit,
+                                                 int32_t rangeEnd,
+                                                 UVector32 &foundBreaks ) const {
     uint32_t wordsFound = 0;
     int32_t cpWordLength = 0;
     int32_t cuWordLength = 0;
@@ -665,9 +854,9 @@ BurmeseBreakEngine::divideUpDictionaryRange( UText *text,
     UErrorCode status = U_ZERO_ERROR;
     PossibleWord words[BURMESE_LOOKAHEAD];
     
-    utext_setNativeIndex(text, rangeStart);
+    utext_setNativeIndex(text, start);
     
-    while (U_SUCCESS(status) && (current = (int32_t)utext_getNativeIndex(text)) < rangeEnd) {
+    while (U_SUCCESS(status) && (current = (int32_t)utext_getNativeIndex(text)) < limit) {
         cuWordLength = 0;
         cpWordLength = 0;
 
@@ -789,12 +978,6 @@ BurmeseBreakEngine::divideUpDictionaryRange( UText *text,
         }
     }
 
-    // Don't return a break for the end of the dictionary range if there is one there.
-    if (foundBreaks.peeki() >= rangeEnd) {
-        (void) foundBreaks.popi();
-        wordsFound -= 1;
-    }
-
     return wordsFound;
 }
 
@@ -863,6 +1046,28 @@ KhmerBreakEngine::divideUpDictionaryRange( UText *text,
         return 0;       // Not enough characters for two words
     }
 
+    int32_t wordsFound = divideUpDictionaryRangeFrom(text, rangeStart, rangeEnd, rangeEnd, foundBreaks);
+
+    // Don't return a break for the end of the dictionary range if there is one there.
+    if (foundBreaks.peeki() >= rangeEnd) {
+        (void) foundBreaks.popi();
+        wordsFound -= 1;
+    }
+
+    return wordsFound;
+}
+
+UBool
+KhmerBreakEngine::supportsRangeFrom() const {
+    return TRUE;
+}
+
+int32_t
+KhmerBreakEngine::divideUpDictionaryRangeFrom( UText *text,
+                                               int32_t start,
+                                               int32_t limit,
+                                               int32_t rangeEnd,
+                                               UVector32 &foundBreaks ) const {
     uint32_t wordsFound = 0;
     int32_t cpWordLength = 0;
     int32_t cuWordLength = 0;
@@ -870,9 +1075,9 @@ KhmerBreakEngine::divideUpDictionaryRange( UText *text,
     UErrorCode status = U_ZERO_ERROR;
     PossibleWord words[KHMER_LOOKAHEAD];
 
-    utext_setNativeIndex(text, rangeStart);
+    utext_setNativeIndex(text, start);
 
-    while (U_SUCCESS(status) && (current = (int32_t)utext_getNativeIndex(text)) < rangeEnd) {
+    while (U_SUCCESS(status) && (current = (int32_t)utext_getNativeIndex(text)) < limit) {
         cuWordLength = 0;
         cpWordLength = 0;
 
@@ -1025,12 +1230,6 @@ KhmerBreakEngine::divideUpDictionaryRange( UText *text,
             foundBreaks.push((current+cuWordLength), status);
         }
     }
-    
-    // Don't return a break for the end of the dictionary range if there is one there.
-    if (foundBreaks.peeki() >= rangeEnd) {
-        (void) foundBreaks.popi();
-        wordsFound -= 1;
-    }
 
     return wordsFound;
 }
@@ -1042,7 +1241,7 @@ KhmerBreakEngine::divideUpDictionaryRange( UText *text,
  */
 static const uint32_t kuint32max = 0xFFFFFFFF;
 CjkBreakEngine::CjkBreakEngine(DictionaryMatcher *adoptDictionary, LanguageType type, UErrorCode &status)
-: DictionaryBreakEngine(), fDictionary(adoptDictionary) {
+: DictionaryBreakEngine(), fDictionary(adoptDictionary), fBuffers(NULL) {
     // Korean dictionary only includes Hangul syllables
     fHangulWordSet.applyPattern(UNICODE_STRING_SIMPLE("[\\uac00-\\ud7a3]"), status);
     fHanWordSet.applyPattern(UNICODE_STRING_SIMPLE("[:Han:]"), status);
@@ -1066,10 +1265,33 @@ CjkBreakEngine::CjkBreakEngine(DictionaryMatcher *adoptDictionary, LanguageType
     }
 }
 
+class CjkBreakEngine::Buffers : public UMemory {
+public:
+    Buffers(UErrorCode &status) :
+            inputMap(status), normalizedMap(status),
+            bestSnlp(status), prev(status), t_boundary(status) {}
+
+    UnicodeString inString;
+    UnicodeString normalizedInput;
+    UnicodeString fragment;
+    UnicodeString normalizedFragment;
+    UVector32 inputMap;
+    UVector32 normalizedMap;
+    UVector32 bestSnlp;
+    UVector32 prev;
+    UVector32 t_boundary;
+};
+
 CjkBreakEngine::~CjkBreakEngine(){
     delete fDictionary;
+    delete fBuffers;
 }
 
+static UMutex gCjkBuffersMutex = U_MUTEX_INITIALIZER;
+
+// Buffers used for a range longer than this are freed rather than kept.
+static const int32_t kMaxPooledRangeLength = 0x4000;
+
 // The katakanaCost values below are based on the length frequencies of all
 // katakana phrases in the dictionary
 static const int32_t kMaxKatakanaLength = 8;
@@ -1089,6 +1311,20 @@ static inline bool isKatakana(UChar32 value) {
 }
 
 
+// Sets the vector to the given size with every element set to value,
+// reusing its capacity, and returns its array.
+static int32_t *resetVector(UVector32 &v, int32_t size, int32_t value, UErrorCode &status) {
+    if (!v.ensureCapacity(size, status)) {
+        return NULL;
+    }
+    v.setSize(size);
+    int32_t *p = v.getBuffer();
+    for (int32_t i = 0; i < size; ++i) {
+        p[i] = (int32_t)value;
+    }
+    return p;
+}
+
 // Function for accessing internal utext flags.
 //   Replicates an internal UText function.
 
@@ -1113,15 +1349,57 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         return 0;
     }
 
+    UErrorCode     status      = U_ZERO_ERROR;
+
+    // Take the engine's work buffers, or make a set for this call
+    // if another thread is using them.
+    Buffers *buffers;
+    {
+        Mutex m(&gCjkBuffersMutex);
+        buffers = fBuffers;
+        fBuffers = NULL;
+    }
+    if (buffers == NULL) {
+        buffers = new Buffers(status);
+        if (buffers == NULL) {
+            return 0;
+        }
+        if (U_FAILURE(status)) {
+            delete buffers;
+            return 0;
+        }
+    }
+
+    int32_t numBreaks = divideUpDictionaryRange(inText, rangeStart, rangeEnd, foundBreaks,
+                                                *buffers, status);
+
+    // Keep the buffers for the next call, unless they grew unusually large.
+    if (rangeEnd - rangeStart <= kMaxPooledRangeLength) {
+        Mutex m(&gCjkBuffersMutex);
+        if (fBuffers == NULL) {
+            fBuffers = buffers;
+            buffers = NULL;
+        }
+    }
+    delete buffers;
+    return numBreaks;
+}
+
+int32_t 
+CjkBreakEngine::divideUpDictionaryRange( UText *inText,
+        int32_t rangeStart,
+        int32_t rangeEnd,
+        UVector32 &foundBreaks,
+        Buffers &buffers,
+        UErrorCode &status ) const {
     // UnicodeString version of input UText, NFKC normalized if necessary.
-    UnicodeString inString;
+    // Points to aliasString, buffers.inString or buffers.normalizedInput.
+    UnicodeString aliasString;
+    const UnicodeString *inString;
 
     // inputMap[inStringIndex] = corresponding native index from UText inText.
     // If NULL then mapping is 1:1
-    LocalPointer<UVector32>     inputMap;
-
-    UErrorCode     status      = U_ZERO_ERROR;
-
+    UVector32 *inputMap = NULL;
 
     // if UText has the input string as one contiguous UTF-16 chunk
     if ((inText->providerProperties & utext_i32_flag(UTEXT_PROVIDER_STABLE_CHUNKS)) &&
@@ -1131,9 +1409,10 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
         // Input UText is in one contiguous UTF-16 chunk.
         // Use Read-only aliasing UnicodeString.
-        inString.setTo(FALSE,
-                       inText->chunkContents + rangeStart - inText->chunkNativeStart,
-                       rangeEnd - rangeStart);
+        aliasString.setTo(FALSE,
+                          inText->chunkContents + rangeStart - inText->chunkNativeStart,
+                          rangeEnd - rangeStart);
+        inString = &aliasString;
     } else {
         // Copy the text from the original inText (UText) to inString (UnicodeString).
         // Create a map from UnicodeString indices -> UText offsets.
@@ -1143,44 +1422,47 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         if (limit > utext_nativeLength(inText)) {
             limit = (int32_t)utext_nativeLength(inText);
         }
-        inputMap.adoptInsteadAndCheckErrorCode(new UVector32(status), status);
-        if (U_FAILURE(status)) {
-            return 0;
-        }
+        UnicodeString &copy = buffers.inString;
+        copy.remove();
+        inputMap = &buffers.inputMap;
+        inputMap->removeAllElements();
         while (utext_getNativeIndex(inText) < limit) {
             int32_t nativePosition = (int32_t)utext_getNativeIndex(inText);
             UChar32 c = utext_next32(inText);
             U_ASSERT(c != U_SENTINEL);
-            inString.append(c);
-            while (inputMap->size() < inString.length()) {
+            copy.append(c);
+            while (inputMap->size() < copy.length()) {
                 inputMap->addElement(nativePosition, status);
             }
         }
         inputMap->addElement(limit, status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        inString = &copy;
     }
 
 
-    if (!nfkcNorm2->isNormalized(inString, status)) {
-        UnicodeString normalizedInput;
+    if (!nfkcNorm2->isNormalized(*inString, status)) {
+        UnicodeString &normalizedInput = buffers.normalizedInput;
+        normalizedInput.remove();
         //  normalizedMap[normalizedInput position] ==  original UText position.
-        LocalPointer<UVector32> normalizedMap(new UVector32(status), status);
-        if (U_FAILURE(status)) {
-            return 0;
-        }
+        UVector32 *normalizedMap = &buffers.normalizedMap;
+        normalizedMap->removeAllElements();
         
-        UnicodeString fragment;
-        UnicodeString normalizedFragment;
-        for (int32_t srcI = 0; srcI < inString.length();) {  // Once per normalization chunk
+        UnicodeString &fragment = buffers.fragment;
+        UnicodeString &normalizedFragment = buffers.normalizedFragment;
+        for (int32_t srcI = 0; srcI < inString->length();) {  // Once per normalization chunk
             fragment.remove();
             int32_t fragmentStartI = srcI;
-            UChar32 c = inString.char32At(srcI);
+            UChar32 c = inString->char32At(srcI);
             for (;;) {
                 fragment.append(c);
-                srcI = inString.moveIndex32(srcI, 1);
-                if (srcI == inString.length()) {
+                srcI = inString->moveIndex32(srcI, 1);
+                if (srcI == inString->length()) {
                     break;
                 }
-                c = inString.char32At(srcI);
+                c = inString->char32At(srcI);
                 if (nfkcNorm2->hasBoundaryBefore(c)) {
                     break;
                 }
@@ -1190,7 +1472,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
             // Map every position in the normalized chunk to the start of the chunk
             //   in the original input.
-            int32_t fragmentOriginalStart = inputMap.isValid() ?
+            int32_t fragmentOriginalStart = inputMap != NULL ?
                     inputMap->elementAti(fragmentStartI) : fragmentStartI+rangeStart;
             while (normalizedMap->size() < normalizedInput.length()) {
                 normalizedMap->addElement(fragmentOriginalStart, status);
@@ -1200,30 +1482,31 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
             }
         }
         U_ASSERT(normalizedMap->size() == normalizedInput.length());
-        int32_t nativeEnd = inputMap.isValid() ?
-                inputMap->elementAti(inString.length()) : inString.length()+rangeStart;
+        int32_t nativeEnd = inputMap != NULL ?
+                inputMap->elementAti(inString->length()) : inString->length()+rangeStart;
         normalizedMap->addElement(nativeEnd, status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
 
-        inputMap.moveFrom(normalizedMap);
-        inString.moveFrom(normalizedInput);
+        inputMap = normalizedMap;
+        inString = &normalizedInput;
     }
 
-    int32_t numCodePts = inString.countChar32();
-    if (numCodePts != inString.length()) {
+    int32_t numCodePts = inString->countChar32();
+    if (numCodePts != inString->length()) {
         // There are supplementary characters in the input.
         // The dictionary will produce boundary positions in terms of code point indexes,
         //   not in terms of code unit string indexes.
         // Use the inputMap mechanism to take care of this in addition to indexing differences
         //    from normalization and/or UTF-8 input.
-        UBool hadExistingMap = inputMap.isValid();
+        UBool hadExistingMap = inputMap != NULL;
         if (!hadExistingMap) {
-            inputMap.adoptInsteadAndCheckErrorCode(new UVector32(status), status);
-            if (U_FAILURE(status)) {
-                return 0;
-            }
+            inputMap = &buffers.inputMap;
+            inputMap->removeAllElements();
         }
         int32_t cpIdx = 0;
-        for (int32_t cuIdx = 0; ; cuIdx = inString.moveIndex32(cuIdx, 1)) {
+        for (int32_t cuIdx = 0; ; cuIdx = inString->moveIndex32(cuIdx, 1)) {
             U_ASSERT(cuIdx >= cpIdx);
             if (hadExistingMap) {
                 inputMap->setElementAt(inputMap->elementAti(cuIdx), cpIdx);
@@ -1231,36 +1514,35 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
                 inputMap->addElement(cuIdx+rangeStart, status);
             }
             cpIdx++;
-            if (cuIdx == inString.length()) {
+            if (cuIdx == inString->length()) {
                break;
             }
         }
+        if (U_FAILURE(status)) {
+            return 0;
+        }
     }
                 
     // bestSnlp[i] is the snlp of the best segmentation of the first i
     // code points in the range to be matched.
-    UVector32 bestSnlp(numCodePts + 1, status);
-    bestSnlp.addElement(0, status);
-    for(int32_t i = 1; i <= numCodePts; i++) {
-        bestSnlp.addElement(kuint32max, status);
-    }
-
+    uint32_t *bestSnlp = (uint32_t *)resetVector(buffers.bestSnlp, numCodePts + 1, kuint32max, status);
 
     // prev[i] is the index of the last CJK code point in the previous word in 
     // the best segmentation of the first i characters.
-    UVector32 prev(numCodePts + 1, status);
-    for(int32_t i = 0; i <= numCodePts; i++){
-        prev.addElement(-1, status);
+    int32_t *prev = resetVector(buffers.prev, numCodePts + 1, -1, status);
+    if (U_FAILURE(status)) {
+        return 0;
     }
+    bestSnlp[0] = 0;
 
+    // All of the words that start at one position are found with one lookup,
+    // which stops after maxWordSize code units, so it finds at most that many.
     const int32_t maxWordSize = 20;
-    UVector32 values(numCodePts, status);
-    values.setSize(numCodePts);
-    UVector32 lengths(numCodePts, status);
-    lengths.setSize(numCodePts);
+    int32_t values[maxWordSize + 1];
+    int32_t lengths[maxWordSize + 1];
 
-    UText fu = UTEXT_INITIALIZER;
-    utext_openUnicodeString(&fu, &inString, &status);
+    const UChar *text = inString->getBuffer();
+    int32_t textLength = inString->length();
 
     // Dynamic programming to find the best segmentation.
 
@@ -1269,35 +1551,36 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     //    They differ when the string contains supplementary characters.
     int32_t ix = 0;
     bool is_prev_katakana = false;
-    for (int32_t i = 0;  i < numCodePts;  ++i, ix = inString.moveIndex32(ix, 1)) {
-        if ((uint32_t)bestSnlp.elementAti(i) == kuint32max) {
+    for (int32_t i = 0;  i < numCodePts;  ++i, ix = inString->moveIndex32(ix, 1)) {
+        if (bestSnlp[i] == kuint32max) {
             continue;
         }
 
-        int32_t count;
-        utext_setNativeIndex(&fu, ix);
-        count = fDictionary->matches(&fu, maxWordSize, numCodePts,
-                             NULL, lengths.getBuffer(), values.getBuffer(), NULL);
+        int32_t count = fDictionary->matches(text + ix, textLength - ix, maxWordSize, maxWordSize,
+                                             NULL, lengths, values, NULL);
                              // Note: lengths is filled with code point lengths
                              //       The NULL parameter is the ignored code unit lengths.
 
+        UChar32 c;
+        U16_GET(text, 0, ix, textLength, c);
+
         // if there are no single character matches found in the dictionary 
         // starting with this character, treat character as a 1-character word 
         // with the highest value possible, i.e. the least likely to occur.
         // Exclude Korean characters from this treatment, as they should be left
         // together by default.
-        if ((count == 0 || lengths.elementAti(0) != 1) &&
-                !fHangulWordSet.contains(inString.char32At(ix))) {
-            values.setElementAt(maxSnlp, count);   // 255
-            lengths.setElementAt(1, count++);
+        if ((count == 0 || lengths[0] != 1) &&
+                !fHangulWordSet.contains(c)) {
+            values[count] = maxSnlp;   // 255
+            lengths[count++] = 1;
         }
 
         for (int32_t j = 0; j < count; j++) {
-            uint32_t newSnlp = (uint32_t)bestSnlp.elementAti(i) + (uint32_t)values.elementAti(j);
-            int32_t ln_j_i = lengths.elementAti(j) + i;
-            if (newSnlp < (uint32_t)bestSnlp.elementAti(ln_j_i)) {
-                bestSnlp.setElementAt(newSnlp, ln_j_i);
-                prev.setElementAt(i, ln_j_i);
+            uint32_t newSnlp = bestSnlp[i] + (uint32_t)values[j];
+            int32_t ln_j_i = lengths[j] + i;
+            if (newSnlp < bestSnlp[ln_j_i]) {
+                bestSnlp[ln_j_i] = newSnlp;
+                prev[ln_j_i] = i;
             }
         }
 
@@ -1307,45 +1590,45 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         // characters is considered a candidate word with a default cost
         // specified in the katakanaCost table according to its length.
 
-        bool is_katakana = isKatakana(inString.char32At(ix));
+        bool is_katakana = isKatakana(c);
         int32_t katakanaRunLength = 1;
         if (!is_prev_katakana && is_katakana) {
-            int32_t j = inString.moveIndex32(ix, 1);
+            int32_t j = inString->moveIndex32(ix, 1);
             // Find the end of the continuous run of Katakana characters
-            while (j < inString.length() && katakanaRunLength < kMaxKatakanaGroupLength &&
-                    isKatakana(inString.char32At(j))) {
-                j = inString.moveIndex32(j, 1);
+            while (j < textLength && katakanaRunLength < kMaxKatakanaGroupLength &&
+                    isKatakana(inString->char32At(j))) {
+                j = inString->moveIndex32(j, 1);
                 katakanaRunLength++;
             }
             if (katakanaRunLength < kMaxKatakanaGroupLength) {
-                uint32_t newSnlp = bestSnlp.elementAti(i) + getKatakanaCost(katakanaRunLength);
-                if (newSnlp < (uint32_t)bestSnlp.elementAti(i+katakanaRunLength)) {
-                    bestSnlp.setElementAt(newSnlp, i+katakanaRunLength);
-                    prev.setElementAt(i, i+katakanaRunLength);  // prev[j] = i;
+                uint32_t newSnlp = bestSnlp[i] + getKatakanaCost(katakanaRunLength);
+                if (newSnlp < bestSnlp[i+katakanaRunLength]) {
+                    bestSnlp[i+katakanaRunLength] = newSnlp;
+                    prev[i+katakanaRunLength] = i;  // prev[j] = i;
                 }
             }
         }
         is_prev_katakana = is_katakana;
     }
-    utext_close(&fu);
 
     // Start pushing the optimal offset index into t_boundary (t for tentative).
     // prev[numCodePts] is guaranteed to be meaningful.
     // We'll first push in the reverse order, i.e.,
     // t_boundary[0] = numCodePts, and afterwards do a swap.
-    UVector32 t_boundary(numCodePts+1, status);
+    UVector32 &t_boundary = buffers.t_boundary;
+    t_boundary.removeAllElements();
 
     int32_t numBreaks = 0;
     // No segmentation found, set boundary to end of range
-    if ((uint32_t)bestSnlp.elementAti(numCodePts) == kuint32max) {
+    if (bestSnlp[numCodePts] == kuint32max) {
         t_boundary.addElement(numCodePts, status);
         numBreaks++;
     } else {
-        for (int32_t i = numCodePts; i > 0; i = prev.elementAti(i)) {
+        for (int32_t i = numCodePts; i > 0; i = prev[i]) {
             t_boundary.addElement(i, status);
             numBreaks++;
         }
-        U_ASSERT(prev.elementAti(t_boundary.elementAti(numBreaks - 1)) == 0);
+        U_ASSERT(prev[t_boundary.elementAti(numBreaks - 1)] == 0);
     }
 
     // Add a break for the start of the dictionary range if there is not one
@@ -1354,6 +1637,9 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         t_boundary.addElement(0, status);
         numBreaks++;
     }
+    if (U_FAILURE(status)) {
+        return 0;
+    }
 
     // Now that we're done, convert positions in t_boundary[] (indices in 
     // the normalized input string) back to indices in the original input UText
@@ -1363,7 +1649,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     for (int32_t i = numBreaks-1; i >= 0; i--) {
         int32_t cpPos = t_boundary.elementAti(i);
         U_ASSERT(cpPos > prevCPPos);
-        int32_t utextPos =  inputMap.isValid() ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
+        int32_t utextPos =  inputMap != NULL ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
         U_ASSERT(utextPos >= prevUTextPos);
         if (utextPos > prevUTextPos) {
             // Boundaries are added to foundBreaks output in ascending order.
@@ -1380,8 +1666,6 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     }
     (void)prevCPPos; // suppress compiler warnings about unused variable
 
-    // inString goes out of scope
-    // inputMap goes out of scope
     return numBreaks;
 }
 #endif
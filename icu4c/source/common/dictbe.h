@@ -73,12 +73,15 @@ class DictionaryBreakEngine : public LanguageBreakEngine {
    * @param startPos The start of the run within the supplied text.
    * @param endPos The end of the run within the supplied text.
    * @param foundBreaks vector of int32_t to receive the break positions
+   * @param numThreads The maximum number of threads that may be used
+   * to divide up a long run, see divideUpDictionaryRangeFrom().
    * @return The number of breaks found.
    */
   virtual int32_t findBreaks( UText *text,
                               int32_t startPos,
                               int32_t endPos,
-                              UVector32 &foundBreaks ) const;
+                              UVector32 &foundBreaks,
+                              int32_t numThreads ) const;
 
  protected:
 
@@ -103,6 +106,52 @@ class DictionaryBreakEngine : public LanguageBreakEngine {
                                            int32_t rangeEnd,
                                            UVector32 &foundBreaks ) const = 0;
 
+ /**
+  * <p>Continue dividing up a range of dictionary characters from a word boundary.</p>
+  *
+  * <p>An engine implements this if the boundary it finds after a position
+  * depends only on the text from that position to the end of the range.
+  * divideUpDictionaryRange() then checks for a minimum range length,
+  * calls this function with start=rangeStart and limit=rangeEnd,
+  * and removes a break at rangeEnd.
+  * Starting at any other position eventually finds the same boundaries
+  * as starting at rangeStart, once the two sequences have one boundary in common.
+  * findBreaks() uses that to divide up the parts of a long range on several threads.</p>
+  *
+  * @param text A UText representing the text
+  * @param start The position from which to find breaks
+  * @param limit Stop after the first break at or after this position
+  * @param rangeEnd The end of the range of dictionary characters;
+  * words may extend past limit up to here
+  * @param foundBreaks vector of int32_t to receive the break positions
+  * @return The number of breaks found, or -1 if the engine only divides up
+  * whole ranges (the default)
+  */
+  virtual int32_t divideUpDictionaryRangeFrom( UText *text,
+                                               int32_t start,
+                                               int32_t limit,
+                                               int32_t rangeEnd,
+                                               UVector32 &foundBreaks ) const;
+
+ /**
+  * <p>Indicate whether this engine implements divideUpDictionaryRangeFrom().</p>
+  *
+  * @return TRUE if long ranges may be divided up on several threads;
+  * FALSE (the default) if the engine only divides up whole ranges
+  */
+  virtual UBool supportsRangeFrom() const;
+
+ private:
+ /**
+  * <p>Divide up a long range with up to numThreads threads, with the same
+  * result as divideUpDictionaryRange().</p>
+  */
+  int32_t divideUpDictionaryRangeInParallel( UText *text,
+                                             int32_t rangeStart,
+                                             int32_t rangeEnd,
+                                             UVector32 &foundBreaks,
+                                             int32_t numThreads ) const;
+
 };
 
 /*******************************************************************
@@ -160,6 +209,14 @@ class ThaiBreakEngine : public DictionaryBreakEngine {
                                            int32_t rangeEnd,
                                            UVector32 &foundBreaks ) const;
 
+  virtual int32_t divideUpDictionaryRangeFrom( UText *text,
+                                               int32_t start,
+                                               int32_t limit,
+                                               int32_t rangeEnd,
+                                               UVector32 &foundBreaks ) const;
+
+  virtual UBool supportsRangeFrom() const;
+
 };
 
 /*******************************************************************
@@ -216,6 +273,14 @@ class LaoBreakEngine : public DictionaryBreakEngine {
                                            int32_t rangeEnd,
                                            UVector32 &foundBreaks ) const;
 
+  virtual int32_t divideUpDictionaryRangeFrom( UText *text,
+                                               int32_t start,
+                                               int32_t limit,
+                                               int32_t rangeEnd,
+                                               UVector32 &foundBreaks ) const;
+
+  virtual UBool supportsRangeFrom() const;
+
 };
 
 /******************************************************************* 
@@ -272,6 +337,14 @@ class BurmeseBreakEngine : public DictionaryBreakEngine {
                                            int32_t rangeEnd, 
                                            UVector32 &foundBreaks ) const; 
  
+  virtual int32_t divideUpDictionaryRangeFrom( UText *text, 
+                                               int32_t start, 
+                                               int32_t limit, 
+                                               int32_t rangeEnd, 
+                                               UVector32 &foundBreaks ) const; 
+ 
+  virtual UBool supportsRangeFrom() const; 
+ 
 }; 
  
 /******************************************************************* 
@@ -328,6 +401,14 @@ class KhmerBreakEngine : public DictionaryBreakEngine {
                                            int32_t rangeEnd, 
                                            UVector32 &foundBreaks ) const; 
  
+  virtual int32_t divideUpDictionaryRangeFrom( UText *text, 
+                                               int32_t start, 
+                                               int32_t limit, 
+                                               int32_t rangeEnd, 
+                                               UVector32 &foundBreaks ) const; 
+ 
+  virtual UBool supportsRangeFrom() const; 
+ 
 }; 
  
 #if !UCONFIG_NO_NORMALIZATION
@@ -392,6 +473,24 @@ class CjkBreakEngine : public DictionaryBreakEngine {
           int32_t rangeEnd,
           UVector32 &foundBreaks ) const;
 
+ private:
+  class Buffers;
+
+    /**
+     * Work buffers for divideUpDictionaryRange(), kept between calls so that
+     * segmenting many short runs does not allocate them every time.
+     * Guarded by a mutex; a concurrent call that finds them in use
+     * makes its own.
+     */
+  mutable Buffers          *fBuffers;
+
+  int32_t divideUpDictionaryRange( UText *text,
+          int32_t rangeStart,
+          int32_t rangeEnd,
+          UVector32 &foundBreaks,
+          Buffers &buffers,
+          UErrorCode &status ) const;
+
 };
 
 #endif
@@ -15,6 +15,7 @@
 #include "unicode/ucharstrie.h"
 #include "unicode/bytestrie.h"
 #include "unicode/udata.h"
+#include "unicode/utf16.h"
 #include "cmemory.h"
 
 #if !UCONFIG_NO_BREAK_ITERATION
@@ -86,6 +87,50 @@ int32_t UCharsDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t
     return wordCount;
 }
 
+int32_t UCharsDictionaryMatcher::matches(const UChar *text, int32_t textLength, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const {
+    UCharsTrie uct(characters);
+    int32_t wordCount = 0;
+    int32_t codePointsMatched = 0;
+
+    for (int32_t i = 0; i < textLength;) {
+        UChar32 c;
+        U16_NEXT(text, i, textLength, c);
+        UStringTrieResult result = (codePointsMatched == 0) ? uct.first(c) : uct.next(c);
+        int32_t lengthMatched = i;
+        codePointsMatched += 1;
+        if (USTRINGTRIE_HAS_VALUE(result)) {
+            if (wordCount < limit) {
+                if (values != NULL) {
+                    values[wordCount] = uct.getValue();
+                }
+                if (lengths != NULL) {
+                    lengths[wordCount] = lengthMatched;
+                }
+                if (cpLengths != NULL) {
+                    cpLengths[wordCount] = codePointsMatched;
+                }
+                ++wordCount;
+            }
+            if (result == USTRINGTRIE_FINAL_VALUE) {
+                break;
+            }
+        }
+        else if (result == USTRINGTRIE_NO_MATCH) {
+            break;
+        }
+        if (lengthMatched >= maxLength) {
+            break;
+        }
+    }
+
+    if (prefix != NULL) {
+        *prefix = codePointsMatched;
+    }
+    return wordCount;
+}
+
 BytesDictionaryMatcher::~BytesDictionaryMatcher() {
     udata_close(file);
 }
@@ -153,6 +198,50 @@ int32_t BytesDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t
     return wordCount;
 }
 
+int32_t BytesDictionaryMatcher::matches(const UChar *text, int32_t textLength, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const {
+    BytesTrie bt(characters);
+    int32_t wordCount = 0;
+    int32_t codePointsMatched = 0;
+
+    for (int32_t i = 0; i < textLength;) {
+        UChar32 c;
+        U16_NEXT(text, i, textLength, c);
+        UStringTrieResult result = (codePointsMatched == 0) ? bt.first(transform(c)) : bt.next(transform(c));
+        int32_t lengthMatched = i;
+        codePointsMatched += 1;
+        if (USTRINGTRIE_HAS_VALUE(result)) {
+            if (wordCount < limit) {
+                if (values != NULL) {
+                    values[wordCount] = bt.getValue();
+                }
+                if (lengths != NULL) {
+                    lengths[wordCount] = lengthMatched;
+                }
+                if (cpLengths != NULL) {
+                    cpLengths[wordCount] = codePointsMatched;
+                }
+                ++wordCount;
+            }
+            if (result == USTRINGTRIE_FINAL_VALUE) {
+                break;
+            }
+        }
+        else if (result == USTRINGTRIE_NO_MATCH) {
+            break;
+        }
+        if (lengthMatched >= maxLength) {
+            break;
+        }
+    }
+
+    if (prefix != NULL) {
+        *prefix = codePointsMatched;
+    }
+    return wordCount;
+}
+
 
 U_NAMESPACE_END
 
@@ -94,6 +94,18 @@ class U_COMMON_API DictionaryMatcher : public UMemory {
                             int32_t *lengths, int32_t *cpLengths, int32_t *values,
                             int32_t *prefix) const = 0;
 
+    /*  Same as the UText version, but for a UTF-16 string.
+     *  Matching begins at text[0]. maxLength and the output lengths
+     *  are in UTF-16 code units.
+     *  Reads the string directly, which is faster than going through a UText
+     *  for callers that look up words at many positions of one buffer.
+     *  @param text       The UTF-16 text in which to look for matching words.
+     *  @param textLength The length of text. Matching stops there.
+     */
+    virtual int32_t matches(const UChar *text, int32_t textLength, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const = 0;
+
     /** @return DictionaryData::TRIE_TYPE_XYZ */
     virtual int32_t getType() const = 0;
 };
@@ -108,6 +120,9 @@ class U_COMMON_API UCharsDictionaryMatcher : public DictionaryMatcher {
     virtual int32_t matches(UText *text, int32_t maxLength, int32_t limit,
                             int32_t *lengths, int32_t *cpLengths, int32_t *values,
                             int32_t *prefix) const;
+    virtual int32_t matches(const UChar *text, int32_t textLength, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const;
     virtual int32_t getType() const;
 private:
     const UChar *characters;
@@ -126,6 +141,9 @@ class U_COMMON_API BytesDictionaryMatcher : public DictionaryMatcher {
     virtual int32_t matches(UText *text, int32_t maxLength, int32_t limit,
                             int32_t *lengths, int32_t *cpLengths, int32_t *values,
                             int32_t *prefix) const;
+    virtual int32_t matches(const UChar *text, int32_t textLength, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const;
     virtual int32_t getType() const;
 private:
     UChar32 transform(UChar32 c) const;
@@ -18,6 +18,7 @@
 
 #include "uresimp.h" // ures_getByKeyWithFallback
 #include "ubrkimpl.h" // U_ICUDATA_BRKITR
+#include "umutex.h"
 #include "uvector.h"
 #include "cmemory.h"
 
@@ -139,13 +140,14 @@ class SimpleFilteredSentenceBreakData : public UMemory {
 public:
   SimpleFilteredSentenceBreakData(UCharsTrie *forwards, UCharsTrie *backwards ) 
       : fForwardsPartialTrie(forwards), fBackwardsTrie(backwards), refcount(1) { }
-  SimpleFilteredSentenceBreakData *incr() { refcount++;  return this; }
-  SimpleFilteredSentenceBreakData *decr() { if((--refcount) <= 0) delete this; return 0; }
+  // Clones on different threads share this data, see BreakIterator::createInstance().
+  SimpleFilteredSentenceBreakData *incr() { umtx_atomic_inc(&refcount);  return this; }
+  SimpleFilteredSentenceBreakData *decr() { if(umtx_atomic_dec(&refcount) <= 0) delete this; return 0; }
   virtual ~SimpleFilteredSentenceBreakData();
 
   LocalPointer<UCharsTrie>    fForwardsPartialTrie; //  Has ".a" for "a.M."
   LocalPointer<UCharsTrie>    fBackwardsTrie; //  i.e. ".srM" for Mrs.
-  int32_t                     refcount;
+  u_atomic_int32_t            refcount;
 };
 
 SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
@@ -261,7 +263,9 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
     int32_t bestValue = -1;
     // loops while 'n' points to an exception.
     utext_setNativeIndex(fText.getAlias(), n); // from n..
-    fData->fBackwardsTrie->reset();
+    // The shared tries are not modified; match with copies which have their own state.
+    UCharsTrie backwardsTrie(*fData->fBackwardsTrie);
+    backwardsTrie.reset();
     UChar32 uch;
 
     //if(debug2) u_printf(" n@ %d\n", n);
@@ -278,17 +282,17 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
     UStringTrieResult r = USTRINGTRIE_INTERMEDIATE_VALUE;
 
     while((uch=utext_previous32(fText.getAlias()))!=U_SENTINEL  &&   // more to consume backwards and..
-          USTRINGTRIE_HAS_NEXT(r=fData->fBackwardsTrie->nextForCodePoint(uch))) {// more in the trie
+          USTRINGTRIE_HAS_NEXT(r=backwardsTrie.nextForCodePoint(uch))) {// more in the trie
       if(USTRINGTRIE_HAS_VALUE(r)) { // remember the best match so far
         bestPosn = utext_getNativeIndex(fText.getAlias());
-        bestValue = fData->fBackwardsTrie->getValue();
+        bestValue = backwardsTrie.getValue();
       }
       //if(debug2) u_printf("rev< /%C/ cont?%d @%d\n", (UChar)uch, r, utext_getNativeIndex(fText.getAlias()));
     }
 
     if(USTRINGTRIE_MATCHES(r)) { // exact match?
       //if(debug2) u_printf("rev<?/%C/?end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
-      bestValue = fData->fBackwardsTrie->getValue();
+      bestValue = backwardsTrie.getValue();
       bestPosn = utext_getNativeIndex(fText.getAlias());
       //if(debug2) u_printf("rev<+/%C/+end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
     }
@@ -308,12 +312,13 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
         //if(debug2) u_printf(" partial backward match\n");
         // We matched the "Ph." in "Ph.D." - now we need to run everything through the forwards trie
         // to see if it matches something going forward.
-        fData->fForwardsPartialTrie->reset();
+        UCharsTrie forwardsPartialTrie(*fData->fForwardsPartialTrie);
+        forwardsPartialTrie.reset();
         UStringTrieResult rfwd = USTRINGTRIE_INTERMEDIATE_VALUE;
         utext_setNativeIndex(fText.getAlias(), bestPosn); // hope that's close ..
         //if(debug2) u_printf("Retrying at %d\n", bestPosn);
         while((uch=utext_next32(fText.getAlias()))!=U_SENTINEL &&
-              USTRINGTRIE_HAS_NEXT(rfwd=fData->fForwardsPartialTrie->nextForCodePoint(uch))) {
+              USTRINGTRIE_HAS_NEXT(rfwd=forwardsPartialTrie.nextForCodePoint(uch))) {
           //if(debug2) u_printf("fwd> /%C/ cont?%d @%d\n", (UChar)uch, rfwd, utext_getNativeIndex(fText.getAlias()));
         }
         if(USTRINGTRIE_MATCHES(rfwd)) {
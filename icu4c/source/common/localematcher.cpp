@@ -0,0 +1,400 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// localematcher.cpp
+
+#include "unicode/utypes.h"
+#include "unicode/bytestrie.h"
+#include "unicode/bytestriebuilder.h"
+#include "unicode/localematcher.h"
+#include "unicode/locid.h"
+#include "unicode/stringpiece.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "locdistance.h"
+#include "uhash.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+inline UBool isWhitespace(char c) {
+    return c == ' ' || c == '\t';
+}
+
+const char *skipWhitespace(const char *s, const char *limit) {
+    while (s < limit && isWhitespace(*s)) {
+        ++s;
+    }
+    return s;
+}
+
+/**
+ * Parses one item of an Accept-Language list, like "en-GB;q=0.8".
+ * Sets the tag and returns the quality value multiplied by 1000,
+ * or -1 if the item is not well-formed.
+ */
+int32_t parseListItem(const char *s, const char *limit, StringPiece &tag) {
+    s = skipWhitespace(s, limit);
+    const char *tagLimit = s;
+    while (tagLimit < limit && *tagLimit != ';' && !isWhitespace(*tagLimit)) {
+        ++tagLimit;
+    }
+    tag = StringPiece(s, static_cast<int32_t>(tagLimit - s));
+    int32_t quality = 1000;
+    for (s = skipWhitespace(tagLimit, limit); s < limit; s = skipWhitespace(s, limit)) {
+        if (*s != ';') {
+            return -1;
+        }
+        s = skipWhitespace(s + 1, limit);
+        if ((limit - s) >= 2 && (*s == 'q' || *s == 'Q') && s[1] == '=') {
+            // qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] )
+            s += 2;
+            if (s == limit || (*s != '0' && *s != '1')) {
+                return -1;
+            }
+            quality = (*s++ - '0') * 1000;
+            if (s < limit && *s == '.') {
+                int32_t scale = 100;
+                for (++s; s < limit && '0' <= *s && *s <= '9'; ++s) {
+                    if (scale == 0) {
+                        return -1;
+                    }
+                    quality += (*s - '0') * scale;
+                    scale /= 10;
+                }
+            }
+            if (quality > 1000) {
+                return -1;
+            }
+        } else {
+            // Ignore other parameters.
+            while (s < limit && *s != ';') {
+                ++s;
+            }
+        }
+    }
+    return quality;
+}
+
+/** Appends "language_Script_REGION", the trie key for an exact match. */
+int32_t getLSRKey(const LSR &lsr, char *key) {
+    int32_t length = static_cast<int32_t>(uprv_strlen(lsr.language));
+    uprv_memcpy(key, lsr.language, length);
+    key[length++] = '_';
+    for (const char *s = lsr.script; *s != 0; ++s) {
+        key[length++] = *s;
+    }
+    key[length++] = '_';
+    for (const char *s = lsr.region; *s != 0; ++s) {
+        key[length++] = *s;
+    }
+    key[length] = 0;
+    return length;
+}
+
+const int32_t LSR_KEY_CAPACITY = ULOC_LANG_CAPACITY + ULOC_SCRIPT_CAPACITY + ULOC_COUNTRY_CAPACITY;
+
+}  // namespace
+
+LocaleMatcher::LocaleMatcher(const Locale *supportedLocales, int32_t length, UErrorCode &errorCode)
+        : fDistance(NULL), fSupportedLocales(NULL), fSupportedLSRs(NULL), fSupportedLength(0),
+          fGroupIndexes(NULL), fGroupStarts(NULL), fGroupsLength(0), fTrieBytes(NULL),
+          fMatchAllLanguages(FALSE), fThreshold(0), fDemotionPerDesiredLocale(0) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (length < 0 || (supportedLocales == NULL && length > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fDistance = LocaleDistance::getSingleton(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    fThreshold = fDistance->getDefaultThreshold();
+    fDemotionPerDesiredLocale = fDistance->getDefaultDemotionPerDesiredLocale();
+    fMatchAllLanguages = fDistance->getMinWildcardLanguageDistance() < fThreshold;
+    if (length == 0) {
+        return;
+    }
+    fSupportedLocales = new Locale[length];
+    fSupportedLSRs = new LSR[length];
+    fGroupIndexes = static_cast<int32_t *>(uprv_malloc(length * 4));
+    fGroupStarts = static_cast<int32_t *>(uprv_malloc((length + 1) * 4));
+    MaybeStackArray<int32_t, 32> groups;
+    if (fSupportedLocales == NULL || fSupportedLSRs == NULL ||
+            fGroupIndexes == NULL || fGroupStarts == NULL ||
+            (length > groups.getCapacity() && groups.resize(length) == NULL)) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    fSupportedLength = length;
+    for (int32_t i = 0; i < length && U_SUCCESS(errorCode); ++i) {
+        fSupportedLocales[i] = supportedLocales[i];
+        fDistance->getMaximizedLSR(fSupportedLocales[i], fSupportedLSRs[i], errorCode);
+    }
+
+    // Group the supported locales by language, in order of first occurrence.
+    UHashtable *languageToGroup = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    for (int32_t i = 0; i < length; ++i) {
+        const char *language = fSupportedLSRs[i].language;
+        int32_t group = uhash_geti(languageToGroup, language) - 1;
+        if (group < 0) {
+            group = fGroupsLength++;
+            uhash_puti(languageToGroup, const_cast<char *>(language), group + 1, &errorCode);
+            fGroupStarts[group] = 0;
+        }
+        groups[i] = group;
+        ++fGroupStarts[group];
+    }
+    uhash_close(languageToGroup);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    // Turn the counts into limits, then fill in the indexes from the back.
+    for (int32_t g = 1; g < fGroupsLength; ++g) {
+        fGroupStarts[g] += fGroupStarts[g - 1];
+    }
+    fGroupStarts[fGroupsLength] = length;
+    for (int32_t i = length; i > 0;) {
+        --i;
+        fGroupIndexes[--fGroupStarts[groups[i]]] = i;
+    }
+
+    BytesTrieBuilder builder(errorCode);
+    for (int32_t g = 0; g < fGroupsLength && U_SUCCESS(errorCode); ++g) {
+        int32_t start = fGroupStarts[g], limit = fGroupStarts[g + 1];
+        builder.add(fSupportedLSRs[fGroupIndexes[start]].language, g, errorCode);
+        for (int32_t i = start; i < limit; ++i) {
+            // Only the first of several locales with the same maximized subtags.
+            const LSR &lsr = fSupportedLSRs[fGroupIndexes[i]];
+            int32_t j = start;
+            while (j < i && (uprv_strcmp(lsr.script, fSupportedLSRs[fGroupIndexes[j]].script) != 0 ||
+                    uprv_strcmp(lsr.region, fSupportedLSRs[fGroupIndexes[j]].region) != 0)) {
+                ++j;
+            }
+            if (j == i) {
+                char key[LSR_KEY_CAPACITY];
+                int32_t keyLength = getLSRKey(lsr, key);
+                builder.add(StringPiece(key, keyLength), fGroupIndexes[i], errorCode);
+            }
+        }
+    }
+    StringPiece trie = builder.buildStringPiece(USTRINGTRIE_BUILD_SMALL, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    fTrieBytes = static_cast<uint8_t *>(uprv_malloc(trie.length()));
+    if (fTrieBytes == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memcpy(fTrieBytes, trie.data(), trie.length());
+}
+
+LocaleMatcher::~LocaleMatcher() {
+    delete[] fSupportedLocales;
+    delete[] fSupportedLSRs;
+    uprv_free(fGroupIndexes);
+    uprv_free(fGroupStarts);
+    uprv_free(fTrieBytes);
+}
+
+const Locale *LocaleMatcher::getBestMatch(const Locale &desiredLocale, UErrorCode &errorCode) const {
+    return getBestMatch(&desiredLocale, 1, errorCode);
+}
+
+const Locale *LocaleMatcher::getBestMatch(const Locale *desiredLocales, int32_t length,
+                                          UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    if (length < 0 || (desiredLocales == NULL && length > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    MaybeStackArray<LSR, 8> lsrs;
+    if (length > lsrs.getCapacity() && lsrs.resize(length) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    for (int32_t i = 0; i < length; ++i) {
+        fDistance->getMaximizedLSR(desiredLocales[i], lsrs[i], errorCode);
+    }
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    return getBestMatch(lsrs.getAlias(), length);
+}
+
+const Locale *LocaleMatcher::getBestMatchForListString(StringPiece desiredLocaleList,
+                                                       UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    // Collect the tags sorted by descending quality, stable for equal qualities.
+    // They are parsed and maximized only until no later one can win.
+    struct Item {
+        StringPiece tag;
+        int32_t quality;
+    };
+    MaybeStackArray<Item, 16> items;
+    int32_t length = 0;
+    const char *s = desiredLocaleList.data();
+    const char *limit = s + desiredLocaleList.length();
+    for (const char *itemLimit; s < limit; s = itemLimit + 1) {
+        itemLimit = s;
+        while (itemLimit < limit && *itemLimit != ',') {
+            ++itemLimit;
+        }
+        StringPiece tag;
+        int32_t quality = parseListItem(s, itemLimit, tag);
+        if (quality <= 0 || tag.empty() || tag == StringPiece("*")) {
+            continue;
+        }
+        if (length == items.getCapacity() && items.resize(2 * length, length) == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        int32_t i = length++;
+        for (; i > 0 && items[i - 1].quality < quality; --i) {
+            items[i] = items[i - 1];
+        }
+        items[i].tag = tag;
+        items[i].quality = quality;
+    }
+    if (fSupportedLength == 0) {
+        return NULL;
+    }
+    int32_t bestIndex = -1;
+    int32_t bestScore = INT32_MAX;
+    for (int32_t i = 0, desiredIndex = 0; i < length; ++i) {
+        int32_t demotion = desiredIndex * fDemotionPerDesiredLocale;
+        if (demotion >= bestScore) {
+            break;
+        }
+        UErrorCode localErrorCode = U_ZERO_ERROR;
+        Locale locale = Locale::forLanguageTag(items[i].tag, localErrorCode);
+        if (U_FAILURE(localErrorCode) || locale.isBogus()) {
+            continue;
+        }
+        LSR lsr;
+        fDistance->getMaximizedLSR(locale, lsr, localErrorCode);
+        if (U_FAILURE(localErrorCode)) {
+            continue;
+        }
+        matchDesired(lsr, demotion, bestIndex, bestScore);
+        ++desiredIndex;
+    }
+    return &fSupportedLocales[bestIndex >= 0 ? bestIndex : 0];
+}
+
+int32_t LocaleMatcher::getDistance(const Locale &desired, const Locale &supported,
+                                   UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    LSR desiredLSR, supportedLSR;
+    fDistance->getMaximizedLSR(desired, desiredLSR, errorCode);
+    fDistance->getMaximizedLSR(supported, supportedLSR, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    return fDistance->getDistance(desiredLSR, supportedLSR, INT32_MAX);
+}
+
+int32_t LocaleMatcher::getThreshold() const {
+    return fThreshold;
+}
+
+const Locale *LocaleMatcher::getBestMatch(const LSR *desired, int32_t length) const {
+    if (fSupportedLength == 0) {
+        return NULL;
+    }
+    int32_t bestIndex = -1;
+    int32_t bestScore = INT32_MAX;
+    for (int32_t i = 0; i < length; ++i) {
+        int32_t demotion = i * fDemotionPerDesiredLocale;
+        if (demotion >= bestScore) {
+            break;
+        }
+        matchDesired(desired[i], demotion, bestIndex, bestScore);
+    }
+    return &fSupportedLocales[bestIndex >= 0 ? bestIndex : 0];
+}
+
+void LocaleMatcher::matchDesired(const LSR &desired, int32_t demotion,
+                                 int32_t &bestIndex, int32_t &bestScore) const {
+    // A later desired locale must be closer by the demotion to win.
+    int32_t distance = bestScore - demotion < fThreshold ? bestScore - demotion : fThreshold;
+    int32_t index = getBestIndex(desired, distance);
+    if (index >= 0) {
+        bestIndex = index;
+        bestScore = distance + demotion;
+    }
+}
+
+int32_t LocaleMatcher::getBestIndex(const LSR &desired, int32_t &bestDistance) const {
+    char key[LSR_KEY_CAPACITY];
+    getLSRKey(desired, key);
+    int32_t languageLength = static_cast<int32_t>(uprv_strlen(desired.language));
+    BytesTrie trie(fTrieBytes);
+    UStringTrieResult result = trie.next(key, languageLength);
+    int32_t group = -1;
+    if (USTRINGTRIE_HAS_VALUE(result)) {
+        group = trie.getValue();
+    }
+    if (USTRINGTRIE_HAS_NEXT(result) &&
+            USTRINGTRIE_HAS_VALUE(trie.next(key + languageLength, -1))) {
+        if (bestDistance > 0) {
+            bestDistance = 0;
+            return trie.getValue();
+        }
+        return -1;
+    }
+    int32_t bestIndex = -1;
+    if (group >= 0) {
+        matchGroup(desired, group, bestIndex, bestDistance);
+    }
+    if (fMatchAllLanguages) {
+        for (int32_t g = 0; g < fGroupsLength; ++g) {
+            if (g != group) {
+                matchGroup(desired, g, bestIndex, bestDistance);
+            }
+        }
+    } else {
+        // Only languages with specific rules can be closer than the threshold.
+        int32_t rulesLength;
+        const LocaleDistance::LanguageRule *rules =
+            fDistance->getLanguageRules(desired.languageKey, rulesLength);
+        for (int32_t i = 0; i < rulesLength; ++i) {
+            if (rules[i].distance <= bestDistance) {
+                trie.reset();
+                if (USTRINGTRIE_HAS_VALUE(trie.next(rules[i].language, -1))) {
+                    matchGroup(desired, trie.getValue(), bestIndex, bestDistance);
+                }
+            }
+        }
+    }
+    return bestIndex;
+}
+
+void LocaleMatcher::matchGroup(const LSR &desired, int32_t group,
+                               int32_t &bestIndex, int32_t &bestDistance) const {
+    for (int32_t i = fGroupStarts[group]; i < fGroupStarts[group + 1]; ++i) {
+        int32_t index = fGroupIndexes[i];
+        int32_t distance = fDistance->getDistance(desired, fSupportedLSRs[index], bestDistance + 1);
+        // Groups are visited out of order: On a tie, the earlier supported locale wins.
+        if (distance < bestDistance ||
+                (distance == bestDistance && bestIndex >= 0 && index < bestIndex)) {
+            bestIndex = index;
+            bestDistance = distance;
+        }
+    }
+}
+
+U_NAMESPACE_END
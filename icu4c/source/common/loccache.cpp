@@ -0,0 +1,262 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  loccache.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Bounded caches for the results of uloc_addLikelySubtags(),
+*   uloc_minimizeSubtags() and uloc_toLanguageTag().
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/uloc.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "loccache.h"
+#include "mutex.h"
+#include "uassert.h"
+#include "ucln_cmn.h"
+#include "umutex.h"
+
+namespace {
+
+const int32_t DEFAULT_CAPACITY = 128;
+
+icu::LocaleIDCache *gLocaleIDCaches[icu::LocaleIDCache::TYPE_COUNT] = { NULL, NULL, NULL, NULL };
+icu::UInitOnce gLocaleIDCachesInitOnce = U_INITONCE_INITIALIZER;
+
+// One mutex per cache. A lookup moves the entry it finds to the front,
+// so even hits need exclusive access.
+UMutex gLocaleIDCacheMutexes[icu::LocaleIDCache::TYPE_COUNT] = {
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER
+};
+
+}  // namespace
+
+U_CDECL_BEGIN
+
+static UBool U_CALLCONV
+loccache_cleanup() {
+    for (int32_t i = 0; i < icu::LocaleIDCache::TYPE_COUNT; ++i) {
+        delete gLocaleIDCaches[i];
+        gLocaleIDCaches[i] = NULL;
+    }
+    gLocaleIDCachesInitOnce.reset();
+    return TRUE;
+}
+
+static void U_CALLCONV
+initLocaleIDCaches(UErrorCode &errorCode) {
+    ucln_common_registerCleanup(UCLN_COMMON_LOCALE_ID_CACHE, loccache_cleanup);
+    for (int32_t i = 0; i < icu::LocaleIDCache::TYPE_COUNT && U_SUCCESS(errorCode); ++i) {
+        gLocaleIDCaches[i] = new icu::LocaleIDCache(errorCode);
+        if (gLocaleIDCaches[i] == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
+    if (U_FAILURE(errorCode)) {
+        loccache_cleanup();
+    }
+}
+
+U_CDECL_END
+
+U_NAMESPACE_BEGIN
+
+struct LocaleIDCache::Entry : public UMemory {
+    Entry *prev;
+    Entry *next;
+    int32_t length;
+    char key[ULOC_FULLNAME_CAPACITY];
+    char value[ULOC_FULLNAME_CAPACITY];
+};
+
+LocaleIDCache::LocaleIDCache(UErrorCode &errorCode)
+        : fTable(NULL), fHead(NULL), fTail(NULL), fSize(0),
+          fCapacity(DEFAULT_CAPACITY), fHits(0), fMisses(0) {
+    fTable = uhash_openSize(uhash_hashChars, uhash_compareChars, NULL,
+                            DEFAULT_CAPACITY, &errorCode);
+}
+
+LocaleIDCache::~LocaleIDCache() {
+    removeAll();
+    uhash_close(fTable);
+}
+
+LocaleIDCache *LocaleIDCache::getInstance(Type type) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    umtx_initOnce(gLocaleIDCachesInitOnce, &initLocaleIDCaches, errorCode);
+    return U_SUCCESS(errorCode) ? gLocaleIDCaches[type] : NULL;
+}
+
+void LocaleIDCache::unlink(Entry *entry) {
+    if (entry->prev != NULL) {
+        entry->prev->next = entry->next;
+    } else {
+        fHead = entry->next;
+    }
+    if (entry->next != NULL) {
+        entry->next->prev = entry->prev;
+    } else {
+        fTail = entry->prev;
+    }
+}
+
+void LocaleIDCache::pushFront(Entry *entry) {
+    entry->prev = NULL;
+    entry->next = fHead;
+    if (fHead != NULL) {
+        fHead->prev = entry;
+    } else {
+        fTail = entry;
+    }
+    fHead = entry;
+}
+
+void LocaleIDCache::removeAll() {
+    uhash_removeAll(fTable);
+    while (fHead != NULL) {
+        Entry *next = fHead->next;
+        delete fHead;
+        fHead = next;
+    }
+    fTail = NULL;
+    fSize = 0;
+}
+
+int32_t LocaleIDCache::get(Type type, const char *key, char *dest, int32_t destCapacity) {
+    LocaleIDCache *cache = getInstance(type);
+    if (cache == NULL) {
+        return -1;
+    }
+    Mutex lock(&gLocaleIDCacheMutexes[type]);
+    if (cache->fCapacity == 0) {
+        return -1;
+    }
+    Entry *entry = static_cast<Entry *>(uhash_get(cache->fTable, key));
+    if (entry == NULL || entry->length >= destCapacity) {
+        ++cache->fMisses;
+        return -1;
+    }
+    if (entry != cache->fHead) {
+        cache->unlink(entry);
+        cache->pushFront(entry);
+    }
+    ++cache->fHits;
+    uprv_memcpy(dest, entry->value, entry->length + 1);
+    return entry->length;
+}
+
+void LocaleIDCache::put(Type type, const char *key, const char *value, int32_t length) {
+    if (length < 0 || length >= ULOC_FULLNAME_CAPACITY ||
+            uprv_strlen(key) >= ULOC_FULLNAME_CAPACITY) {
+        return;
+    }
+    LocaleIDCache *cache = getInstance(type);
+    if (cache == NULL) {
+        return;
+    }
+    Mutex lock(&gLocaleIDCacheMutexes[type]);
+    if (cache->fCapacity == 0) {
+        return;
+    }
+    Entry *entry = static_cast<Entry *>(uhash_get(cache->fTable, key));
+    if (entry != NULL) {
+        // Another thread computed the same result.
+        cache->unlink(entry);
+    } else {
+        if (cache->fSize < cache->fCapacity) {
+            entry = new Entry;
+            if (entry == NULL) {
+                return;
+            }
+            ++cache->fSize;
+        } else {
+            // Reuse the least recently used entry.
+            entry = cache->fTail;
+            uhash_remove(cache->fTable, entry->key);
+            cache->unlink(entry);
+        }
+        uprv_strcpy(entry->key, key);
+        UErrorCode errorCode = U_ZERO_ERROR;
+        uhash_put(cache->fTable, entry->key, entry, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            delete entry;
+            --cache->fSize;
+            return;
+        }
+    }
+    uprv_memcpy(entry->value, value, length);
+    entry->value[length] = 0;
+    entry->length = length;
+    cache->pushFront(entry);
+}
+
+void LocaleIDCache::getCounts(Type type, int64_t &hits, int64_t &misses) {
+    hits = misses = 0;
+    LocaleIDCache *cache = getInstance(type);
+    if (cache != NULL) {
+        Mutex lock(&gLocaleIDCacheMutexes[type]);
+        hits = cache->fHits;
+        misses = cache->fMisses;
+    }
+}
+
+void LocaleIDCache::setCapacity(int32_t capacity) {
+    for (int32_t i = 0; i < TYPE_COUNT; ++i) {
+        LocaleIDCache *cache = getInstance(static_cast<Type>(i));
+        if (cache != NULL) {
+            Mutex lock(&gLocaleIDCacheMutexes[i]);
+            cache->removeAll();
+            cache->fCapacity = capacity;
+            cache->fHits = cache->fMisses = 0;
+        }
+    }
+}
+
+U_NAMESPACE_END
+
+U_CAPI void U_EXPORT2
+uloc_getCacheCounts(ULocCacheType type, int64_t *hits, int64_t *misses) {
+    int64_t h = 0, m = 0;
+    switch (type) {
+    case ULOC_CACHE_ADD_LIKELY_SUBTAGS:
+        icu::LocaleIDCache::getCounts(icu::LocaleIDCache::ADD_LIKELY_SUBTAGS, h, m);
+        break;
+    case ULOC_CACHE_MINIMIZE_SUBTAGS:
+        icu::LocaleIDCache::getCounts(icu::LocaleIDCache::MINIMIZE_SUBTAGS, h, m);
+        break;
+    case ULOC_CACHE_TO_LANGUAGE_TAG: {
+        int64_t strictHits, strictMisses;
+        icu::LocaleIDCache::getCounts(icu::LocaleIDCache::TO_LANGUAGE_TAG, h, m);
+        icu::LocaleIDCache::getCounts(icu::LocaleIDCache::TO_LANGUAGE_TAG_STRICT,
+                                      strictHits, strictMisses);
+        h += strictHits;
+        m += strictMisses;
+        break;
+    }
+    default:
+        break;
+    }
+    if (hits != NULL) {
+        *hits = h;
+    }
+    if (misses != NULL) {
+        *misses = m;
+    }
+}
+
+U_CAPI void U_EXPORT2
+uloc_setCacheCapacity(int32_t capacity, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (capacity < 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    icu::LocaleIDCache::setCapacity(capacity);
+}
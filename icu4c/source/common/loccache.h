@@ -0,0 +1,92 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  loccache.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Bounded caches for the results of uloc_addLikelySubtags(),
+*   uloc_minimizeSubtags() and uloc_toLanguageTag().
+*/
+
+#ifndef LOCCACHE_H
+#define LOCCACHE_H
+
+#include "unicode/utypes.h"
+#include "unicode/uobject.h"
+#include "uhash.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Thread-safe least-recently-used maps from input locale IDs
+ * to the results of converting them, one map per conversion.
+ *
+ * Only keys and values shorter than ULOC_FULLNAME_CAPACITY are cached.
+ * Only successful results that are independent of the caller's buffer
+ * size should be put into the cache.
+ *
+ * @internal
+ */
+class LocaleIDCache : public UMemory {
+public:
+    enum Type {
+        ADD_LIKELY_SUBTAGS,
+        MINIMIZE_SUBTAGS,
+        TO_LANGUAGE_TAG,
+        /** uloc_toLanguageTag(strict=TRUE); counted as TO_LANGUAGE_TAG. */
+        TO_LANGUAGE_TAG_STRICT,
+        TYPE_COUNT
+    };
+
+    /**
+     * Looks up the result for the key. If found, and if it is shorter than
+     * destCapacity, then copies it and a NUL terminator to dest,
+     * makes it the most recently used entry, and counts a hit.
+     * Otherwise counts a miss.
+     * @return the length of the result, or -1 if not copied
+     */
+    static int32_t get(Type type, const char *key, char *dest, int32_t destCapacity);
+
+    /**
+     * Adds or replaces the result for the key, evicting the least recently used
+     * entry if the cache is full. Does nothing if the key or value is too long,
+     * or if memory allocation fails.
+     */
+    static void put(Type type, const char *key, const char *value, int32_t length);
+
+    static void getCounts(Type type, int64_t &hits, int64_t &misses);
+
+    /** Sets the capacity of each cache, empties them, and resets the counts. */
+    static void setCapacity(int32_t capacity);
+
+    /** Used by the one-time initialization of the caches. */
+    LocaleIDCache(UErrorCode &errorCode);
+    ~LocaleIDCache();
+
+private:
+    struct Entry;
+
+    LocaleIDCache(const LocaleIDCache &other);  // not implemented
+    LocaleIDCache &operator=(const LocaleIDCache &other);  // not implemented
+
+    static LocaleIDCache *getInstance(Type type);
+
+    void unlink(Entry *entry);
+    void pushFront(Entry *entry);
+    void removeAll();
+
+    UHashtable *fTable;  // key -> Entry*, not owned
+    Entry *fHead;  // most recently used
+    Entry *fTail;  // least recently used
+    int32_t fSize;
+    int32_t fCapacity;
+    int64_t fHits;
+    int64_t fMisses;
+};
+
+U_NAMESPACE_END
+
+#endif  // LOCCACHE_H
@@ -0,0 +1,723 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  locdistance.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Distances between maximized locales, precomputed from the CLDR
+*   languageMatching data, for LocaleMatcher.
+*/
+
+#include "unicode/utypes.h"
+#include "unicode/locid.h"
+#include "unicode/uloc.h"
+#include "unicode/ures.h"
+#include "unicode/ustring.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "uinvchar.h"
+#include "locdistance.h"
+#include "uarrsort.h"
+#include "ucln_cmn.h"
+#include "uhash.h"
+#include "umutex.h"
+#include "uvectr32.h"
+
+namespace {
+
+/** Pattern value for "*". */
+const int32_t ANY = -1;
+
+// Region patterns: match variable index, negated variable index,
+// or index of a region named in a rule.
+const int32_t REGION_VARIABLE = 0x100;
+const int32_t REGION_NOT_VARIABLE = 0x200;
+const int32_t REGION_LITERAL = 0x400;
+const int32_t REGION_INDEX_MASK = 0xff;
+
+/** Table value for partition pairs that no rule of a group matches. */
+const uint8_t NO_RULE = 0xff;
+
+/** Distance for subtags that no rule matches; CLDR always has catch-all rules. */
+const int32_t NO_MATCH_DISTANCE = 100;
+
+// Field lengths are limited by the packed keys and by the LSR buffers.
+const int32_t MAX_SUBTAG_LENGTH = 15;
+
+icu::LocaleDistance *gLocaleDistance = NULL;
+icu::UInitOnce gLocaleDistanceInitOnce = U_INITONCE_INITIALIZER;
+
+}  // namespace
+
+U_CDECL_BEGIN
+
+static UBool U_CALLCONV
+locdistance_cleanup() {
+    delete gLocaleDistance;
+    gLocaleDistance = NULL;
+    gLocaleDistanceInitOnce.reset();
+    return TRUE;
+}
+
+static void U_CALLCONV
+initLocaleDistance(UErrorCode &errorCode) {
+    ucln_common_registerCleanup(UCLN_COMMON_LOCALE_DISTANCE, locdistance_cleanup);
+    gLocaleDistance = new icu::LocaleDistance(errorCode);
+    if (gLocaleDistance == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    } else if (U_FAILURE(errorCode)) {
+        delete gLocaleDistance;
+        gLocaleDistance = NULL;
+    }
+}
+
+static int32_t U_CALLCONV
+compareLanguageRules(const void * /*context*/, const void *left, const void *right) {
+    const icu::LocaleDistance::LanguageRule *l =
+        static_cast<const icu::LocaleDistance::LanguageRule *>(left);
+    const icu::LocaleDistance::LanguageRule *r =
+        static_cast<const icu::LocaleDistance::LanguageRule *>(right);
+    return l->desired < r->desired ? -1 : l->desired > r->desired ? 1 : 0;
+}
+
+U_CDECL_END
+
+U_NAMESPACE_BEGIN
+
+/** One languageMatchingNew rule as parsed from the data. */
+struct LocaleDistance::Rule {
+    /** 1, 2 or 3 for language, language_script or language_script_region patterns */
+    int32_t level;
+    /** language key, script key, region pattern; ANY for "*" */
+    int32_t desired[3];
+    int32_t supported[3];
+    int32_t distance;
+    UBool oneway;
+    int32_t index;
+    char desiredLanguage[4];
+    char supportedLanguage[4];
+};
+
+/** Language or script rule; each oneway direction of a symmetric rule is a separate one. */
+struct LocaleDistance::SubtagRule {
+    int32_t desiredLanguage;
+    int32_t desiredScript;
+    int32_t supportedLanguage;
+    int32_t supportedScript;
+    int32_t distance;
+    int32_t index;
+};
+
+/** Consecutive region rules with the same language and script patterns. */
+struct LocaleDistance::RegionRuleGroup {
+    int32_t desiredLanguage;
+    int32_t desiredScript;
+    int32_t supportedLanguage;
+    int32_t supportedScript;
+    /** distance or NO_RULE, indexed by desired partition * partition count + supported partition */
+    const uint8_t *table;
+};
+
+namespace {
+
+inline UBool matchesSubtag(int32_t pattern, int32_t key) {
+    return pattern == ANY || pattern == key;
+}
+
+UBool matchesRegion(int32_t pattern, int32_t partition, int32_t variablesLength) {
+    if (pattern == ANY) {
+        return TRUE;
+    }
+    int32_t index = pattern & REGION_INDEX_MASK;
+    if ((pattern & REGION_VARIABLE) != 0) {
+        return (partition & (1 << index)) != 0;
+    } else if ((pattern & REGION_NOT_VARIABLE) != 0) {
+        return (partition & (1 << index)) == 0;
+    } else {
+        return (partition >> variablesLength) == index + 1;
+    }
+}
+
+/**
+ * Copies a resource string into a char buffer.
+ * Rules use '$' and '!' which are not invariant characters.
+ */
+void getRuleString(UResourceBundle *res, int32_t index, char *dest, UErrorCode &errorCode) {
+    int32_t length;
+    const UChar *s = ures_getStringByIndex(res, index, &length, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (length > MAX_SUBTAG_LENGTH * 3 + 2) {
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < length; ++i) {
+        UChar c = s[i];
+        if (c == 0x24) {
+            dest[i] = '$';
+        } else if (c == 0x21) {
+            dest[i] = '!';
+        } else if (uprv_isInvariantUString(s + i, 1)) {
+            u_UCharsToChars(s + i, dest + i, 1);
+        } else {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return;
+        }
+    }
+    dest[length] = 0;
+}
+
+/** Splits "ar_*_$maghreb" and returns the number of fields, or 0 if there are too many. */
+int32_t splitPattern(char *s, char *fields[3]) {
+    int32_t length = 0;
+    for (;;) {
+        if (length == 3) {
+            return 0;
+        }
+        fields[length++] = s;
+        char *sep = uprv_strchr(s, '_');
+        if (sep == NULL) {
+            return length;
+        }
+        *sep = 0;
+        s = sep + 1;
+    }
+}
+
+/** Adds region -> UVector32 of contained regions for each array in the table. */
+void addContainment(UResourceBundle *table, UHashtable *containment, UErrorCode &errorCode) {
+    LocalUResourceBundlePointer item;
+    while (U_SUCCESS(errorCode) && ures_hasNext(table)) {
+        item.adoptInstead(ures_getNextResource(table, item.orphan(), &errorCode));
+        int32_t region = LocaleDistance::getRegionKey(ures_getKey(item.getAlias()));
+        if (U_FAILURE(errorCode) || region == 0 || ures_getType(item.getAlias()) != URES_ARRAY) {
+            continue;
+        }
+        UVector32 *children = new UVector32(errorCode);
+        if (children == NULL) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        uhash_iput(containment, region, children, &errorCode);
+        int32_t size = ures_getSize(item.getAlias());
+        for (int32_t i = 0; i < size && U_SUCCESS(errorCode); ++i) {
+            char child[MAX_SUBTAG_LENGTH * 3 + 3];
+            getRuleString(item.getAlias(), i, child, errorCode);
+            children->addElement(LocaleDistance::getRegionKey(child), errorCode);
+        }
+    }
+}
+
+/** Sets the bit for the region and all of the regions it contains. */
+void addRegionBit(const UHashtable *containment, UHashtable *partitions,
+                  int32_t region, int32_t bit, int32_t depth, UErrorCode &errorCode) {
+    if (depth > 8) {  // guard against cycles in bad data
+        return;
+    }
+    uhash_iputi(partitions, region, uhash_igeti(partitions, region) | bit, &errorCode);
+    const UVector32 *children = static_cast<const UVector32 *>(uhash_iget(containment, region));
+    if (children != NULL) {
+        for (int32_t i = 0; i < children->size() && U_SUCCESS(errorCode); ++i) {
+            addRegionBit(containment, partitions, children->elementAti(i), bit, depth + 1, errorCode);
+        }
+    }
+}
+
+/** Returns TRUE if all of the leaf regions that the region contains have the bit. */
+UBool allLeavesHaveBit(const UHashtable *containment, const UHashtable *partitions,
+                       int32_t region, int32_t bit, int32_t depth) {
+    const UVector32 *children = static_cast<const UVector32 *>(uhash_iget(containment, region));
+    if (children == NULL || depth > 8) {
+        return (uhash_igeti(partitions, region) & bit) != 0;
+    }
+    for (int32_t i = 0; i < children->size(); ++i) {
+        if (!allLeavesHaveBit(containment, partitions, children->elementAti(i), bit, depth + 1)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+}  // namespace
+
+const LocaleDistance *LocaleDistance::getSingleton(UErrorCode &errorCode) {
+    umtx_initOnce(gLocaleDistanceInitOnce, &initLocaleDistance, errorCode);
+    return gLocaleDistance;
+}
+
+LocaleDistance::LocaleDistance(UErrorCode &errorCode)
+        : fLanguageRuleStarts(NULL), fLanguageRulesLength(0),
+          fWildcardLanguageRulesLength(0), fScriptRulesLength(0), fRegionRuleGroupsLength(0),
+          fRegionPartitions(NULL), fVariablesLength(0), fLiteralRegionsLength(0),
+          fPartitionCount(1),
+          fMinWildcardLanguageDistance(NO_MATCH_DISTANCE),
+          fDefaultThreshold(50), fDefaultDemotion(5) {
+    fLanguageRuleStarts = uhash_open(uhash_hashLong, uhash_compareLong, NULL, &errorCode);
+    fRegionPartitions = uhash_open(uhash_hashLong, uhash_compareLong, NULL, &errorCode);
+    load(errorCode);
+}
+
+LocaleDistance::~LocaleDistance() {
+    uhash_close(fLanguageRuleStarts);
+    uhash_close(fRegionPartitions);
+}
+
+int32_t LocaleDistance::getLanguageKey(const char *language) {
+    // Two or three lowercase ASCII letters pack into 15 bits.
+    int32_t key = 0;
+    for (int32_t i = 0; language[i] != 0; ++i) {
+        char c = language[i];
+        if (i == 3 || c < 'a' || 'z' < c) {
+            return LSR::LANGUAGE_KEY_OTHER;
+        }
+        key = (key << 5) | (c - 'a' + 1);
+    }
+    return key;
+}
+
+int32_t LocaleDistance::getScriptKey(const char *script) {
+    int32_t key = 0;
+    for (int32_t i = 0; i < 4 && script[i] != 0; ++i) {
+        key = (key << 8) | (uint8_t)script[i];
+    }
+    return key;
+}
+
+int32_t LocaleDistance::getRegionKey(const char *region) {
+    int32_t key = 0;
+    for (int32_t i = 0; region[i] != 0; ++i) {
+        if (i == 3) {
+            return 0;
+        }
+        key = (key << 8) | (uint8_t)region[i];
+    }
+    return key;
+}
+
+void LocaleDistance::load(UErrorCode &errorCode) {
+    LocalUResourceBundlePointer supplementalData(ures_openDirect(NULL, "supplementalData", &errorCode));
+    loadRegionPartitions(supplementalData.getAlias(), errorCode);
+    LocalUResourceBundlePointer rulesRes(
+        ures_getByKey(supplementalData.getAlias(), "languageMatchingNew", NULL, &errorCode));
+    ures_getByKey(rulesRes.getAlias(), "written", rulesRes.getAlias(), &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    int32_t length = ures_getSize(rulesRes.getAlias());
+    LocalMemory<Rule> rules;
+    if (rules.allocateInsteadAndReset(length) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    LocalUResourceBundlePointer ruleRes;
+    for (int32_t i = 0; i < length; ++i) {
+        ruleRes.adoptInstead(ures_getByIndex(rulesRes.getAlias(), i, ruleRes.orphan(), &errorCode));
+        char desired[MAX_SUBTAG_LENGTH * 3 + 3], supported[MAX_SUBTAG_LENGTH * 3 + 3];
+        char distance[MAX_SUBTAG_LENGTH * 3 + 3], oneway[MAX_SUBTAG_LENGTH * 3 + 3];
+        getRuleString(ruleRes.getAlias(), 0, desired, errorCode);
+        getRuleString(ruleRes.getAlias(), 1, supported, errorCode);
+        getRuleString(ruleRes.getAlias(), 2, distance, errorCode);
+        getRuleString(ruleRes.getAlias(), 3, oneway, errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        Rule &rule = rules[i];
+        char *desiredFields[3], *supportedFields[3];
+        rule.level = splitPattern(desired, desiredFields);
+        if (rule.level == 0 || splitPattern(supported, supportedFields) != rule.level) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return;
+        }
+        for (int32_t j = 0; j < rule.level; ++j) {
+            const char *d = desiredFields[j], *s = supportedFields[j];
+            if (uprv_strlen(d) > MAX_SUBTAG_LENGTH || uprv_strlen(s) > MAX_SUBTAG_LENGTH) {
+                errorCode = U_INVALID_FORMAT_ERROR;
+                return;
+            }
+            if (j == 0) {
+                rule.desired[j] = uprv_strcmp(d, "*") == 0 ? ANY : getLanguageKey(d);
+                rule.supported[j] = uprv_strcmp(s, "*") == 0 ? ANY : getLanguageKey(s);
+                // Rules only name 2- and 3-letter languages; keys cannot distinguish others.
+                if (rule.desired[j] == LSR::LANGUAGE_KEY_OTHER ||
+                        rule.supported[j] == LSR::LANGUAGE_KEY_OTHER) {
+                    errorCode = U_INVALID_FORMAT_ERROR;
+                    return;
+                }
+                uprv_strcpy(rule.desiredLanguage, d);
+                uprv_strcpy(rule.supportedLanguage, s);
+            } else if (j == 1) {
+                rule.desired[j] = uprv_strcmp(d, "*") == 0 ? ANY : getScriptKey(d);
+                rule.supported[j] = uprv_strcmp(s, "*") == 0 ? ANY : getScriptKey(s);
+            } else {
+                rule.desired[j] = parseRegionPattern(d, errorCode);
+                rule.supported[j] = parseRegionPattern(s, errorCode);
+            }
+        }
+        rule.distance = static_cast<int32_t>(uprv_strtoul(distance, NULL, 10));
+        if (rule.distance >= NO_RULE) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+        }
+        rule.oneway = uprv_strcmp(oneway, "1") == 0;
+        rule.index = i;
+    }
+    fPartitionCount = (1 << fVariablesLength) * (fLiteralRegionsLength + 1);
+    addRules(rules.getAlias(), length, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+
+    for (int32_t i = 0; i < fScriptRulesLength; ++i) {
+        const SubtagRule &rule = fScriptRules[i];
+        if (rule.desiredLanguage == ANY && rule.desiredScript == ANY &&
+                rule.supportedLanguage == ANY && rule.supportedScript == ANY) {
+            fDefaultThreshold = rule.distance;
+            break;
+        }
+    }
+    LSR en, enGB;
+    getMaximizedLSR(Locale::getEnglish(), en, errorCode);
+    getMaximizedLSR(Locale::getUK(), enGB, errorCode);
+    if (U_SUCCESS(errorCode)) {
+        fDefaultDemotion = getDistance(en, enGB, NO_MATCH_DISTANCE);
+    }
+}
+
+void LocaleDistance::loadRegionPartitions(UResourceBundle *supplementalData, UErrorCode &errorCode) {
+    LocalUResourceBundlePointer res(
+        ures_getByKey(supplementalData, "territoryContainment", NULL, &errorCode));
+    UHashtable *containment = uhash_open(uhash_hashLong, uhash_compareLong, NULL, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    uhash_setValueDeleter(containment, uprv_deleteUObject);
+    addContainment(res.getAlias(), containment, errorCode);
+    // Macro regions like 419 that are not part of the main hierarchy.
+    LocalUResourceBundlePointer item(ures_getByKey(res.getAlias(), "grouping", NULL, &errorCode));
+    addContainment(item.getAlias(), containment, errorCode);
+
+    res.adoptInstead(ures_getByKey(supplementalData, "languageMatchingInfo", res.orphan(), &errorCode));
+    ures_getByKey(res.getAlias(), "written", res.getAlias(), &errorCode);
+    ures_getByKey(res.getAlias(), "matchVariable", res.getAlias(), &errorCode);
+    while (U_SUCCESS(errorCode) && ures_hasNext(res.getAlias())) {
+        item.adoptInstead(ures_getNextResource(res.getAlias(), item.orphan(), &errorCode));
+        const char *name = ures_getKey(item.getAlias());
+        char value[MAX_SUBTAG_LENGTH * 3 + 3];
+        getRuleString(res.getAlias(), fVariablesLength, value, errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+        if (fVariablesLength == UPRV_LENGTHOF(fVariables) ||
+                uprv_strlen(name) >= UPRV_LENGTHOF(fVariables[0])) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            break;
+        }
+        uprv_strcpy(fVariables[fVariablesLength], name);
+        int32_t bit = 1 << fVariablesLength++;
+        // The value is a list of regions like "HK+MO".
+        for (char *region = value;;) {
+            char *plus = uprv_strchr(region, '+');
+            if (plus != NULL) {
+                *plus = 0;
+            }
+            addRegionBit(containment, fRegionPartitions, getRegionKey(region), bit, 0, errorCode);
+            if (plus == NULL) {
+                break;
+            }
+            region = plus + 1;
+        }
+        // A macro region like 419 belongs to the variable if all of its countries do.
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *e;
+        while (U_SUCCESS(errorCode) && (e = uhash_nextElement(containment, &pos)) != NULL) {
+            int32_t macro = e->key.integer;
+            if (allLeavesHaveBit(containment, fRegionPartitions, macro, bit, 0)) {
+                uhash_iputi(fRegionPartitions, macro,
+                            uhash_igeti(fRegionPartitions, macro) | bit, &errorCode);
+            }
+        }
+    }
+    uhash_close(containment);
+}
+
+int32_t LocaleDistance::parseRegionPattern(const char *s, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return ANY;
+    }
+    if (uprv_strcmp(s, "*") == 0) {
+        return ANY;
+    }
+    if (*s == '$') {
+        int32_t type = REGION_VARIABLE;
+        if (*++s == '!') {
+            type = REGION_NOT_VARIABLE;
+            ++s;
+        }
+        for (int32_t i = 0; i < fVariablesLength; ++i) {
+            if (uprv_strcmp(s, fVariables[i]) == 0) {
+                return type | i;
+            }
+        }
+        errorCode = U_INVALID_FORMAT_ERROR;
+        return ANY;
+    }
+    int32_t region = getRegionKey(s);
+    int32_t i = 0;
+    while (i < fLiteralRegionsLength && fLiteralRegions[i] != region) {
+        ++i;
+    }
+    if (i == fLiteralRegionsLength) {
+        if (region == 0 || i == UPRV_LENGTHOF(fLiteralRegions)) {
+            errorCode = U_INVALID_FORMAT_ERROR;
+            return ANY;
+        }
+        fLiteralRegions[fLiteralRegionsLength++] = region;
+        int32_t partition = uhash_igeti(fRegionPartitions, region) | ((i + 1) << fVariablesLength);
+        uhash_iputi(fRegionPartitions, region, partition, &errorCode);
+    }
+    return REGION_LITERAL | i;
+}
+
+void LocaleDistance::addRules(const Rule *rules, int32_t length, UErrorCode &errorCode) {
+    // Each symmetric rule with different patterns becomes two oneway rules,
+    // so allocate for twice the number of rules.
+    if (fLanguageRules.allocateInsteadAndReset(2 * length) == NULL ||
+            fWildcardLanguageRules.allocateInsteadAndReset(2 * length) == NULL ||
+            fScriptRules.allocateInsteadAndReset(2 * length) == NULL ||
+            fRegionRuleGroups.allocateInsteadAndReset(2 * length) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    // Region rules, each oneway rule in rule order, with supported and desired patterns swapped
+    // for the reverse direction of symmetric rules whose language or script patterns differ.
+    LocalMemory<Rule> regionRules;
+    if (regionRules.allocateInsteadAndReset(2 * length) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t regionRulesLength = 0;
+    for (int32_t i = 0; i < length; ++i) {
+        const Rule &rule = rules[i];
+        UBool isSymmetric = rule.desired[0] == rule.supported[0] &&
+            (rule.level < 2 || rule.desired[1] == rule.supported[1]);
+        for (int32_t dir = 0; dir < 2; ++dir) {
+            if (dir == 1 && (rule.oneway || isSymmetric)) {
+                break;
+            }
+            const int32_t *d = dir == 0 ? rule.desired : rule.supported;
+            const int32_t *s = dir == 0 ? rule.supported : rule.desired;
+            if (rule.level == 1) {
+                if (d[0] != ANY && s[0] != ANY) {
+                    LanguageRule &lr = fLanguageRules[fLanguageRulesLength++];
+                    lr.desired = d[0];
+                    lr.supported = s[0];
+                    lr.distance = rule.distance;
+                    lr.index = rule.index;
+                    uprv_memcpy(lr.language,
+                                dir == 0 ? rule.supportedLanguage : rule.desiredLanguage, 4);
+                } else {
+                    SubtagRule &sr = fWildcardLanguageRules[fWildcardLanguageRulesLength++];
+                    sr.desiredLanguage = d[0];
+                    sr.desiredScript = ANY;
+                    sr.supportedLanguage = s[0];
+                    sr.supportedScript = ANY;
+                    sr.distance = rule.distance;
+                    sr.index = rule.index;
+                    if (rule.distance < fMinWildcardLanguageDistance) {
+                        fMinWildcardLanguageDistance = rule.distance;
+                    }
+                }
+            } else if (rule.level == 2) {
+                SubtagRule &sr = fScriptRules[fScriptRulesLength++];
+                sr.desiredLanguage = d[0];
+                sr.desiredScript = d[1];
+                sr.supportedLanguage = s[0];
+                sr.supportedScript = s[1];
+                sr.distance = rule.distance;
+                sr.index = rule.index;
+            } else {
+                Rule &rr = regionRules[regionRulesLength++];
+                rr = rule;
+                if (dir == 1) {
+                    uprv_memcpy(rr.desired, rule.supported, sizeof(rr.desired));
+                    uprv_memcpy(rr.supported, rule.desired, sizeof(rr.supported));
+                }
+                rr.oneway = rule.oneway || !isSymmetric;
+            }
+        }
+    }
+
+    // Index the literal language rules by desired language, keeping rule order.
+    uprv_sortArray(fLanguageRules.getAlias(), fLanguageRulesLength, sizeof(LanguageRule),
+                   compareLanguageRules, NULL, TRUE, &errorCode);
+    for (int32_t i = 0; i < fLanguageRulesLength && U_SUCCESS(errorCode); ++i) {
+        if (i == 0 || fLanguageRules[i].desired != fLanguageRules[i - 1].desired) {
+            uhash_iputi(fLanguageRuleStarts, fLanguageRules[i].desired, i + 1, &errorCode);
+        }
+    }
+
+    // Count the groups of region rules, then precompute one table per group.
+    int32_t groupsLength = 0;
+    for (int32_t i = 0; i < regionRulesLength; ++i) {
+        if (i == 0 || uprv_memcmp(regionRules[i].desired, regionRules[i - 1].desired, 8) != 0 ||
+                uprv_memcmp(regionRules[i].supported, regionRules[i - 1].supported, 8) != 0) {
+            ++groupsLength;
+        }
+    }
+    int32_t tableSize = fPartitionCount * fPartitionCount;
+    if (U_FAILURE(errorCode) ||
+            fRegionTables.allocateInsteadAndReset(groupsLength * tableSize) == NULL) {
+        if (U_SUCCESS(errorCode)) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+        return;
+    }
+    for (int32_t start = 0, limit; start < regionRulesLength; start = limit) {
+        const Rule &first = regionRules[start];
+        for (limit = start + 1;
+                limit < regionRulesLength &&
+                    uprv_memcmp(regionRules[limit].desired, first.desired, 8) == 0 &&
+                    uprv_memcmp(regionRules[limit].supported, first.supported, 8) == 0;
+                ++limit) {}
+        RegionRuleGroup &group = fRegionRuleGroups[fRegionRuleGroupsLength];
+        group.desiredLanguage = first.desired[0];
+        group.desiredScript = first.desired[1];
+        group.supportedLanguage = first.supported[0];
+        group.supportedScript = first.supported[1];
+        uint8_t *table = fRegionTables.getAlias() + fRegionRuleGroupsLength * tableSize;
+        group.table = table;
+        ++fRegionRuleGroupsLength;
+        for (int32_t d = 0; d < fPartitionCount; ++d) {
+            for (int32_t s = 0; s < fPartitionCount; ++s) {
+                uint8_t distance = NO_RULE;
+                for (int32_t i = start; i < limit; ++i) {
+                    const Rule &rule = regionRules[i];
+                    if ((matchesRegion(rule.desired[2], d, fVariablesLength) &&
+                                matchesRegion(rule.supported[2], s, fVariablesLength)) ||
+                            (!rule.oneway &&
+                                matchesRegion(rule.desired[2], s, fVariablesLength) &&
+                                matchesRegion(rule.supported[2], d, fVariablesLength))) {
+                        distance = static_cast<uint8_t>(rule.distance);
+                        break;
+                    }
+                }
+                table[d * fPartitionCount + s] = distance;
+            }
+        }
+    }
+}
+
+void LocaleDistance::getMaximizedLSR(const Locale &locale, LSR &lsr, UErrorCode &errorCode) const {
+    char maximized[ULOC_FULLNAME_CAPACITY];
+    uloc_addLikelySubtags(locale.getBaseName(), maximized, UPRV_LENGTHOF(maximized), &errorCode);
+    uloc_getLanguage(maximized, lsr.language, UPRV_LENGTHOF(lsr.language), &errorCode);
+    uloc_getScript(maximized, lsr.script, UPRV_LENGTHOF(lsr.script), &errorCode);
+    uloc_getCountry(maximized, lsr.region, UPRV_LENGTHOF(lsr.region), &errorCode);
+    if (errorCode == U_STRING_NOT_TERMINATED_WARNING) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    lsr.languageKey = getLanguageKey(lsr.language);
+    lsr.scriptKey = getScriptKey(lsr.script);
+    lsr.regionKey = getRegionKey(lsr.region);
+    lsr.regionPartition = lsr.regionKey == 0 ? 0 : uhash_igeti(fRegionPartitions, lsr.regionKey);
+}
+
+int32_t LocaleDistance::getDistance(const LSR &desired, const LSR &supported,
+                                    int32_t threshold) const {
+    int32_t distance = 0;
+    if (!desired.isSameLanguage(supported)) {
+        distance = getLanguageDistance(desired.languageKey, supported.languageKey);
+        if (distance >= threshold) {
+            return distance;
+        }
+    }
+    if (desired.scriptKey != supported.scriptKey) {
+        distance += getScriptDistance(desired, supported);
+        if (distance >= threshold) {
+            return distance;
+        }
+    }
+    if (desired.regionKey != supported.regionKey) {
+        distance += getRegionDistance(desired, supported);
+    }
+    return distance;
+}
+
+const LocaleDistance::LanguageRule *
+LocaleDistance::getLanguageRules(int32_t desiredLanguageKey, int32_t &length) const {
+    int32_t start = uhash_igeti(fLanguageRuleStarts, desiredLanguageKey) - 1;
+    if (start < 0) {
+        length = 0;
+        return NULL;
+    }
+    int32_t limit = start + 1;
+    while (limit < fLanguageRulesLength && fLanguageRules[limit].desired == desiredLanguageKey) {
+        ++limit;
+    }
+    length = limit - start;
+    return fLanguageRules.getAlias() + start;
+}
+
+int32_t LocaleDistance::getLanguageDistance(int32_t desired, int32_t supported) const {
+    int32_t distance = NO_MATCH_DISTANCE;
+    int32_t index = INT32_MAX;
+    int32_t length;
+    const LanguageRule *rules = getLanguageRules(desired, length);
+    for (int32_t i = 0; i < length; ++i) {
+        if (rules[i].supported == supported) {
+            distance = rules[i].distance;
+            index = rules[i].index;
+            break;
+        }
+    }
+    // A wildcard rule wins if it comes first.
+    for (int32_t i = 0; i < fWildcardLanguageRulesLength; ++i) {
+        const SubtagRule &rule = fWildcardLanguageRules[i];
+        if (rule.index > index) {
+            break;
+        }
+        if (matchesSubtag(rule.desiredLanguage, desired) &&
+                matchesSubtag(rule.supportedLanguage, supported)) {
+            return rule.distance;
+        }
+    }
+    return distance;
+}
+
+int32_t LocaleDistance::getScriptDistance(const LSR &desired, const LSR &supported) const {
+    for (int32_t i = 0; i < fScriptRulesLength; ++i) {
+        const SubtagRule &rule = fScriptRules[i];
+        if (matchesSubtag(rule.desiredScript, desired.scriptKey) &&
+                matchesSubtag(rule.supportedScript, supported.scriptKey) &&
+                matchesSubtag(rule.desiredLanguage, desired.languageKey) &&
+                matchesSubtag(rule.supportedLanguage, supported.languageKey)) {
+            return rule.distance;
+        }
+    }
+    return NO_MATCH_DISTANCE;
+}
+
+int32_t LocaleDistance::getRegionDistance(const LSR &desired, const LSR &supported) const {
+    int32_t index = desired.regionPartition * fPartitionCount + supported.regionPartition;
+    for (int32_t i = 0; i < fRegionRuleGroupsLength; ++i) {
+        const RegionRuleGroup &group = fRegionRuleGroups[i];
+        if (matchesSubtag(group.desiredLanguage, desired.languageKey) &&
+                matchesSubtag(group.supportedLanguage, supported.languageKey) &&
+                matchesSubtag(group.desiredScript, desired.scriptKey) &&
+                matchesSubtag(group.supportedScript, supported.scriptKey)) {
+            uint8_t distance = group.table[index];
+            if (distance != NO_RULE) {
+                return distance;
+            }
+        }
+    }
+    return NO_MATCH_DISTANCE;
+}
+
+U_NAMESPACE_END
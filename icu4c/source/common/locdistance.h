@@ -0,0 +1,166 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  locdistance.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Distances between maximized locales, precomputed from the CLDR
+*   languageMatching data, for LocaleMatcher.
+*/
+
+#ifndef LOCDISTANCE_H
+#define LOCDISTANCE_H
+
+#include "unicode/utypes.h"
+#include "unicode/locid.h"
+#include "unicode/uloc.h"
+#include "unicode/uobject.h"
+#include "unicode/ures.h"
+#include "cmemory.h"
+#include "uhash.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Language, script and region subtags of a maximized locale,
+ * with integer keys for fast comparisons and rule lookups.
+ * @internal
+ */
+struct LSR : public UMemory {
+    char language[ULOC_LANG_CAPACITY];
+    char script[ULOC_SCRIPT_CAPACITY];
+    char region[ULOC_COUNTRY_CAPACITY];
+    int32_t languageKey;
+    int32_t scriptKey;
+    int32_t regionKey;
+    /** Which match variables (like $americas) and rule regions contain the region. */
+    int32_t regionPartition;
+
+    UBool isSameLanguage(const LSR &other) const {
+        return languageKey == other.languageKey &&
+            (languageKey != LANGUAGE_KEY_OTHER || uprv_strcmp(language, other.language) == 0);
+    }
+
+    /** Key for language codes that are not 2 or 3 lowercase ASCII letters. */
+    static const int32_t LANGUAGE_KEY_OTHER = 0x8000;
+};
+
+/**
+ * Immutable singleton with the distance rules from the
+ * supplementalData languageMatchingNew/written resource.
+ *
+ * The rules are ordered, and the first one that matches a pair of
+ * desired and supported subtags determines their distance.
+ * Language rules between two literal codes are looked up by desired language,
+ * and each list of region rules for the same language and script patterns
+ * is turned into a table indexed by the region partitions of the two locales.
+ * A region partition is a bit set of the match variables (like $enUS)
+ * that contain the region, plus the index of the region
+ * if it is named literally in a rule (like GB).
+ *
+ * @internal
+ */
+class LocaleDistance : public UMemory {
+public:
+    /** Literal desired-language to supported-language rule. */
+    struct LanguageRule {
+        int32_t desired;
+        int32_t supported;
+        int32_t distance;
+        /** Position in the list of rules, for ordering against wildcard rules. */
+        int32_t index;
+        /** The supported language code. */
+        char language[4];
+    };
+
+    static const LocaleDistance *getSingleton(UErrorCode &errorCode);
+
+    /**
+     * Adds likely subtags to the locale's language, script and region,
+     * and sets the fields of lsr. Variants and keywords are ignored.
+     */
+    void getMaximizedLSR(const Locale &locale, LSR &lsr, UErrorCode &errorCode) const;
+
+    /**
+     * Returns the sum of the language, script and region distances,
+     * or some value >=threshold as soon as the sum reaches the threshold.
+     */
+    int32_t getDistance(const LSR &desired, const LSR &supported, int32_t threshold) const;
+
+    /**
+     * Returns the rules from the desired language to specific other languages,
+     * in rule order. Only these languages, and any that a wildcard rule
+     * (see getMinWildcardLanguageDistance()) applies to,
+     * can be closer than the default language distance.
+     */
+    const LanguageRule *getLanguageRules(int32_t desiredLanguageKey, int32_t &length) const;
+
+    /** The smallest distance of any language rule with a "*" wildcard. */
+    int32_t getMinWildcardLanguageDistance() const { return fMinWildcardLanguageDistance; }
+
+    /** Locales at least this far apart do not match: the distance between different scripts. */
+    int32_t getDefaultThreshold() const { return fDefaultThreshold; }
+
+    /** How much each desired locale is worse than the previous one: the distance from en to en-GB. */
+    int32_t getDefaultDemotionPerDesiredLocale() const { return fDefaultDemotion; }
+
+    static int32_t getLanguageKey(const char *language);
+    static int32_t getScriptKey(const char *script);
+    static int32_t getRegionKey(const char *region);
+
+    /** Used by the one-time initialization of the singleton. */
+    LocaleDistance(UErrorCode &errorCode);
+    ~LocaleDistance();
+
+private:
+    struct Rule;
+    struct SubtagRule;
+    struct RegionRuleGroup;
+
+    LocaleDistance(const LocaleDistance &other);  // not implemented
+    LocaleDistance &operator=(const LocaleDistance &other);  // not implemented
+
+    void load(UErrorCode &errorCode);
+    void loadRegionPartitions(UResourceBundle *supplementalData, UErrorCode &errorCode);
+    int32_t parseRegionPattern(const char *s, UErrorCode &errorCode);
+    void addRules(const Rule *rules, int32_t length, UErrorCode &errorCode);
+
+    int32_t getLanguageDistance(int32_t desired, int32_t supported) const;
+    int32_t getScriptDistance(const LSR &desired, const LSR &supported) const;
+    int32_t getRegionDistance(const LSR &desired, const LSR &supported) const;
+
+    /** desired language key -> 1 + index of its first rule in fLanguageRules */
+    UHashtable *fLanguageRuleStarts;
+    LocalMemory<LanguageRule> fLanguageRules;
+    int32_t fLanguageRulesLength;
+    /** Language rules with at least one wildcard, in rule order. */
+    LocalMemory<SubtagRule> fWildcardLanguageRules;
+    int32_t fWildcardLanguageRulesLength;
+    LocalMemory<SubtagRule> fScriptRules;
+    int32_t fScriptRulesLength;
+    LocalMemory<RegionRuleGroup> fRegionRuleGroups;
+    int32_t fRegionRuleGroupsLength;
+    /** partition tables of all of the groups, fPartitionCount^2 bytes each */
+    LocalMemory<uint8_t> fRegionTables;
+
+    /** region key -> partition, only for regions with a non-zero partition */
+    UHashtable *fRegionPartitions;
+    /** match variable names, for parsing rules; only used while loading */
+    char fVariables[8][16];
+    int32_t fVariablesLength;
+    /** region keys of the regions named in rules; only used while loading */
+    int32_t fLiteralRegions[16];
+    int32_t fLiteralRegionsLength;
+    int32_t fPartitionCount;
+
+    int32_t fMinWildcardLanguageDistance;
+    int32_t fDefaultThreshold;
+    int32_t fDefaultDemotion;
+};
+
+U_NAMESPACE_END
+
+#endif  // LOCDISTANCE_H
@@ -869,6 +869,47 @@ Locale::forLanguageTag(StringPiece tag, UErrorCode& status)
     // parsing. Therefore the code here explicitly calls uloc_forLanguageTag()
     // and then Locale::init(), instead of just calling the normal constructor.
 
+    // Common tags like "en-US" are parsed straight into the fields of the result,
+    // without heap allocation.
+    char lang[ULOC_LANG_CAPACITY];
+    char scrpt[ULOC_SCRIPT_CAPACITY];
+    char region[ULOC_COUNTRY_CAPACITY];
+    if (ulocimp_parseSimpleLanguageTag(tag.data(), tag.length(), lang, scrpt, region)) {
+        if (uprv_strcmp(lang, "und") == 0) {
+            *lang = 0;
+        }
+        char id[ULOC_LANG_CAPACITY + ULOC_SCRIPT_CAPACITY + ULOC_COUNTRY_CAPACITY];
+        int32_t langLength = (int32_t)uprv_strlen(lang);
+        int32_t length = langLength;
+        uprv_memcpy(id, lang, length);
+        if (*scrpt != 0) {
+            id[length++] = SEP_CHAR;
+            uprv_strcpy(id + length, scrpt);
+            length += (int32_t)uprv_strlen(scrpt);
+        }
+        if (*region != 0) {
+            id[length++] = SEP_CHAR;
+            uprv_strcpy(id + length, region);
+            length += (int32_t)uprv_strlen(region);
+        }
+        id[length] = 0;
+        if (langLength == 3) {
+            // uloc_getName() maps some 3-letter language codes to 2-letter ones.
+            result.init(id, /*canonicalize=*/FALSE);
+        } else {
+            // This is what init() would do for this locale ID.
+            result.fIsBogus = FALSE;
+            uprv_strcpy(result.language, lang);
+            uprv_strcpy(result.script, scrpt);
+            uprv_strcpy(result.country, region);
+            uprv_memcpy(result.fullNameBuffer, id, length + 1);
+            result.fullName = result.fullNameBuffer;
+            result.baseName = result.fullName;
+            result.variantBegin = length;
+        }
+        return result;
+    }
+
     CharString localeID;
     int32_t parsedLength;
     {
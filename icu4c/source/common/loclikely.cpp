@@ -28,6 +28,7 @@
 #include "unicode/uscript.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "loccache.h"
 #include "ulocimp.h"
 #include "ustr_imp.h"
 
@@ -1229,12 +1230,49 @@ do_canonicalize(const char*    localeID,
     }
 }
 
-U_CAPI int32_t U_EXPORT2
-uloc_addLikelySubtags(const char*    localeID,
-         char* maximizedLocaleID,
-         int32_t maximizedLocaleIDCapacity,
+typedef int32_t U_CALLCONV
+LikelySubtagsFn(const char* localeID,
+                char* resultLocaleID,
+                int32_t resultLocaleIDCapacity,
+                UErrorCode* err);
+
+/**
+ * Canonicalizes localeID and calls fn, with the results cached by input localeID.
+ * The default locale (localeID==NULL) is not cached because it can change.
+ * Only complete, NUL-terminated results are cached, and a cached result is
+ * only used when it fits with its terminator, so the return value and
+ * error code are the same as without the cache.
+ * The output buffer may be the input buffer:
+ * _uloc_minimizeSubtags() itself calls uloc_addLikelySubtags() in place.
+ */
+static int32_t
+getLikelySubtagsCached(icu::LocaleIDCache::Type type,
+         LikelySubtagsFn* fn,
+         const char*    localeID,
+         char* resultLocaleID,
+         int32_t resultLocaleIDCapacity,
          UErrorCode* err)
 {
+    UBool useCache = localeID != NULL && resultLocaleID != NULL && U_SUCCESS(*err);
+    if (useCache) {
+        int32_t length = icu::LocaleIDCache::get(
+            type, localeID, resultLocaleID, resultLocaleIDCapacity);
+        if (length >= 0) {
+            return u_terminateChars(resultLocaleID, resultLocaleIDCapacity, length, err);
+        }
+    }
+
+    char keyBuffer[ULOC_FULLNAME_CAPACITY];
+    if (useCache) {
+        /* Copy the key in case fn() overwrites it. */
+        int32_t keyLength = (int32_t)uprv_strlen(localeID);
+        if (keyLength < (int32_t)sizeof(keyBuffer)) {
+            uprv_memcpy(keyBuffer, localeID, keyLength + 1);
+        } else {
+            useCache = FALSE;
+        }
+    }
+
     char localeBuffer[ULOC_FULLNAME_CAPACITY];
 
     if (!do_canonicalize(
@@ -1244,13 +1282,27 @@ uloc_addLikelySubtags(const char*    localeID,
         err)) {
         return -1;
     }
-    else {
-        return _uloc_addLikelySubtags(
-                    localeBuffer,
-                    maximizedLocaleID,
-                    maximizedLocaleIDCapacity,
-                    err);
-    }    
+
+    int32_t length = fn(localeBuffer, resultLocaleID, resultLocaleIDCapacity, err);
+    if (useCache && U_SUCCESS(*err) && length < resultLocaleIDCapacity) {
+        icu::LocaleIDCache::put(type, keyBuffer, resultLocaleID, length);
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+uloc_addLikelySubtags(const char*    localeID,
+         char* maximizedLocaleID,
+         int32_t maximizedLocaleIDCapacity,
+         UErrorCode* err)
+{
+    return getLikelySubtagsCached(
+                icu::LocaleIDCache::ADD_LIKELY_SUBTAGS,
+                _uloc_addLikelySubtags,
+                localeID,
+                maximizedLocaleID,
+                maximizedLocaleIDCapacity,
+                err);
 }
 
 U_CAPI int32_t U_EXPORT2
@@ -1259,22 +1311,13 @@ uloc_minimizeSubtags(const char*    localeID,
          int32_t minimizedLocaleIDCapacity,
          UErrorCode* err)
 {
-    char localeBuffer[ULOC_FULLNAME_CAPACITY];
-
-    if (!do_canonicalize(
-        localeID,
-        localeBuffer,
-        sizeof(localeBuffer),
-        err)) {
-        return -1;
-    }
-    else {
-        return _uloc_minimizeSubtags(
-                    localeBuffer,
-                    minimizedLocaleID,
-                    minimizedLocaleIDCapacity,
-                    err);
-    }    
+    return getLikelySubtagsCached(
+                icu::LocaleIDCache::MINIMIZE_SUBTAGS,
+                _uloc_minimizeSubtags,
+                localeID,
+                minimizedLocaleID,
+                minimizedLocaleIDCapacity,
+                err);
 }
 
 // Pairs of (language subtag, + or -) for finding out fast if common languages
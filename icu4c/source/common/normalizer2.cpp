@@ -21,16 +21,23 @@
 #if !UCONFIG_NO_NORMALIZATION
 
 #include "unicode/edits.h"
+#include "unicode/localpointer.h"
 #include "unicode/normalizer2.h"
 #include "unicode/stringoptions.h"
 #include "unicode/unistr.h"
 #include "unicode/unorm.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "bytesinkutil.h"
+#include "charstr.h"
+#include "cpputils.h"
 #include "cstring.h"
 #include "mutex.h"
 #include "norm2allmodes.h"
 #include "normalizer2impl.h"
 #include "uassert.h"
 #include "ucln_cmn.h"
+#include "uparallel.h"
 
 using icu::Normalizer2Impl;
 
@@ -80,6 +87,187 @@ Normalizer2::isNormalizedUTF8(StringPiece s, UErrorCode &errorCode) const {
     return U_SUCCESS(errorCode) && isNormalized(UnicodeString::fromUTF8(s), errorCode);
 }
 
+namespace {
+
+/** Minimum number of code units per thread for normalizeInParallel(). */
+const int32_t MIN_NORMALIZE_UNITS_PER_THREAD = 0x10000;
+
+/** One part of a string that is normalized on another thread. */
+template<typename StringType>
+struct NormalizePart : public UMemory {
+    NormalizePart() : start(0), limit(0), errorCode(U_ZERO_ERROR) {}
+
+    int32_t start, limit;
+    StringType result;
+    UErrorCode errorCode;
+};
+
+/**
+ * Returns the first offset at or after start where the string can be split
+ * into parts that are normalized independently, or length if there is none.
+ */
+int32_t nextSplit(const Normalizer2 &norm2, const UChar *s, int32_t start, int32_t length) {
+    int32_t i = start;
+    if (0 < i && i < length && U16_IS_TRAIL(s[i]) && U16_IS_LEAD(s[i - 1])) {
+        ++i;
+    }
+    while (i < length) {
+        int32_t prev = i;
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        if (norm2.hasBoundaryBefore(c)) {
+            return prev;
+        }
+    }
+    return length;
+}
+
+/** UTF-8 version of nextSplit(). An ill-formed sequence is inert like U+FFFD. */
+int32_t nextSplitUTF8(const Normalizer2 &norm2, const uint8_t *s, int32_t start, int32_t length) {
+    int32_t i = start;
+    while (i < length && U8_IS_TRAIL(s[i])) {
+        ++i;
+    }
+    while (i < length) {
+        int32_t prev = i;
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if (c < 0 || norm2.hasBoundaryBefore(c)) {
+            return prev;
+        }
+    }
+    return length;
+}
+
+/**
+ * Sets parts[i].start and .limit for numParts - 1 parts after the first one,
+ * and returns the limit of the first part.
+ * Parts may be empty if there are few boundaries.
+ */
+template<typename StringType, typename CharType>
+int32_t splitForThreads(const Normalizer2 &norm2, const CharType *s, int32_t length,
+                        NormalizePart<StringType> parts[], int32_t numParts,
+                        int32_t (*split)(const Normalizer2 &, const CharType *, int32_t, int32_t)) {
+    int32_t firstLimit = 0;
+    int32_t prevLimit = 0;
+    for (int32_t i = 1; i < numParts; ++i) {
+        int32_t start = (int32_t)(((int64_t)length * i) / numParts);
+        if (start < prevLimit) {
+            start = prevLimit;
+        }
+        start = split(norm2, s, start, length);
+        if (i == 1) {
+            firstLimit = start;
+        } else {
+            parts[i - 2].limit = start;
+        }
+        parts[i - 1].start = start;
+        prevLimit = start;
+    }
+    parts[numParts - 2].limit = length;
+    return firstLimit;
+}
+
+}  // namespace
+
+UnicodeString &
+Normalizer2::normalizeInParallel(const UnicodeString &src,
+                                 UnicodeString &dest,
+                                 int32_t numThreads,
+                                 UErrorCode &errorCode) const {
+    uprv_checkCanGetBuffer(src, errorCode);
+    if (U_FAILURE(errorCode)) {
+        dest.setToBogus();
+        return dest;
+    }
+    if (&dest == &src) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return dest;
+    }
+    int32_t length = src.length();
+    if (numThreads > length / MIN_NORMALIZE_UNITS_PER_THREAD) {
+        numThreads = length / MIN_NORMALIZE_UNITS_PER_THREAD;
+    }
+    LocalArray<NormalizePart<UnicodeString>> parts;
+    if (numThreads > 1) {
+        parts.adoptInstead(new NormalizePart<UnicodeString>[numThreads - 1]);
+    }
+    if (parts.isNull()) {
+        // Short string, or fall back to doing all of the work on this thread.
+        return normalize(src, dest, errorCode);
+    }
+
+    // This thread normalizes the first part directly into dest,
+    // the other threads into their own strings which are then appended.
+    const UChar *s = src.getBuffer();
+    int32_t firstLimit = splitForThreads(*this, s, length, parts.getAlias(), numThreads, nextSplit);
+    parallelFor(numThreads, [&](int32_t i) {
+        if (i == 0) {
+            normalize(UnicodeString(FALSE, s, firstLimit), dest, errorCode);
+        } else {
+            NormalizePart<UnicodeString> &part = parts[i - 1];
+            normalize(UnicodeString(FALSE, s + part.start, part.limit - part.start),
+                      part.result, part.errorCode);
+        }
+    });
+    for (int32_t i = 0; i < numThreads - 1; ++i) {
+        NormalizePart<UnicodeString> &part = parts[i];
+        if (U_FAILURE(part.errorCode) && U_SUCCESS(errorCode)) {
+            errorCode = part.errorCode;
+        }
+        if (U_SUCCESS(errorCode)) {
+            dest.append(part.result);
+        }
+    }
+    return dest;
+}
+
+void
+Normalizer2::normalizeUTF8InParallel(StringPiece src, ByteSink &sink,
+                                     int32_t numThreads, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    int32_t length = src.length();
+    if (numThreads > length / MIN_NORMALIZE_UNITS_PER_THREAD) {
+        numThreads = length / MIN_NORMALIZE_UNITS_PER_THREAD;
+    }
+    LocalArray<NormalizePart<CharString>> parts;
+    if (numThreads > 1) {
+        parts.adoptInstead(new NormalizePart<CharString>[numThreads - 1]);
+    }
+    if (parts.isNull()) {
+        normalizeUTF8(0, src, sink, nullptr, errorCode);
+        return;
+    }
+
+    // This thread normalizes the first part directly into the sink,
+    // the other threads into their own buffers which are then appended.
+    const char *s = src.data();
+    int32_t firstLimit = splitForThreads(*this, reinterpret_cast<const uint8_t *>(s), length,
+                                         parts.getAlias(), numThreads, nextSplitUTF8);
+    parallelFor(numThreads, [&](int32_t i) {
+        if (i == 0) {
+            normalizeUTF8(0, StringPiece(s, firstLimit), sink, nullptr, errorCode);
+        } else {
+            NormalizePart<CharString> &part = parts[i - 1];
+            CharStringByteSink partSink(&part.result);
+            normalizeUTF8(0, StringPiece(s + part.start, part.limit - part.start),
+                          partSink, nullptr, part.errorCode);
+        }
+    });
+    for (int32_t i = 0; i < numThreads - 1; ++i) {
+        NormalizePart<CharString> &part = parts[i];
+        if (U_FAILURE(part.errorCode) && U_SUCCESS(errorCode)) {
+            errorCode = part.errorCode;
+        }
+        if (U_SUCCESS(errorCode)) {
+            sink.Append(part.result.data(), part.result.length());
+        }
+    }
+    sink.Flush();
+}
+
 // Normalizer2 implementation for the old UNORM_NONE.
 class NoopNormalizer2 : public Normalizer2 {
     virtual ~NoopNormalizer2();
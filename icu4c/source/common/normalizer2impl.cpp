@@ -40,6 +40,7 @@
 #include "uassert.h"
 #include "ucptrie_impl.h"
 #include "uset_imp.h"
+#include "usimd.h"
 #include "uvector.h"
 
 U_NAMESPACE_BEGIN
@@ -607,9 +608,10 @@ Normalizer2Impl::decompose(const UChar *src, const UChar *limit,
     for(;;) {
         // count code units below the minimum or with irrelevant data for the quick check
         for(prevSrc=src; src!=limit;) {
-            if( (c=*src)<minNoCP ||
-                isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if((c=*src)<minNoCP) {
+                // skip the whole run of code units below the minimum at once
+                src+=1+usimd_spanUCharsBelow(src+1, (int32_t)(limit-src-1), (UChar)minNoCP);
+            } else if(isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else if(!U16_IS_LEAD(c)) {
                 break;
@@ -1340,9 +1342,10 @@ Normalizer2Impl::compose(const UChar *src, const UChar *limit,
                 }
                 return TRUE;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if((c=*src)<minNoMaybeCP) {
+                // Skip the whole run of code units below the minimum at once.
+                src+=1+usimd_spanUCharsBelow(src+1, (int32_t)(limit-src-1), (UChar)minNoMaybeCP);
+            } else if(isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1601,9 +1604,10 @@ Normalizer2Impl::composeQuickCheck(const UChar *src, const UChar *limit,
             if(src==limit) {
                 return src;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if((c=*src)<minNoMaybeCP) {
+                // Skip the whole run of code units below the minimum at once.
+                src+=1+usimd_spanUCharsBelow(src+1, (int32_t)(limit-src-1), (UChar)minNoMaybeCP);
+            } else if(isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1753,7 +1757,8 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
                 return TRUE;
             }
             if (*src < minNoMaybeLead) {
-                ++src;
+                // Skip the whole run of bytes below the minimum lead byte at once.
+                src += 1 + usimd_spanBytesBelow(src + 1, (int32_t)(limit - src - 1), minNoMaybeLead);
             } else {
                 prevSrc = src;
                 UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
@@ -2165,8 +2170,9 @@ Normalizer2Impl::makeFCD(const UChar *src, const UChar *limit,
         // count code units with lccc==0
         for(prevSrc=src; src!=limit;) {
             if((c=*src)<minLcccCP) {
-                prevFCD16=~c;
-                ++src;
+                // skip the whole run of code units below the minimum at once
+                src+=1+usimd_spanUCharsBelow(src+1, (int32_t)(limit-src-1), minLcccCP);
+                prevFCD16=~(UChar32)*(src-1);
             } else if(!singleLeadMightHaveNonZeroFCD16(c)) {
                 prevFCD16=0;
                 ++src;
@@ -0,0 +1,266 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  normstream.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Normalization of text that arrives in chunks, see normstream.h.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/appendable.h"
+#include "unicode/bytestream.h"
+#include "unicode/normalizer2.h"
+#include "unicode/normstream.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "charstr.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/**
+ * Returns the offset of the last normalization boundary in s,
+ * or -1 if there is none.
+ * The end of s is a boundary if the last character has a boundary after it,
+ * and it is never one if s ends with a lead surrogate.
+ */
+int32_t lastBoundary(const Normalizer2 &norm2, const UChar *s, int32_t length) {
+    int32_t i = length;
+    UChar32 c;
+    if (i > 0) {
+        U16_PREV(s, 0, i, c);
+        if (U16_IS_LEAD(c)) {
+            // Wait for the trail surrogate.
+        } else if (norm2.hasBoundaryAfter(c)) {
+            return length;
+        } else if (norm2.hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    while (i > 0) {
+        U16_PREV(s, 0, i, c);
+        if (norm2.hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/** Returns the offset of the first normalization boundary in s, or length if there is none. */
+int32_t firstBoundary(const Normalizer2 &norm2, const UChar *s, int32_t length) {
+    int32_t i = 0;
+    while (i < length) {
+        int32_t start = i;
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        if (norm2.hasBoundaryBefore(c)) {
+            return start;
+        }
+    }
+    return length;
+}
+
+/**
+ * UTF-8 version of lastBoundary().
+ * An incomplete byte sequence at the end of s is held back,
+ * and an ill-formed sequence is inert like U+FFFD.
+ */
+int32_t lastBoundaryUTF8(const Normalizer2 &norm2, const uint8_t *s, int32_t length) {
+    int32_t i = length;
+    U8_TRUNCATE_IF_INCOMPLETE(s, 0, i);
+    UChar32 c;
+    if (i == length && i > 0) {
+        U8_PREV(s, 0, i, c);
+        if (c < 0 || norm2.hasBoundaryAfter(c)) {
+            return length;
+        } else if (norm2.hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    while (i > 0) {
+        U8_PREV(s, 0, i, c);
+        if (c < 0 || norm2.hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/** UTF-8 version of firstBoundary(). */
+int32_t firstBoundaryUTF8(const Normalizer2 &norm2, const uint8_t *s, int32_t length) {
+    int32_t i = 0;
+    while (i < length) {
+        int32_t start = i;
+        UChar32 c;
+        U8_NEXT(s, i, length, c);
+        if (c < 0 || norm2.hasBoundaryBefore(c)) {
+            return start;
+        }
+    }
+    return length;
+}
+
+UBool endsWithIncompleteUTF8(const CharString &s) {
+    int32_t length = s.length();
+    U8_TRUNCATE_IF_INCOMPLETE(reinterpret_cast<const uint8_t *>(s.data()), 0, length);
+    return length < s.length();
+}
+
+}  // namespace
+
+StreamingNormalizer::StreamingNormalizer(const Normalizer2 &n2) :
+        norm2(n2), pending8(nullptr) {}
+
+StreamingNormalizer::~StreamingNormalizer() {
+    delete pending8;
+}
+
+void
+StreamingNormalizer::normalize(const UnicodeString &chunk, Appendable &dest, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (chunk.isBogus()) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    normalize(chunk.getBuffer(), chunk.length(), dest, errorCode);
+}
+
+void
+StreamingNormalizer::normalize(ConstChar16Ptr s, int32_t length, Appendable &dest, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (length < 0 || (s == nullptr && length != 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (pending8 != nullptr && !pending8->isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return;
+    }
+    const UChar *chunk = s;
+    int32_t start = 0;
+    if (start < length && !pending.isEmpty() &&
+            U16_IS_LEAD(pending[pending.length() - 1]) && U16_IS_TRAIL(chunk[0])) {
+        // Complete the surrogate pair that was cut off at the end of the previous chunk.
+        pending.append(chunk[start++]);
+    }
+    int32_t limit = lastBoundary(norm2, chunk + start, length - start);
+    if (limit < 0) {
+        pending.append(chunk + start, length - start);
+        return;
+    }
+    limit += start;
+    if (!pending.isEmpty()) {
+        // The held-back text continues up to the first boundary in this chunk.
+        int32_t boundary = start + firstBoundary(norm2, chunk + start, limit - start);
+        pending.append(chunk + start, boundary - start);
+        flush(pending.getBuffer(), pending.length(), dest, errorCode);
+        start = boundary;
+    }
+    if (start < limit) {
+        flush(chunk + start, limit - start, dest, errorCode);
+    }
+    pending.setTo(chunk + limit, length - limit);
+}
+
+void
+StreamingNormalizer::finish(Appendable &dest, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (!pending.isEmpty()) {
+        flush(pending.getBuffer(), pending.length(), dest, errorCode);
+        pending.remove();
+    }
+}
+
+void
+StreamingNormalizer::flush(const UChar *s, int32_t length, Appendable &dest, UErrorCode &errorCode) {
+    // Read-only alias, normalized into the reused buffer.
+    norm2.normalize(UnicodeString(FALSE, s, length), buffer, errorCode);
+    if (U_SUCCESS(errorCode)) {
+        dest.appendString(buffer.getBuffer(), buffer.length());
+    }
+}
+
+void
+StreamingNormalizer::normalizeUTF8(StringPiece chunk, ByteSink &sink, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (!pending.isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return;
+    }
+    if (pending8 == nullptr) {
+        pending8 = new CharString();
+        if (pending8 == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    const char *s = chunk.data();
+    const uint8_t *s8 = reinterpret_cast<const uint8_t *>(s);
+    int32_t length = chunk.length();
+    int32_t start = 0;
+    // Complete the byte sequence that was cut off at the end of the previous chunk.
+    while (start < length && U8_IS_TRAIL(s8[start]) && endsWithIncompleteUTF8(*pending8)) {
+        pending8->append(s[start++], errorCode);
+    }
+    int32_t limit = lastBoundaryUTF8(norm2, s8 + start, length - start);
+    if (limit < 0) {
+        pending8->append(s + start, length - start, errorCode);
+        return;
+    }
+    limit += start;
+    if (!pending8->isEmpty()) {
+        int32_t boundary = start + firstBoundaryUTF8(norm2, s8 + start, limit - start);
+        pending8->append(s + start, boundary - start, errorCode);
+        norm2.normalizeUTF8(0, pending8->toStringPiece(), sink, nullptr, errorCode);
+        start = boundary;
+    }
+    if (start < limit) {
+        norm2.normalizeUTF8(0, StringPiece(s + start, limit - start), sink, nullptr, errorCode);
+    }
+    pending8->clear().append(s + limit, length - limit, errorCode);
+}
+
+void
+StreamingNormalizer::finishUTF8(ByteSink &sink, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (pending8 != nullptr && !pending8->isEmpty()) {
+        norm2.normalizeUTF8(0, pending8->toStringPiece(), sink, nullptr, errorCode);
+        pending8->clear();
+    }
+    sink.Flush();
+}
+
+void
+StreamingNormalizer::reset() {
+    pending.remove();
+    if (pending8 != nullptr) {
+        pending8->clear();
+    }
+}
+
+int32_t
+StreamingNormalizer::getPendingLength() const {
+    return pending.length() + (pending8 != nullptr ? pending8->length() : 0);
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
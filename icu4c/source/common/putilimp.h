@@ -248,6 +248,41 @@ typedef size_t uintptr_t;
 #    define U_HAVE_STD_MUTEX 0
 #endif
 
+/*===========================================================================*/
+/** @{ SIMD instruction sets                                                 */
+/*===========================================================================*/
+
+/**
+ * \def U_HAVE_SSE2
+ * Defines whether the internal string kernels in usimd.h may use SSE2 intrinsics.
+ * SSE2 is part of the x86-64 baseline, so no runtime CPU detection is needed.
+ * Define as 0 to build the portable code paths, for example for benchmarking.
+ * @internal
+ */
+#ifdef U_HAVE_SSE2
+    /* Use the predefined value. */
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define U_HAVE_SSE2 1
+#else
+#   define U_HAVE_SSE2 0
+#endif
+
+/**
+ * \def U_HAVE_NEON
+ * Defines whether the internal string kernels in usimd.h may use AArch64 NEON intrinsics.
+ * Define as 0 to build the portable code paths.
+ * @internal
+ */
+#ifdef U_HAVE_NEON
+    /* Use the predefined value. */
+#elif !U_HAVE_SSE2 && (defined(__aarch64__) || defined(_M_ARM64))
+#   define U_HAVE_NEON 1
+#else
+#   define U_HAVE_NEON 0
+#endif
+
+/** @} */
+
 /*===========================================================================*/
 /** @{ Programs used by ICU code                                             */
 /*===========================================================================*/
@@ -25,6 +25,7 @@
 #include "unicode/uchriter.h"
 #include "unicode/uclean.h"
 #include "unicode/udata.h"
+#include "unicode/utf8.h"
 
 #include "brkeng.h"
 #include "ucln_cmn.h"
@@ -35,6 +36,7 @@
 #include "rbbirb.h"
 #include "uassert.h"
 #include "umutex.h"
+#include "utext_imp.h"
 #include "uvectr32.h"
 
 // if U_LOCAL_SERVICE_HOOK is defined, then localsvc.cpp is expected to be included.
@@ -224,12 +226,32 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
     }
     BreakIterator::operator=(that);
 
-    if (fLanguageBreakEngines != NULL) {
-        delete fLanguageBreakEngines;
-        fLanguageBreakEngines = NULL;   // Just rebuild for now
-    }
-    // TODO: clone fLanguageBreakEngines from "that"
+    delete fLanguageBreakEngines;
+    fLanguageBreakEngines = NULL;
+    delete fUnhandledBreakEngine;
+    fUnhandledBreakEngine = NULL;
     UErrorCode status = U_ZERO_ERROR;
+    if (that.fLanguageBreakEngines != NULL) {
+        // Share the engines that "that" has already looked up. They belong to the
+        // language break factories, so no copying is needed, and a clone of a warmed-up
+        // iterator does not repeat the factory lookups.
+        // The UnhandledEngine belongs to "that"; this iterator makes its own when needed.
+        fLanguageBreakEngines = new UStack(status);
+        if (fLanguageBreakEngines != NULL && U_SUCCESS(status)) {
+            for (int32_t i = 0; i < that.fLanguageBreakEngines->size(); ++i) {
+                void *lbe = that.fLanguageBreakEngines->elementAt(i);
+                if (lbe != that.fUnhandledBreakEngine) {
+                    fLanguageBreakEngines->push(lbe, status);
+                }
+            }
+        }
+        if (U_FAILURE(status)) {
+            // Not fatal; the engines will be looked up again as needed.
+            delete fLanguageBreakEngines;
+            fLanguageBreakEngines = NULL;
+            status = U_ZERO_ERROR;
+        }
+    }
     utext_clone(&fText, &that.fText, FALSE, TRUE, &status);
 
     if (fCharIter != &fSCharIter) {
@@ -259,6 +281,7 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
     fPosition = that.fPosition;
     fRuleStatusIndex = that.fRuleStatusIndex;
     fDone = that.fDone;
+    fDictionaryThreadCount = that.fDictionaryThreadCount;
 
     // TODO: both the dictionary and the main cache need to be copied.
     //       Current position could be within a dictionary range. Trying to continue
@@ -285,6 +308,7 @@ void RuleBasedBreakIterator::init(UErrorCode &status) {
     fRuleStatusIndex      = 0;
     fDone                 = false;
     fDictionaryCharCount  = 0;
+    fDictionaryThreadCount = 1;
     fLanguageBreakEngines = NULL;
     fUnhandledBreakEngine = NULL;
     fBreakCache           = NULL;
@@ -517,6 +541,21 @@ RuleBasedBreakIterator &RuleBasedBreakIterator::refreshInputText(UText *input, U
 }
 
 
+//-------------------------------------------------------------------------------
+//
+//   setDictionaryThreadCount()   The boundaries do not depend on the number of threads,
+//                                so cached dictionary boundaries remain valid.
+//
+//-------------------------------------------------------------------------------
+void RuleBasedBreakIterator::setDictionaryThreadCount(int32_t count) {
+    fDictionaryThreadCount = count > 1 ? count : 1;
+}
+
+int32_t RuleBasedBreakIterator::getDictionaryThreadCount() const {
+    return fDictionaryThreadCount;
+}
+
+
 /**
  * Sets the current iteration position to the beginning of the text, position zero.
  * @return The new iterator position, which is zero.
@@ -578,6 +617,70 @@ int32_t RuleBasedBreakIterator::next(void) {
     return fDone ? UBRK_DONE : fPosition;
 }
 
+/**
+ * Advances the iterator by up to capacity boundaries, writing them to dest.
+ * Boundaries that are already in the break cache are taken from there,
+ * the rest come straight from handleNext() and the dictionary cache.
+ */
+int32_t RuleBasedBreakIterator::nextBoundaries(int32_t *dest, int32_t capacity, int32_t *ruleStatus) {
+    if (dest == NULL || capacity <= 0) {
+        return 0;
+    }
+    int32_t count = 0;
+    while (count < capacity && fBreakCache->hasCachedFollowing()) {
+        fBreakCache->next();
+        dest[count] = fPosition;
+        if (ruleStatus != NULL) {
+            ruleStatus[count] = getRuleStatus();
+        }
+        ++count;
+    }
+    if (count == capacity) {
+        return count;
+    }
+
+    int32_t cachedCount = count;
+    int32_t position = fPosition;
+    int32_t ruleStatusIdx = fRuleStatusIndex;
+    while (count < capacity) {
+        int32_t pos;
+        int32_t statusIdx;
+        if (!fDictionaryCache->following(position, &pos, &statusIdx)) {
+            fPosition = position;
+            pos = handleNext();
+            if (pos == UBRK_DONE) {
+                break;
+            }
+            statusIdx = fRuleStatusIndex;
+            if (fDictionaryCharCount > 0) {
+                // Subdivide the segment, as in BreakCache::populateFollowing().
+                int32_t dictPos, dictStatusIdx;
+                fDictionaryCache->populateDictionary(position, pos, ruleStatusIdx, statusIdx);
+                if (fDictionaryCache->following(position, &dictPos, &dictStatusIdx)) {
+                    pos = dictPos;
+                    statusIdx = dictStatusIdx;
+                }
+            }
+        }
+        position = pos;
+        ruleStatusIdx = statusIdx;
+        dest[count] = pos;
+        if (ruleStatus != NULL) {
+            ruleStatus[count] = fData->fRuleStatusTable[statusIdx + fData->fRuleStatusTable[statusIdx]];
+        }
+        ++count;
+    }
+
+    // Leave the iterator on the last boundary, with a cache that starts there.
+    fPosition = position;
+    fRuleStatusIndex = ruleStatusIdx;
+    if (count > cachedCount) {
+        fBreakCache->reset(position, ruleStatusIdx);
+    }
+    fDone = count == 0;
+    return count;
+}
+
 /**
  * Move the iterator backwards, to the boundary preceding the current one.
  *
@@ -752,18 +855,123 @@ struct LookAheadResults {
 };
 
 
+namespace {
+
+//-----------------------------------------------------------------------------------
+//
+//  Text readers for handleNext().
+//     Each one returns the code points of the text together with their
+//     character categories, and tracks the native index.
+//
+//-----------------------------------------------------------------------------------
+
+/** Reads any text through the UText functions. */
+class UTextBreakReader {
+public:
+    UTextBreakReader(UText *ut, const UTrie2 *trie) : fUT(ut), fTrie(trie) {}
+
+    void setIndex(int32_t index) { UTEXT_SETNATIVEINDEX(fUT, index); }
+    int32_t getIndex() const { return (int32_t)UTEXT_GETNATIVEINDEX(fUT); }
+
+    /** Returns the next code point and sets its category, or returns U_SENTINEL at the end. */
+    UChar32 next(uint16_t &category) {
+        UChar32 c = UTEXT_NEXT32(fUT);
+        if (c >= 0) {
+            category = UTRIE2_GET16(fTrie, c);
+        }
+        return c;
+    }
+
+private:
+    UText *fUT;
+    const UTrie2 *fTrie;
+};
+
+/**
+ * Reads a UTF-8 string directly.
+ * Ill-formed sequences are read as U+FFFD, as in the UTF-8 UText.
+ */
+class UTF8BreakReader {
+public:
+    UTF8BreakReader(const uint8_t *s, int32_t length, const UTrie2 *trie) :
+            fS(s), fIndex(0), fLength(length), fTrie(trie) {}
+
+    void setIndex(int32_t index) {
+        if (index < 0) {
+            index = 0;
+        } else if (index < fLength) {
+            U8_SET_CP_START(fS, 0, index);
+        } else {
+            index = fLength;
+        }
+        fIndex = index;
+    }
+    int32_t getIndex() const { return fIndex; }
+
+    UChar32 next(uint16_t &category) {
+        if (fIndex >= fLength) {
+            return U_SENTINEL;
+        }
+        UChar32 c = fS[fIndex];
+        if (U8_IS_SINGLE(c)) {
+            ++fIndex;
+            category = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(fTrie, c);
+            return c;
+        }
+        return nextMultiByte(category);
+    }
+
+private:
+    UChar32 nextMultiByte(uint16_t &category);
+
+    const uint8_t *fS;
+    int32_t fIndex;
+    int32_t fLength;
+    const UTrie2 *fTrie;
+};
+
+// Out of line: The common case of an ASCII character is handled in next().
+UChar32 UTF8BreakReader::nextMultiByte(uint16_t &category) {
+    UChar32 c;
+    U8_NEXT_OR_FFFD(fS, fIndex, fLength, c);
+    category = UTRIE2_GET16(fTrie, c);
+    return c;
+}
+
+}  // namespace
+
 //-----------------------------------------------------------------------------------
 //
 //  handleNext()
-//     Run the state machine to find a boundary
+//     Run the state machine to find a boundary.
+//     Forward tables with few enough states are stored with 8-bit rows, and
+//     UTF-8 text is read directly rather than through the UText functions;
+//     dispatch to the matching instantiation of the state machine loop.
+//     (UTF-16 text is read through the UText macros, which for a UnicodeString
+//     or UChar * UText already index directly into the string.)
 //
 //-----------------------------------------------------------------------------------
 int32_t RuleBasedBreakIterator::handleNext() {
+    UBool use8Bits = (fData->fForwardTable->fFlags & RBBI_8BITS_ROWS) != 0;
+    int32_t length;
+    const uint8_t *s8 = utext_getUTF8Buffer(&fText, length);
+    if (s8 != NULL) {
+        UTF8BreakReader text(s8, length, fData->fTrie);
+        return use8Bits ? handleNextT<RBBIStateTableRow8>(text) : handleNextT<RBBIStateTableRow16>(text);
+    } else {
+        UTextBreakReader text(&fText, fData->fTrie);
+        return use8Bits ? handleNextT<RBBIStateTableRow8>(text) : handleNextT<RBBIStateTableRow16>(text);
+    }
+}
+
+template <typename RowType, typename TextReader>
+int32_t RuleBasedBreakIterator::handleNextT(TextReader &text) {
     int32_t             state;
     uint16_t            category        = 0;
+    uint16_t            charCategory    = 0;
     RBBIRunMode         mode;
 
-    RBBIStateTableRow  *row;
+    const RowType      *row;
     UChar32             c;
     LookAheadResults    lookAheadMatches;
     int32_t             result             = 0;
@@ -785,9 +993,9 @@ int32_t RuleBasedBreakIterator::handleNext() {
 
     // if we're already at the end of the text, return DONE.
     initialPosition = fPosition;
-    UTEXT_SETNATIVEINDEX(&fText, initialPosition);
+    text.setIndex(initialPosition);
     result          = initialPosition;
-    c               = UTEXT_NEXT32(&fText);
+    c               = text.next(charCategory);
     if (c==U_SENTINEL) {
         fDone = TRUE;
         return UBRK_DONE;
@@ -795,7 +1003,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
 
     //  Set the initial state for the state machine
     state = START_STATE;
-    row = (RBBIStateTableRow *)
+    row = (const RowType *)
             //(statetable->fTableData + (statetable->fRowLen * state));
             (tableData + tableRowLen * state);
 
@@ -829,12 +1037,11 @@ int32_t RuleBasedBreakIterator::handleNext() {
         //      that we shouldn't get a category from an actual text input character.
         //
         if (mode == RBBI_RUN) {
-            // look up the current character's character category, which tells us
+            // The current character's character category, which tells us
             // which column in the state table to look at.
-            // Note:  the 16 in UTRIE_GET16 refers to the size of the data being returned,
-            //        not the size of the character going in, which is a UChar32.
+            // The text reader looked it up together with reading the character.
             //
-            category = UTRIE2_GET16(fData->fTrie, c);
+            category = charCategory;
 
             // Check the dictionary bit in the character's category.
             //    Counter is only used by dictionary based iteration.
@@ -850,7 +1057,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
 
        #ifdef RBBI_DEBUG
             if (gTrace) {
-                RBBIDebugPrintf("             %4" PRId64 "   ", utext_getNativeIndex(&fText));
+                RBBIDebugPrintf("             %4d   ", text.getIndex());
                 if (0x20<=c && c<0x7f) {
                     RBBIDebugPrintf("\"%c\"  ", c);
                 } else {
@@ -866,7 +1073,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         // fNextState is a variable-length array.
         U_ASSERT(category<fData->fHeader->fCatCount);
         state = row->fNextState[category];  /*Not accessing beyond memory*/
-        row = (RBBIStateTableRow *)
+        row = (const RowType *)
             // (statetable->fTableData + (statetable->fRowLen * state));
             (tableData + tableRowLen * state);
 
@@ -874,12 +1081,12 @@ int32_t RuleBasedBreakIterator::handleNext() {
         if (row->fAccepting == -1) {
             // Match found, common case.
             if (mode != RBBI_START) {
-                result = (int32_t)UTEXT_GETNATIVEINDEX(&fText);
+                result = text.getIndex();
             }
             fRuleStatusIndex = row->fTagIdx;   // Remember the break status (tag) values.
         }
 
-        int16_t completedRule = row->fAccepting;
+        int32_t completedRule = row->fAccepting;
         if (completedRule > 0) {
             // Lookahead match is completed.
             int32_t lookaheadResult = lookAheadMatches.getPosition(completedRule);
@@ -889,10 +1096,10 @@ int32_t RuleBasedBreakIterator::handleNext() {
                 return lookaheadResult;
             }
         }
-        int16_t rule = row->fLookAhead;
+        int32_t rule = row->fLookAhead;
         if (rule != 0) {
             // At the position of a '/' in a look-ahead match. Record it.
-            int32_t  pos = (int32_t)UTEXT_GETNATIVEINDEX(&fText);
+            int32_t  pos = text.getIndex();
             lookAheadMatches.setPosition(rule, pos);
         }
 
@@ -908,7 +1115,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         //    the input position.  The next iteration will be processing the
         //    first real input character.
         if (mode == RBBI_RUN) {
-            c = UTEXT_NEXT32(&fText);
+            c = text.next(charCategory);
         } else {
             if (mode == RBBI_START) {
                 mode = RBBI_RUN;
@@ -922,9 +1129,9 @@ int32_t RuleBasedBreakIterator::handleNext() {
     //   (This really indicates a defect in the break rules.  They should always match
     //    at least one character.)
     if (result == initialPosition) {
-        utext_setNativeIndex(&fText, initialPosition);
-        utext_next32(&fText);
-        result = (int32_t)utext_getNativeIndex(&fText);
+        text.setIndex(initialPosition);
+        text.next(charCategory);
+        result = text.getIndex();
         fRuleStatusIndex = 0;
     }
 
@@ -949,9 +1156,18 @@ int32_t RuleBasedBreakIterator::handleNext() {
 //
 //-----------------------------------------------------------------------------------
 int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
+    if (fData->fReverseTable->fFlags & RBBI_8BITS_ROWS) {
+        return handleSafePreviousT<RBBIStateTableRow8>(fromPosition);
+    } else {
+        return handleSafePreviousT<RBBIStateTableRow16>(fromPosition);
+    }
+}
+
+template <typename RowType>
+int32_t RuleBasedBreakIterator::handleSafePreviousT(int32_t fromPosition) {
     int32_t             state;
     uint16_t            category        = 0;
-    RBBIStateTableRow  *row;
+    const RowType      *row;
     UChar32             c;
     int32_t             result          = 0;
 
@@ -971,7 +1187,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
     //  Set the initial state for the state machine
     c = UTEXT_PREVIOUS32(&fText);
     state = START_STATE;
-    row = (RBBIStateTableRow *)
+    row = (const RowType *)
             (stateTable->fTableData + (stateTable->fRowLen * state));
 
     // loop until we reach the start of the text or transition to state 0
@@ -1004,7 +1220,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
         // fNextState is a variable-length array.
         U_ASSERT(category<fData->fHeader->fCatCount);
         state = row->fNextState[category];  /*Not accessing beyond memory*/
-        row = (RBBIStateTableRow *)
+        row = (const RowType *)
             (stateTable->fTableData + (stateTable->fRowLen * state));
 
         if (state == STOP_STATE) {
@@ -98,6 +98,12 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
                 };
 
 
+    /*
+     * True if the cache already holds the boundary following the current one,
+     * so that next() will not need to run the rules.
+     */
+    UBool       hasCachedFollowing() const { return fBufIdx != fEndBufIdx; }
+
     void        nextOL();
     void        previous(UErrorCode &status);
 
@@ -1280,11 +1280,30 @@ int32_t  RBBITableBuilder::getTableSize() const {
     numRows = fDStates->size();
     numCols = fRB->fSetBuilder->getNumCharCategories();
 
-    rowSize = offsetof(RBBIStateTableRow, fNextState) + sizeof(uint16_t)*numCols;
+    if (use8BitsForTable()) {
+        rowSize = offsetof(RBBIStateTableRow8, fNextState) + sizeof(int8_t)*numCols;
+    } else {
+        rowSize = offsetof(RBBIStateTableRow16, fNextState) + sizeof(int16_t)*numCols;
+    }
     size   += numRows * rowSize;
     return size;
 }
 
+bool RBBITableBuilder::use8BitsForTable() const {
+    if (fDStates->size() > 0xff) {
+        return false;
+    }
+    for (int32_t state=0; state<fDStates->size(); state++) {
+        RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(state);
+        if (sd->fAccepting < -1 || sd->fAccepting > 0x7f ||
+                sd->fLookAhead < 0 || sd->fLookAhead > 0x7f ||
+                sd->fTagsIdx < 0 || sd->fTagsIdx > 0x7f) {
+            return false;
+        }
+    }
+    return true;
+}
+
 
 //-----------------------------------------------------------------------------
 //
@@ -1309,7 +1328,12 @@ void RBBITableBuilder::exportTable(void *where) {
         return;
     }
 
-    table->fRowLen    = offsetof(RBBIStateTableRow, fNextState) + sizeof(uint16_t) * catCount;
+    bool use8Bits = use8BitsForTable();
+    if (use8Bits) {
+        table->fRowLen = offsetof(RBBIStateTableRow8, fNextState) + sizeof(uint8_t) * catCount;
+    } else {
+        table->fRowLen = offsetof(RBBIStateTableRow16, fNextState) + sizeof(uint16_t) * catCount;
+    }
     table->fNumStates = fDStates->size();
     table->fFlags     = 0;
     if (fRB->fLookAheadHardBreak) {
@@ -1318,18 +1342,32 @@ void RBBITableBuilder::exportTable(void *where) {
     if (fRB->fSetBuilder->sawBOF()) {
         table->fFlags  |= RBBI_BOF_REQUIRED;
     }
+    if (use8Bits) {
+        table->fFlags  |= RBBI_8BITS_ROWS;
+    }
     table->fReserved  = 0;
 
     for (state=0; state<table->fNumStates; state++) {
         RBBIStateDescriptor *sd = (RBBIStateDescriptor *)fDStates->elementAt(state);
-        RBBIStateTableRow   *row = (RBBIStateTableRow *)(table->fTableData + state*table->fRowLen);
-        U_ASSERT (-32768 < sd->fAccepting && sd->fAccepting <= 32767);
-        U_ASSERT (-32768 < sd->fLookAhead && sd->fLookAhead <= 32767);
-        row->fAccepting = (int16_t)sd->fAccepting;
-        row->fLookAhead = (int16_t)sd->fLookAhead;
-        row->fTagIdx    = (int16_t)sd->fTagsIdx;
-        for (col=0; col<catCount; col++) {
-            row->fNextState[col] = (uint16_t)sd->fDtran->elementAti(col);
+        if (use8Bits) {
+            RBBIStateTableRow8 *row = (RBBIStateTableRow8 *)(table->fTableData + state*table->fRowLen);
+            row->fAccepting = (int8_t)sd->fAccepting;
+            row->fLookAhead = (int8_t)sd->fLookAhead;
+            row->fTagIdx    = (int8_t)sd->fTagsIdx;
+            row->fReserved  = 0;
+            for (col=0; col<catCount; col++) {
+                row->fNextState[col] = (uint8_t)sd->fDtran->elementAti(col);
+            }
+        } else {
+            RBBIStateTableRow16 *row = (RBBIStateTableRow16 *)(table->fTableData + state*table->fRowLen);
+            U_ASSERT (-32768 < sd->fAccepting && sd->fAccepting <= 32767);
+            U_ASSERT (-32768 < sd->fLookAhead && sd->fLookAhead <= 32767);
+            row->fAccepting = (int16_t)sd->fAccepting;
+            row->fLookAhead = (int16_t)sd->fLookAhead;
+            row->fTagIdx    = (int16_t)sd->fTagsIdx;
+            for (col=0; col<catCount; col++) {
+                row->fNextState[col] = (uint16_t)sd->fDtran->elementAti(col);
+            }
         }
     }
 }
@@ -1465,11 +1503,19 @@ int32_t  RBBITableBuilder::getSafeTableSize() const {
     numRows = fSafeTable->size();
     numCols = fRB->fSetBuilder->getNumCharCategories();
 
-    rowSize = offsetof(RBBIStateTableRow, fNextState) + sizeof(uint16_t)*numCols;
+    if (use8BitsForSafeTable()) {
+        rowSize = offsetof(RBBIStateTableRow8, fNextState) + sizeof(int8_t)*numCols;
+    } else {
+        rowSize = offsetof(RBBIStateTableRow16, fNextState) + sizeof(int16_t)*numCols;
+    }
     size   += numRows * rowSize;
     return size;
 }
 
+bool RBBITableBuilder::use8BitsForSafeTable() const {
+    return fSafeTable->size() <= 0xff;
+}
+
 
 //-----------------------------------------------------------------------------
 //
@@ -1494,20 +1540,36 @@ void RBBITableBuilder::exportSafeTable(void *where) {
         return;
     }
 
-    table->fRowLen    = offsetof(RBBIStateTableRow, fNextState) + sizeof(uint16_t) * catCount;
+    bool use8Bits = use8BitsForSafeTable();
+    if (use8Bits) {
+        table->fRowLen = offsetof(RBBIStateTableRow8, fNextState) + sizeof(uint8_t) * catCount;
+    } else {
+        table->fRowLen = offsetof(RBBIStateTableRow16, fNextState) + sizeof(uint16_t) * catCount;
+    }
     table->fNumStates = fSafeTable->size();
-    table->fFlags     = 0;
+    table->fFlags     = use8Bits ? RBBI_8BITS_ROWS : 0;
     table->fReserved  = 0;
 
     for (state=0; state<table->fNumStates; state++) {
         UnicodeString *rowString = (UnicodeString *)fSafeTable->elementAt(state);
-        RBBIStateTableRow   *row = (RBBIStateTableRow *)(table->fTableData + state*table->fRowLen);
-        row->fAccepting = 0;
-        row->fLookAhead = 0;
-        row->fTagIdx    = 0;
-        row->fReserved  = 0;
-        for (col=0; col<catCount; col++) {
-            row->fNextState[col] = rowString->charAt(col);
+        if (use8Bits) {
+            RBBIStateTableRow8 *row = (RBBIStateTableRow8 *)(table->fTableData + state*table->fRowLen);
+            row->fAccepting = 0;
+            row->fLookAhead = 0;
+            row->fTagIdx    = 0;
+            row->fReserved  = 0;
+            for (col=0; col<catCount; col++) {
+                row->fNextState[col] = (uint8_t)rowString->charAt(col);
+            }
+        } else {
+            RBBIStateTableRow16 *row = (RBBIStateTableRow16 *)(table->fTableData + state*table->fRowLen);
+            row->fAccepting = 0;
+            row->fLookAhead = 0;
+            row->fTagIdx    = 0;
+            row->fReserved  = 0;
+            for (col=0; col<catCount; col++) {
+                row->fNextState[col] = rowString->charAt(col);
+            }
         }
     }
 }
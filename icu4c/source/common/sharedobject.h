@@ -165,9 +165,10 @@ class U_COMMON_API SharedObject : public UObject {
      * The number of references from the UnifiedCache, which is
      * the number of times that the sharedObject is stored as a hash table value.
      * For use by UnifiedCache implementation code only.
-     * All access is synchronized by UnifiedCache's gCacheMutex
+     * Atomic because hash table values in different cache shards may refer
+     * to the same object.
      */
-    mutable int32_t softRefCount;
+    mutable u_atomic_int32_t softRefCount;
     friend class UnifiedCache;
 
     /**
@@ -573,6 +573,32 @@ const int8_t TO_UPPER_TR[LIMIT] = {
     0, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1, EXC
 };
 
+// Ranges as starts and (end-start) deltas, see usimd.h.
+// Keep in sync with the tables above.
+const USimdRanges LOWER_UNCHANGED = {
+    5, 0x100,
+    { 0, 0x5b, 0xb6, 0xd7, 0xe0 },  // 00..40, 5B..B4, B6..BF, D7, E0..FF
+    { 0x40, 0xb4 - 0x5b, 0xbf - 0xb6, 0, 0xff - 0xe0 }
+};
+
+const USimdRanges LOWER_UNCHANGED_ASCII = {
+    2, 0x80,
+    { 0, 0x5b },  // 00..40, 5B..7F
+    { 0x40, 0x7f - 0x5b }
+};
+
+const USimdRanges UPPER_UNCHANGED = {
+    4, 0x100,
+    { 0, 0x7b, 0xb6, 0xf7 },  // 00..60, 7B..B4, B6..DE, F7
+    { 0x60, 0xb4 - 0x7b, 0xde - 0xb6, 0 }
+};
+
+const USimdRanges UPPER_UNCHANGED_ASCII = {
+    2, 0x80,
+    { 0, 0x7b },  // 00..60, 7B..7F
+    { 0x60, 0x7f - 0x7b }
+};
+
 }  // namespace LatinCase
 
 U_NAMESPACE_END
@@ -26,6 +26,7 @@
 #include "putilimp.h"
 #include "uset_imp.h"
 #include "udataswp.h"
+#include "usimd.h"
 #include "utrie2.h"
 
 #ifdef __cplusplus
@@ -174,6 +175,19 @@ extern const int8_t TO_UPPER_NORMAL[LIMIT];
 /** Deltas for uppercasing for tr/az. */
 extern const int8_t TO_UPPER_TR[LIMIT];
 
+/**
+ * Latin-1 characters with delta 0 in the TO_LOWER tables,
+ * for skipping runs of text that lowercasing and case folding leave unchanged.
+ * The same for all of those tables.
+ */
+extern const USimdRanges LOWER_UNCHANGED;
+/** The ASCII part of LOWER_UNCHANGED, for single bytes. */
+extern const USimdRanges LOWER_UNCHANGED_ASCII;
+/** Latin-1 characters with delta 0 in the TO_UPPER tables. */
+extern const USimdRanges UPPER_UNCHANGED;
+/** The ASCII part of UPPER_UNCHANGED, for single bytes. */
+extern const USimdRanges UPPER_UNCHANGED_ASCII;
+
 }  // namespace LatinCase
 
 U_NAMESPACE_END
@@ -41,6 +41,7 @@
 #include "uassert.h"
 #include "ucase.h"
 #include "ucasemap_imp.h"
+#include "usimd.h"
 #include "ustr_imp.h"
 
 U_NAMESPACE_USE
@@ -165,6 +166,21 @@ appendResult(int32_t cpLength, int32_t result, const UChar *s,
 inline uint8_t getTwoByteLead(UChar32 c) { return (uint8_t)((c >> 6) | 0xc0); }
 inline uint8_t getTwoByteTrail(UChar32 c) { return (uint8_t)((c & 0x3f) | 0x80); }
 
+/**
+ * Returns the length of the initial run of whole vectors of ASCII characters
+ * in the ascii ranges and two-byte Latin-1 characters in the latin1 ranges.
+ */
+inline int32_t spanLatin1Vectors(const uint8_t *s, int32_t length,
+                                 const USimdRanges *ascii, const USimdRanges *latin1) {
+    int32_t i = 0, n;
+    do {
+        n = usimd_spanBytesInRanges(s + i, length - i, ascii, TRUE);
+        n += usimd_spanUTF8TwoBytesInRanges(s + i + n, length - i - n, latin1, TRUE);
+        i += n;
+    } while (n != 0);
+    return i;
+}
+
 UChar32 U_CALLCONV
 utf8_caseContextIterator(void *context, int8_t dir) {
     UCaseContext *csc=(UCaseContext *)context;
@@ -215,7 +231,10 @@ void toLower(int32_t caseLocale, uint32_t options,
     }
     const UTrie2 *trie = ucase_getTrie();
     int32_t prev = srcStart;
-    int32_t srcIndex = srcStart;
+    // Many strings are all or mostly ASCII/Latin-1 that does not change.
+    int32_t srcIndex = srcStart + spanLatin1Vectors(src + srcStart, srcLimit - srcStart,
+                                                    &LatinCase::LOWER_UNCHANGED_ASCII,
+                                                    &LatinCase::LOWER_UNCHANGED);
     for (;;) {
         // fast path for simple cases
         int32_t cpStart;
@@ -233,7 +252,14 @@ void toLower(int32_t caseLocale, uint32_t options,
                     c = lead;
                     break;
                 }
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    if (((srcIndex - prev) & 0xf) == 0) {
+                        // Long run of unchanged text: Skip whole vectors of it.
+                        srcIndex += usimd_spanBytesInRanges(src + srcIndex, srcLimit - srcIndex,
+                                                            &LatinCase::LOWER_UNCHANGED_ASCII, TRUE);
+                    }
+                    continue;
+                }
                 ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 1 - prev,
                                               sink, options, edits, errorCode);
                 char ascii = (char)(lead + d);
@@ -255,7 +281,13 @@ void toLower(int32_t caseLocale, uint32_t options,
                         cpStart = srcIndex - 2;
                         break;
                     }
-                    if (d == 0) { continue; }
+                    if (d == 0) {
+                        if (((srcIndex - prev) & 0xe) == 0) {  // two bytes at a time
+                            srcIndex += usimd_spanUTF8TwoBytesInRanges(
+                                src + srcIndex, srcLimit - srcIndex, &LatinCase::LOWER_UNCHANGED, TRUE);
+                        }
+                        continue;
+                    }
                     ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 2 - prev,
                                                   sink, options, edits, errorCode);
                     ByteSinkUtil::appendTwoBytes(c + d, sink);
@@ -323,7 +355,10 @@ void toUpper(int32_t caseLocale, uint32_t options,
     }
     const UTrie2 *trie = ucase_getTrie();
     int32_t prev = 0;
-    int32_t srcIndex = 0;
+    // Many strings are all or mostly ASCII/Latin-1 that does not change.
+    int32_t srcIndex = spanLatin1Vectors(src, srcLength,
+                                         &LatinCase::UPPER_UNCHANGED_ASCII,
+                                         &LatinCase::UPPER_UNCHANGED);
     for (;;) {
         // fast path for simple cases
         int32_t cpStart;
@@ -341,7 +376,14 @@ void toUpper(int32_t caseLocale, uint32_t options,
                     c = lead;
                     break;
                 }
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    if (((srcIndex - prev) & 0xf) == 0) {
+                        // Long run of unchanged text: Skip whole vectors of it.
+                        srcIndex += usimd_spanBytesInRanges(src + srcIndex, srcLength - srcIndex,
+                                                            &LatinCase::UPPER_UNCHANGED_ASCII, TRUE);
+                    }
+                    continue;
+                }
                 ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 1 - prev,
                                               sink, options, edits, errorCode);
                 char ascii = (char)(lead + d);
@@ -363,7 +405,13 @@ void toUpper(int32_t caseLocale, uint32_t options,
                         cpStart = srcIndex - 2;
                         break;
                     }
-                    if (d == 0) { continue; }
+                    if (d == 0) {
+                        if (((srcIndex - prev) & 0xe) == 0) {  // two bytes at a time
+                            srcIndex += usimd_spanUTF8TwoBytesInRanges(
+                                src + srcIndex, srcLength - srcIndex, &LatinCase::UPPER_UNCHANGED, TRUE);
+                        }
+                        continue;
+                    }
                     ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 2 - prev,
                                                   sink, options, edits, errorCode);
                     ByteSinkUtil::appendTwoBytes(c + d, sink);
@@ -60,6 +60,53 @@ u_caseInsensitivePrefixMatch(const UChar *s1, int32_t length1,
                              int32_t *matchLen1, int32_t *matchLen2,
                              UErrorCode *pErrorCode);
 
+/**
+ * Internal API, like u_strcmpFold() but for UTF-8 strings.
+ * Case-folds one code point at a time as needed, without allocating memory.
+ * Compares in code point order, as with U_COMPARE_CODE_POINT_ORDER.
+ * Ill-formed sequences compare like U+FFFD.
+ * @param s1            input string 1
+ * @param length1       length of string 1, or -1 (NUL terminated)
+ * @param s2            input string 2
+ * @param length2       length of string 2, or -1 (NUL terminated)
+ * @param options       case folding options, see u_strCaseCompare()
+ * @param pErrorCode    receives error status
+ * @return <0 or 0 or >0 as usual for string comparisons
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+u_strcmpFoldUTF8(const char *s1, int32_t length1,
+                 const char *s2, int32_t length2,
+                 uint32_t options,
+                 UErrorCode *pErrorCode);
+
+/**
+ * Internal API, hash code for case-insensitive keys.
+ * Returns the same value as ustr_hashUCharsN() on the full case folding of the string
+ * would return if it did not sample long strings,
+ * without allocating memory or storing the folded string.
+ * Strings that u_strCaseCompare() considers equal (with the same options)
+ * have equal hash codes.
+ * @param s             input string
+ * @param length        length of the string (>=0)
+ * @param options       case folding options, see u_strCaseCompare()
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+ustr_hashFoldUCharsN(const UChar *s, int32_t length, uint32_t options);
+
+/**
+ * Internal API, like ustr_hashFoldUCharsN() but for UTF-8 strings.
+ * Returns the same value as ustr_hashFoldUCharsN() on the UTF-16 version of the string,
+ * with ill-formed sequences converted to U+FFFD.
+ * @param s             input string
+ * @param length        length of the string (>=0)
+ * @param options       case folding options, see u_strCaseCompare()
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+ustr_hashFoldUTF8N(const char *s, int32_t length, uint32_t options);
+
 #ifdef __cplusplus
 
 U_NAMESPACE_BEGIN
@@ -39,6 +39,8 @@ typedef enum ECleanupCommonType {
     UCLN_COMMON_RBBI,
     UCLN_COMMON_SERVICE,
     UCLN_COMMON_LOCALE_KEY_TYPE,
+    UCLN_COMMON_LOCALE_DISTANCE,
+    UCLN_COMMON_LOCALE_ID_CACHE,
     UCLN_COMMON_LOCALE,
     UCLN_COMMON_LOCALE_AVAILABLE,
     UCLN_COMMON_ULOC,
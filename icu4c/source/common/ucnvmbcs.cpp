@@ -60,6 +60,7 @@
 #include "cstring.h"
 #include "umutex.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 
 /* control optimizations according to the platform */
 #define MBCS_UNROLL_SINGLE_TO_BMP 1
@@ -1998,6 +1999,47 @@ ucnv_MBCSGetName(const UConverter *cnv) {
 U_CDECL_END
 
 
+/* bulk ASCII conversion for ALL_ASCII_ROUNDTRIP() tables ------------------ */
+
+/*
+ * Widen a run of ASCII bytes, up to length of them, and write their offsets.
+ * Only for state 0 of a table with ALL_ASCII_ROUNDTRIP(),
+ * where each of 00..7F is a final VALID_DIRECT_16 entry back to state 0.
+ * Returns the number of bytes converted.
+ */
+static inline int32_t
+toUASCIIRun(const uint8_t *source, int32_t length, UChar *target,
+            int32_t **pOffsets, int32_t sourceIndex) {
+    int32_t count=usimd_widenASCII(source, length, target);
+    if(*pOffsets!=NULL) {
+        int32_t *offsets=*pOffsets;
+        for(int32_t i=0; i<count; ++i) {
+            *offsets++=sourceIndex++;
+        }
+        *pOffsets=offsets;
+    }
+    return count;
+}
+
+/*
+ * Narrow a run of ASCII UChars, up to length of them, and write their offsets.
+ * Only for tables with ALL_ASCII_ROUNDTRIP().
+ * Returns the number of UChars converted.
+ */
+static inline int32_t
+fromUASCIIRun(const UChar *source, int32_t length, uint8_t *target,
+              int32_t **pOffsets, int32_t sourceIndex) {
+    int32_t count=usimd_narrowASCII(source, length, target);
+    if(*pOffsets!=NULL) {
+        int32_t *offsets=*pOffsets;
+        for(int32_t i=0; i<count; ++i) {
+            *offsets++=sourceIndex++;
+        }
+        *pOffsets=offsets;
+    }
+    return count;
+}
+
 /* MBCS-to-Unicode conversion functions ------------------------------------- */
 
 static UChar32 U_CALLCONV
@@ -2196,6 +2238,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     int32_t entry;
     uint8_t action;
+    UBool asciiRuns;
 
     /* set up the local pointers */
     cnv=pArgs->converter;
@@ -2207,8 +2250,10 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+        asciiRuns=FALSE;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
+        asciiRuns=ALL_ASCII_ROUNDTRIP(cnv->sharedData->mbcs.asciiRoundtrips);
     }
 
     /* sourceIndex=-1 if the current character began in the previous buffer */
@@ -2233,6 +2278,12 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
         loops=count=targetCapacity>>4;
         do {
+            if(asciiRuns && usimd_widenASCII(source, 16, target)==16) {
+                /* 16 ASCII bytes, no need to look them up */
+                source+=16;
+                target+=16;
+                continue;
+            }
             oredEntries=entry=stateTable[0][*source++];
             *target++=(UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
             oredEntries|=entry=stateTable[0][*source++];
@@ -2483,6 +2534,7 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
     int32_t entry;
     UChar c;
     uint8_t action;
+    UBool asciiRuns;
 
     /* use optimized function if possible */
     cnv=pArgs->converter;
@@ -2517,8 +2569,10 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+        asciiRuns=FALSE;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
+        asciiRuns=ALL_ASCII_ROUNDTRIP(cnv->sharedData->mbcs.asciiRoundtrips);
     }
     unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
 
@@ -2560,6 +2614,17 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
             /* optimized loop for 1/2-byte input and BMP output */
             if(offsets==NULL) {
                 do {
+                    if(asciiRuns && state==0 && *source<=0x7f) {
+                        /* widen a run of ASCII bytes in bulk */
+                        int32_t length=(int32_t)(sourceLimit-source);
+                        if(length>(targetLimit-target)) {
+                            length=(int32_t)(targetLimit-target);
+                        }
+                        length=usimd_widenASCII(source, length, target);
+                        source+=length;
+                        target+=length;
+                        continue;
+                    }
                     entry=stateTable[state][*source];
                     if(MBCS_ENTRY_IS_TRANSITION(entry)) {
                         state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
@@ -2595,6 +2660,18 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                 } while(source<sourceLimit && target<targetLimit);
             } else /* offsets!=NULL */ {
                 do {
+                    if(asciiRuns && state==0 && *source<=0x7f) {
+                        /* widen a run of ASCII bytes in bulk */
+                        int32_t length=(int32_t)(sourceLimit-source);
+                        if(length>(targetLimit-target)) {
+                            length=(int32_t)(targetLimit-target);
+                        }
+                        length=toUASCIIRun(source, length, target, &offsets, sourceIndex);
+                        source+=length;
+                        target+=length;
+                        sourceIndex=(nextSourceIndex+=length);
+                        continue;
+                    }
                     entry=stateTable[state][*source];
                     if(MBCS_ENTRY_IS_TRANSITION(entry)) {
                         state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
@@ -3481,6 +3558,18 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                if(ALL_ASCII_ROUNDTRIP(asciiRoundtrips) && source<sourceLimit && *source<=0x7f) {
+                    /* narrow a run of ASCII UChars in bulk */
+                    int32_t length=(int32_t)(sourceLimit-source);
+                    if(length>targetCapacity) {
+                        length=targetCapacity;
+                    }
+                    length=fromUASCIIRun(source, length, target, &offsets, sourceIndex);
+                    source+=length;
+                    target+=length;
+                    targetCapacity-=length;
+                    sourceIndex=(nextSourceIndex+=length);
+                }
                 continue;
             }
             /*
@@ -3940,6 +4029,13 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
             *target++=(uint8_t)c;
             --targetCapacity;
             c=0;
+            if(ALL_ASCII_ROUNDTRIP(asciiRoundtrips) && targetCapacity>0 && *source<=0x7f) {
+                /* narrow a run of ASCII UChars in bulk; the offsets are set from lastSource later */
+                length=usimd_narrowASCII(source, targetCapacity, target);
+                source+=length;
+                target+=length;
+                targetCapacity-=length;
+            }
             continue;
         }
         value=MBCS_SINGLE_RESULT_FROM_U(table, results, c);
@@ -4211,6 +4307,21 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                if(ALL_ASCII_ROUNDTRIP(asciiRoundtrips) && source<sourceLimit && *source<=0x7f) {
+                    /* narrow a run of ASCII UChars in bulk */
+                    int32_t length=(int32_t)(sourceLimit-source);
+                    if(length>targetCapacity) {
+                        length=targetCapacity;
+                    }
+                    length=fromUASCIIRun(source, length, target, &offsets, sourceIndex);
+                    if(length>0) {
+                        source+=length;
+                        target+=length;
+                        targetCapacity-=length;
+                        prevSourceIndex=sourceIndex+length-1;
+                        sourceIndex=(nextSourceIndex+=length);
+                    }
+                }
                 continue;
             }
             /*
@@ -295,6 +295,9 @@ enum {
 
 #define IS_ASCII_ROUNDTRIP(b, asciiRoundtrips) (((asciiRoundtrips) & (1<<((b)>>2)))!=0)
 
+/* all of 00..7F round-trip with U+0000..U+007F: runs of ASCII can be copied in bulk */
+#define ALL_ASCII_ROUNDTRIP(asciiRoundtrips) ((asciiRoundtrips)==0xffffffff)
+
 /* single-byte fromUnicode: get the 16-bit result word */
 #define MBCS_SINGLE_RESULT_FROM_U(table, results, c) (results)[ (table)[ (table)[(c)>>10] +(((c)>>4)&0x3f) ] +((c)&0xf) ]
 
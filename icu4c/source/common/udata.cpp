@@ -33,6 +33,7 @@ might have to #include some other header
 #include "cstring.h"
 #include "mutex.h"
 #include "putilimp.h"
+#include "uarrsort.h"
 #include "uassert.h"
 #include "ucln_cmn.h"
 #include "ucmndata.h"
@@ -41,6 +42,10 @@ might have to #include some other header
 #include "umapfile.h"
 #include "umutex.h"
 
+#if U_HAVE_DIRENT_H
+#include <dirent.h>  /* for udata_pinPackage() with a directory */
+#endif
+
 /***********************************************************************
 *
 *   Notes on the organization of the ICU data implementation
@@ -110,6 +115,18 @@ static u_atomic_int32_t gHaveTriedToLoadCommonData = ATOMIC_INT32_T_INITIALIZER(
 static UHashtable  *gCommonDataCache = NULL;  /* Global hash table of opened ICU data files.  */
 static icu::UInitOnce gCommonDataCacheInitOnce = U_INITONCE_INITIALIZER;
 
+/*
+ * Application data packages pinned with udata_pinPackage().
+ * Slots are only appended, under the global mutex, and published by storing the new count,
+ * so that doOpenChoice() can read them without locking.
+ */
+namespace {
+struct PinnedPackage;
+}
+static PinnedPackage *gPinnedPackages[32] = { NULL };
+static u_atomic_int32_t gPinnedPackageCount = ATOMIC_INT32_T_INITIALIZER(0);
+static void deletePinnedPackage(PinnedPackage *pkg);
+
 #if U_PLATFORM_HAS_WINUWP_API == 0 
 static UDataFileAccess  gDataFileAccess = UDATA_DEFAULT_ACCESS;  // Access not synchronized.
                                                                  // Modifying is documented as thread-unsafe.
@@ -134,6 +151,12 @@ udata_cleanup(void)
     }
     gHaveTriedToLoadCommonData = 0;
 
+    for (i = 0; i < gPinnedPackageCount; ++i) {
+        deletePinnedPackage(gPinnedPackages[i]);
+        gPinnedPackages[i] = NULL;
+    }
+    gPinnedPackageCount = 0;
+
     return TRUE;                   /* Everything was cleaned up */
 }
 
@@ -929,6 +952,270 @@ udata_setAppData(const char *path, const void *data, UErrorCode *err)
     udata_cacheDataItem(path, &udm, err);
 }
 
+/*---------------------------------------------------------------------------
+ *
+ *  udata_pinPackage
+ *
+ *---------------------------------------------------------------------------- */
+namespace {
+
+/** One individual data file in a pinned directory. */
+struct PinnedItem {
+    char *name;          /* file name, e.g. "de_AT.res" */
+    UDataMemory memory;  /* owns the mapping */
+};
+
+struct PinnedPackage : public UMemory {
+    PinnedPackage() : items(NULL), itemCount(0) {
+        UDataMemory_init(&common);
+    }
+
+    /* The path by which udata_open() refers to this package:
+     * without a ".dat" extension and without trailing separators. */
+    CharString path;
+    /* A mapped common data (.dat) file; not loaded for a directory. */
+    UDataMemory common;
+    /* The files in a directory, sorted by name. */
+    PinnedItem *items;
+    int32_t itemCount;
+};
+
+int32_t U_CALLCONV
+comparePinnedItems(const void * /*context*/, const void *left, const void *right) {
+    return uprv_strcmp(static_cast<const PinnedItem *>(left)->name,
+                       static_cast<const PinnedItem *>(right)->name);
+}
+
+const PinnedItem *
+findPinnedItem(const PinnedPackage &pkg, const char *name) {
+    int32_t start = 0;
+    int32_t limit = pkg.itemCount;
+    while (start < limit) {
+        int32_t i = (start + limit) / 2;
+        int32_t cmp = uprv_strcmp(name, pkg.items[i].name);
+        if (cmp == 0) {
+            return pkg.items + i;
+        } else if (cmp < 0) {
+            limit = i;
+        } else {
+            start = i + 1;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Maps every ICU data file in the directory.
+ * Subdirectories and other files are ignored.
+ */
+void
+pinDirectory(PinnedPackage &pkg, const char *dirPath, UErrorCode &errorCode) {
+#if U_HAVE_DIRENT_H
+    DIR *dir = opendir(dirPath);
+    if (dir == NULL) {
+        errorCode = U_FILE_ACCESS_ERROR;
+        return;
+    }
+    int32_t capacity = 0;
+    CharString filePath;
+    struct dirent *entry;
+    while (U_SUCCESS(errorCode) && (entry = readdir(dir)) != NULL) {
+        const char *name = entry->d_name;
+        if (name[0] == '.') {
+            continue;  /* ".", "..", and hidden files */
+        }
+        filePath.clear().append(pkg.path, errorCode).
+            append(U_FILE_SEP_CHAR, errorCode).append(name, -1, errorCode);
+        UDataMemory memory;
+        UDataMemory_init(&memory);
+        if (U_FAILURE(errorCode) || !uprv_mapFile(&memory, filePath.data(), &errorCode)) {
+            continue;
+        }
+        const DataHeader *pHeader = memory.pHeader;
+        if (pHeader == NULL || pHeader->dataHeader.magic1 != 0xda ||
+                pHeader->dataHeader.magic2 != 0x27) {
+            udata_close(&memory);  /* not ICU data */
+            continue;
+        }
+        if (pkg.itemCount == capacity) {
+            int32_t newCapacity = capacity == 0 ? 64 : 2 * capacity;
+            PinnedItem *newItems =
+                (PinnedItem *)uprv_realloc(pkg.items, newCapacity * sizeof(PinnedItem));
+            if (newItems == NULL) {
+                udata_close(&memory);
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                break;
+            }
+            pkg.items = newItems;
+            capacity = newCapacity;
+        }
+        PinnedItem &item = pkg.items[pkg.itemCount];
+        int32_t nameLength = (int32_t)uprv_strlen(name);
+        item.name = (char *)uprv_malloc(nameLength + 1);
+        if (item.name == NULL) {
+            udata_close(&memory);
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            break;
+        }
+        uprv_memcpy(item.name, name, nameLength + 1);
+        item.memory = memory;
+        ++pkg.itemCount;
+    }
+    closedir(dir);
+    if (U_SUCCESS(errorCode)) {
+        uprv_sortArray(pkg.items, pkg.itemCount, (int32_t)sizeof(PinnedItem),
+                       comparePinnedItems, NULL, FALSE, &errorCode);
+    }
+#else
+    (void)pkg;
+    (void)dirPath;
+    errorCode = U_UNSUPPORTED_ERROR;
+#endif
+}
+
+/** Returns the pinned package for the udata_open() path, or NULL. */
+const PinnedPackage *
+findPinnedPackage(const char *path) {
+    int32_t count = umtx_loadAcquire(gPinnedPackageCount);
+    if (count == 0 || path == NULL) {
+        return NULL;
+    }
+    int32_t length = (int32_t)uprv_strlen(path);
+    while (length > 0 && path[length - 1] == U_FILE_SEP_CHAR) {
+        --length;
+    }
+    for (int32_t i = 0; i < count; ++i) {
+        const PinnedPackage *pkg = gPinnedPackages[i];
+        if (pkg->path.length() == length && uprv_strncmp(pkg->path.data(), path, length) == 0) {
+            return pkg;
+        }
+    }
+    return NULL;
+}
+
+}  // namespace
+
+static void deletePinnedPackage(PinnedPackage *pkg) {
+    if (pkg == NULL) {
+        return;
+    }
+    udata_close(&pkg->common);  /* unmaps the .dat file */
+    for (int32_t i = 0; i < pkg->itemCount; ++i) {
+        udata_close(&pkg->items[i].memory);
+        uprv_free(pkg->items[i].name);
+    }
+    uprv_free(pkg->items);
+    delete pkg;
+}
+
+U_CAPI void U_EXPORT2
+udata_pinPackage(const char *path, UErrorCode *pErrorCode)
+{
+    if (pErrorCode == NULL || U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if (path == NULL || *path == 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    LocalPointer<PinnedPackage> pkg(new PinnedPackage(), *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    int32_t length = (int32_t)uprv_strlen(path);
+    UBool isCommonData = length > 4 && uprv_strcmp(path + length - 4, ".dat") == 0;
+    if (isCommonData) {
+        length -= 4;
+    }
+    pkg->path.append(path, length, *pErrorCode);
+#if (U_FILE_SEP_CHAR != U_FILE_ALT_SEP_CHAR)
+    char *p;
+    while ((p = uprv_strchr(pkg->path.data(), U_FILE_ALT_SEP_CHAR)) != NULL) {
+        *p = U_FILE_SEP_CHAR;
+    }
+#endif
+    while (pkg->path.length() > 1 && pkg->path[pkg->path.length() - 1] == U_FILE_SEP_CHAR) {
+        pkg->path.truncate(pkg->path.length() - 1);
+    }
+    if (U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if (isCommonData) {
+        if (!uprv_mapFile(&pkg->common, path, pErrorCode)) {
+            if (U_SUCCESS(*pErrorCode)) {
+                *pErrorCode = U_FILE_ACCESS_ERROR;
+            }
+            return;
+        }
+        udata_checkCommonData(&pkg->common, pErrorCode);
+    } else {
+        pinDirectory(*pkg, pkg->path.data(), *pErrorCode);
+    }
+    if (U_FAILURE(*pErrorCode)) {
+        deletePinnedPackage(pkg.orphan());
+        return;
+    }
+
+    ucln_common_registerCleanup(UCLN_COMMON_UDATA, udata_cleanup);
+    Mutex lock;
+    if (findPinnedPackage(pkg->path.data()) != NULL) {
+        deletePinnedPackage(pkg.orphan());
+        *pErrorCode = U_USING_DEFAULT_WARNING;
+        return;
+    }
+    int32_t count = gPinnedPackageCount;
+    if (count == UPRV_LENGTHOF(gPinnedPackages)) {
+        deletePinnedPackage(pkg.orphan());
+        *pErrorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+        return;
+    }
+    gPinnedPackages[count] = pkg.orphan();
+    umtx_storeRelease(gPinnedPackageCount, count + 1);
+}
+
+/*---------------------------------------------------------------------------
+ *
+ *  udata_adviseWillNeed
+ *
+ *---------------------------------------------------------------------------- */
+U_CAPI int32_t U_EXPORT2
+udata_adviseWillNeed(UErrorCode *pErrorCode)
+{
+    if (U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    int32_t advisedLength = 0;
+    for (int32_t i = 0; i < UPRV_LENGTHOF(gCommonICUDataArray); ++i) {
+        const UDataMemory *pData;
+        {
+            Mutex lock;
+            pData = gCommonICUDataArray[i];
+        }
+        if (pData == NULL) {
+            break;
+        }
+        int32_t length = pData->length;  /* known for a mapped .dat file */
+        if (length < 0 && pData->pHeader->info.dataFormat[0] == 0x43) {
+            /*
+             * dataFormat="CmnD" linked into a library: The items follow the ToC
+             * in offset order, so cover everything up to the start of the last item.
+             */
+            const UDataOffsetTOC *toc = (const UDataOffsetTOC *)pData->toc;
+            uint32_t limit = 0;
+            for (uint32_t j = 0; j < toc->count; ++j) {
+                if (limit < toc->entry[j].dataOffset) {
+                    limit = toc->entry[j].dataOffset;
+                }
+            }
+            length = (int32_t)((const char *)pData->toc + limit - (const char *)pData->pHeader);
+        }
+        if (uprv_adviseWillNeed(pData->pHeader, length)) {
+            advisedLength += length;
+        }
+    }
+    return advisedLength;
+}
+
 /*----------------------------------------------------------------------------*
  *                                                                            *
  *  checkDataItem     Given a freshly located/loaded data item, either        *
@@ -1108,6 +1395,38 @@ static UDataMemory *doLoadFromCommonData(UBool isICUData, const char * /*pkgName
     }
 }
 
+/**
+ * Looks up an item in a pinned package, without touching the file system.
+ */
+static UDataMemory *doLoadFromPinnedPackage(const PinnedPackage &pkg,
+        const char *tocEntryPathSuffix, const char *tocEntryName,
+            /* following arguments are the same as doOpenChoice itself */
+            const char *type, const char *name,
+             UDataMemoryIsAcceptable *isAcceptable, void *context,
+             UErrorCode *subErrorCode,
+             UErrorCode *pErrorCode)
+{
+    const DataHeader *pHeader = NULL;
+    int32_t length = -1;
+    if (UDataMemory_isLoaded(&pkg.common)) {
+        pHeader = pkg.common.vFuncs->Lookup(&pkg.common, tocEntryName, &length, subErrorCode);
+    } else {
+        const PinnedItem *item = findPinnedItem(pkg, tocEntryPathSuffix);
+        if (item != NULL) {
+            pHeader = item->memory.pHeader;
+            length = item->memory.length;
+        }
+    }
+    if (pHeader == NULL) {
+        return NULL;
+    }
+    UDataMemory *pEntryData = checkDataItem(pHeader, isAcceptable, context, type, name, subErrorCode, pErrorCode);
+    if (pEntryData != NULL) {
+        pEntryData->length = length;
+    }
+    return pEntryData;
+}
+
 /*
  * Identify the Time Zone resources that are subject to special override data loading.
  */
@@ -1276,6 +1595,19 @@ doOpenChoice(const char *path, const char *type, const char *name,
     fprintf(stderr, " tocEntryPath = %s\n", tocEntryName.data());
 #endif
 
+    /****    PINNED PACKAGES  - all items or none, no other lookups. */
+    if (!isICUData) {
+        const PinnedPackage *pinned = findPinnedPackage(path);
+        if (pinned != NULL) {
+            retVal = doLoadFromPinnedPackage(*pinned, tocEntryPathSuffix, tocEntryName.data(),
+                            type, name, isAcceptable, context, &subErrorCode, pErrorCode);
+            if (retVal == NULL && U_SUCCESS(*pErrorCode)) {
+                *pErrorCode = U_SUCCESS(subErrorCode) ? U_FILE_ACCESS_ERROR : subErrorCode;
+            }
+            return retVal;
+        }
+    }
+
 #if U_PLATFORM_HAS_WINUWP_API == 0 // Windows UWP Platform does not support dll icu data at this time
     if(path == NULL) {
         path = COMMON_DATA_NAME; /* "icudt26e" */
@@ -58,4 +58,17 @@ udata_getLength(const UDataMemory *pData);
 U_CAPI const void * U_EXPORT2
 udata_getRawMemory(const UDataMemory *pData);
 
+/**
+ * Advises the operating system that the loaded common ICU data
+ * (mapped .dat files and linked-in data libraries) will be needed soon,
+ * so that it can read ahead instead of faulting in one page at a time.
+ * Only common data that has already been loaded is covered.
+ *
+ * @return the number of bytes for which the advice was given;
+ *         0 if the platform does not support it
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+udata_adviseWillNeed(UErrorCode *pErrorCode);
+
 #endif
@@ -1018,6 +1018,16 @@ uiter_setUTF8(UCharIterator *iter, const char *s, int32_t length) {
     }
 }
 
+U_CAPI const char * U_EXPORT2
+uiter_getUTF8(const UCharIterator *iter, int32_t *pLength) {
+    if(iter!=0 && iter->move==utf8IteratorMove) {
+        *pLength=iter->limit;
+        return (const char *)iter->context;
+    } else {
+        return NULL;
+    }
+}
+
 /* Helper functions --------------------------------------------------------- */
 
 U_CAPI UChar32 U_EXPORT2
@@ -15,9 +15,11 @@
 #include "unicode/uenum.h"
 #include "unicode/uloc.h"
 #include "ustr_imp.h"
+#include "bytesinkutil.h"
 #include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "loccache.h"
 #include "putilimp.h"
 #include "uinvchar.h"
 #include "ulocimp.h"
@@ -2454,11 +2456,11 @@ uloc_toLanguageTag(const char* localeID,
 }
 
 
-U_CAPI void U_EXPORT2
-ulocimp_toLanguageTag(const char* localeID,
-                      icu::ByteSink& sink,
-                      UBool strict,
-                      UErrorCode* status) {
+static void
+_toLanguageTag(const char* localeID,
+               icu::ByteSink& sink,
+               UBool strict,
+               UErrorCode* status) {
     icu::CharString canonical;
     int32_t reslen;
     UErrorCode tmpStatus = U_ZERO_ERROR;
@@ -2558,6 +2560,36 @@ ulocimp_toLanguageTag(const char* localeID,
     _appendPrivateuseToLanguageTag(canonical.data(), sink, strict, hadPosix, status);
 }
 
+U_CAPI void U_EXPORT2
+ulocimp_toLanguageTag(const char* localeID,
+                      icu::ByteSink& sink,
+                      UBool strict,
+                      UErrorCode* status) {
+    if (U_FAILURE(*status) || uprv_strlen(localeID) >= ULOC_FULLNAME_CAPACITY) {
+        _toLanguageTag(localeID, sink, strict, status);
+        return;
+    }
+
+    icu::LocaleIDCache::Type type = strict ?
+        icu::LocaleIDCache::TO_LANGUAGE_TAG_STRICT : icu::LocaleIDCache::TO_LANGUAGE_TAG;
+    char cached[ULOC_FULLNAME_CAPACITY];
+    int32_t length = icu::LocaleIDCache::get(type, localeID, cached, sizeof(cached));
+    if (length >= 0) {
+        sink.Append(cached, length);
+        return;
+    }
+
+    icu::CharString tag;
+    {
+        icu::CharStringByteSink tagSink(&tag);
+        _toLanguageTag(localeID, tagSink, strict, status);
+    }
+    sink.Append(tag.data(), tag.length());
+    if (U_SUCCESS(*status)) {
+        icu::LocaleIDCache::put(type, localeID, tag.data(), tag.length());
+    }
+}
+
 
 U_CAPI int32_t U_EXPORT2
 uloc_forLanguageTag(const char* langtag,
@@ -2588,6 +2620,95 @@ uloc_forLanguageTag(const char* langtag,
 }
 
 
+static int32_t
+_getSubtagLength(const char* s, const char* limit) {
+    const char* p = s;
+    while (p < limit && *p != SEP) {
+        p++;
+    }
+    return (int32_t)(p - s);
+}
+
+static void
+_copySubtag(char* dest, const char* s, int32_t len, UBool upper) {
+    for (int32_t i = 0; i < len; i++) {
+        dest[i] = upper ? uprv_toupper(s[i]) : uprv_tolower(s[i]);
+    }
+    dest[len] = 0;
+}
+
+U_CAPI UBool U_EXPORT2
+ulocimp_parseSimpleLanguageTag(const char* langtag,
+                               int32_t tagLen,
+                               char* language,
+                               char* script,
+                               char* region) {
+    if (tagLen < 0) {
+        tagLen = (int32_t)uprv_strlen(langtag);
+    }
+    const char* p = langtag;
+    const char* limit = langtag + tagLen;
+
+    /*
+     * The same subtag productions as in ultag_parse(), but no extlang:
+     * A 3-letter second subtag is neither a script nor a region.
+     */
+    int32_t len = _getSubtagLength(p, limit);
+    if (!_isLanguageSubtag(p, len)) {
+        return FALSE;
+    }
+    _copySubtag(language, p, len, FALSE);
+    *script = 0;
+    *region = 0;
+    p += len;
+
+    if (p < limit) {
+        p++;
+        len = _getSubtagLength(p, limit);
+        if (_isScriptSubtag(p, len)) {
+            _copySubtag(script, p, len, FALSE);
+            *script = uprv_toupper(*script);
+            p += len;
+            if (p < limit) {
+                p++;
+                len = _getSubtagLength(p, limit);
+            } else {
+                len = -1;
+            }
+        }
+        if (len >= 0) {
+            if (!_isRegionSubtag(p, len)) {
+                return FALSE;
+            }
+            _copySubtag(region, p, len, TRUE);
+            p += len;
+            if (p < limit) {
+                return FALSE;
+            }
+        }
+    }
+
+    /* Leave the tags that ultag_parse() replaces to ultag_parse(). */
+    char first = uprv_tolower(*langtag);
+    int32_t i;
+    for (i = 0; i < UPRV_LENGTHOF(GRANDFATHERED); i += 2) {
+        if (GRANDFATHERED[i][0] == first &&
+                uprv_strnicmp(GRANDFATHERED[i], langtag, tagLen) == 0 &&
+                GRANDFATHERED[i][tagLen] == 0) {
+            return FALSE;
+        }
+    }
+    for (i = 0; i < UPRV_LENGTHOF(REDUNDANT); i += 2) {
+        int32_t redundantLen = (int32_t)uprv_strlen(REDUNDANT[i]);
+        if (REDUNDANT[i][0] == first && redundantLen <= tagLen &&
+                uprv_strnicmp(REDUNDANT[i], langtag, redundantLen) == 0 &&
+                (redundantLen == tagLen || langtag[redundantLen] == SEP)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
 U_CAPI void U_EXPORT2
 ulocimp_forLanguageTag(const char* langtag,
                        int32_t tagLen,
@@ -2600,6 +2721,33 @@ ulocimp_forLanguageTag(const char* langtag,
     int32_t i, n;
     UBool noRegion = TRUE;
 
+    if (U_SUCCESS(*status)) {
+        /* Common tags like "en-US" without building a ULanguageTag. */
+        char language[ULOC_LANG_CAPACITY];
+        char script[ULOC_SCRIPT_CAPACITY];
+        char region[ULOC_COUNTRY_CAPACITY];
+        if (tagLen < 0) {
+            tagLen = (int32_t)uprv_strlen(langtag);
+        }
+        if (ulocimp_parseSimpleLanguageTag(langtag, tagLen, language, script, region)) {
+            if (uprv_strcmp(language, LANG_UND) != 0) {
+                sink.Append(language, (int32_t)uprv_strlen(language));
+            }
+            if (*script != 0) {
+                sink.Append("_", 1);
+                sink.Append(script, (int32_t)uprv_strlen(script));
+            }
+            if (*region != 0) {
+                sink.Append("_", 1);
+                sink.Append(region, (int32_t)uprv_strlen(region));
+            }
+            if (parsedLength != NULL) {
+                *parsedLength = tagLen;
+            }
+            return;
+        }
+    }
+
     icu::LocalULanguageTagPointer lt(ultag_parse(langtag, tagLen, parsedLength, status));
     if (U_FAILURE(*status)) {
         return;
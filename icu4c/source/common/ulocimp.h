@@ -116,6 +116,32 @@ ulocimp_forLanguageTag(const char* langtag,
                        int32_t* parsedLength,
                        UErrorCode* err);
 
+/**
+ * Parses the most common form of BCP47 language tag, language["-"script]["-"region]
+ * (for example "en-US" or "zh-Hant-TW"), without any heap allocation.
+ * The subtags are normalized to lowercase, titlecase and uppercase respectively.
+ * Returns FALSE for all other tags, including the grandfathered and redundant ones
+ * that are mapped to their preferred values;
+ * those must be handled by ulocimp_forLanguageTag().
+ *
+ * @param langtag   the input BCP47 language tag.
+ * @param tagLen    the length of langtag, or -1 to call uprv_strlen().
+ * @param language  receives the NUL-terminated language subtag;
+ *                  capacity ULOC_LANG_CAPACITY
+ * @param script    receives the NUL-terminated script subtag, or "" if none;
+ *                  capacity ULOC_SCRIPT_CAPACITY
+ * @param region    receives the NUL-terminated region subtag, or "" if none;
+ *                  capacity ULOC_COUNTRY_CAPACITY
+ * @return TRUE if the whole tag was parsed
+ * @internal
+ */
+U_CAPI UBool U_EXPORT2
+ulocimp_parseSimpleLanguageTag(const char* langtag,
+                               int32_t tagLen,
+                               char* language,
+                               char* script,
+                               char* region);
+
 /**
  * Get the region to use for supplemental data lookup. Uses
  * (1) any region specified by locale tag "rg"; if none then
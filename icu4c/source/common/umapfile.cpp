@@ -247,6 +247,7 @@
         pData->map = (char *)data + length;
         pData->pHeader=(const DataHeader *)data;
         pData->mapAddr = data;
+        pData->length = length;
 #if U_PLATFORM == U_PF_IPHONE
         posix_madvise(data, length, POSIX_MADV_RANDOM);
 #endif
@@ -526,3 +527,21 @@
 #else
 #   error MAP_IMPLEMENTATION is set incorrectly
 #endif
+
+U_CFUNC UBool
+uprv_adviseWillNeed(const void *start, int32_t length) {
+#if MAP_IMPLEMENTATION==MAP_POSIX && defined(POSIX_MADV_WILLNEED)
+    long pageSize = sysconf(_SC_PAGESIZE);
+    if (start == NULL || length <= 0 || pageSize <= 0) {
+        return FALSE;
+    }
+    /* posix_madvise() requires a page-aligned start address. */
+    uintptr_t begin = (uintptr_t)start & ~(uintptr_t)(pageSize - 1);
+    uintptr_t limit = (uintptr_t)start + length;
+    return posix_madvise((void *)begin, limit - begin, POSIX_MADV_WILLNEED) == 0;
+#else
+    (void)start;
+    (void)length;
+    return FALSE;
+#endif
+}
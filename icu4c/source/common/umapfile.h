@@ -32,6 +32,14 @@
 U_CFUNC UBool uprv_mapFile(UDataMemory *pdm, const char *path, UErrorCode *status);
 U_CFUNC void  uprv_unmapFile(UDataMemory *pData);
 
+/**
+ * Tells the operating system that the memory range, which may be part of
+ * a mapped file or of a loaded library, will be read soon.
+ * The range need not be page-aligned.
+ * @return TRUE if the advice was given, FALSE if not supported or if it failed
+ */
+U_CFUNC UBool uprv_adviseWillNeed(const void *start, int32_t length);
+
 /* MAP_NONE: no memory mapping, no file access at all */
 #define MAP_NONE        0
 #define MAP_WIN32       1
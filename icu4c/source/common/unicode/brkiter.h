@@ -621,6 +621,7 @@ class U_COMMON_API BreakIterator : public UObject {
 
     friend class ICUBreakIteratorFactory;
     friend class ICUBreakIteratorService;
+    friend class BreakIteratorCacheKey;
 
 protected:
     // Do not enclose protected default/copy constructors with #ifndef U_HIDE_INTERNAL_API
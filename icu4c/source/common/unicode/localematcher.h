@@ -0,0 +1,189 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// localematcher.h
+
+#ifndef __LOCALEMATCHER_H__
+#define __LOCALEMATCHER_H__
+
+#include "unicode/utypes.h"
+#include "unicode/locid.h"
+#include "unicode/stringpiece.h"
+#include "unicode/uobject.h"
+
+/**
+ * \file
+ * \brief C++ API: Locale matcher: User's desired locales vs. application's supported locales.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+U_NAMESPACE_BEGIN
+
+struct LSR;
+class LocaleDistance;
+
+/**
+ * Immutable class that picks the best match between a user's desired locales and
+ * an application's supported locales.
+ *
+ * Example:
+ * <pre>
+ * UErrorCode errorCode = U_ZERO_ERROR;
+ * Locale supported[] = { Locale("fr"), Locale("en-GB"), Locale("en") };
+ * LocaleMatcher matcher(supported, 3, errorCode);
+ * const Locale *bestSupported = matcher.getBestMatch(Locale("en-AU"), errorCode);  // "en-GB"
+ * </pre>
+ *
+ * Locales are compared after adding likely subtags, by the sum of the distances
+ * between their languages, scripts and regions. The distances come from the CLDR
+ * languageMatching data: For example, Norwegian Bokmål is close to Norwegian,
+ * en-AU is closer to en-GB than to en-US, and different scripts usually do not match.
+ * Variants and Unicode extensions are ignored.
+ *
+ * The distance tables are loaded and precomputed once, for all matchers.
+ * The supported locales are indexed by language, so that a query only compares
+ * a desired locale with the supported locales of the same or of related languages.
+ *
+ * If several desired locales are given, then a match for an earlier one is preferred
+ * over a slightly better match for a later one. Among supported locales with
+ * the same distance, the earlier one wins.
+ * If no supported locale is close enough to any desired locale,
+ * then the first supported locale is returned.
+ *
+ * A LocaleMatcher is thread-safe: Its const functions can be called concurrently.
+ *
+ * @draft ICU 64
+ */
+class U_COMMON_API LocaleMatcher : public UMemory {
+public:
+    /**
+     * Constructs a LocaleMatcher for the given supported locales,
+     * in order of the application's preference.
+     * The locales are copied.
+     *
+     * @param supportedLocales array of locales
+     * @param length number of locales; may be 0
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    LocaleMatcher(const Locale *supportedLocales, int32_t length, UErrorCode &errorCode);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    ~LocaleMatcher();
+
+    /**
+     * Returns the supported locale which best matches the desired locale.
+     *
+     * @param desiredLocale Typically a user's language.
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return the best-matching supported locale, or the first supported locale
+     *         if none is close enough; NULL if there are no supported locales
+     *         or if an error occurred
+     * @draft ICU 64
+     */
+    const Locale *getBestMatch(const Locale &desiredLocale, UErrorCode &errorCode) const;
+
+    /**
+     * Returns the supported locale which best matches one of the desired locales.
+     *
+     * @param desiredLocales Typically a user's languages, in order of preference.
+     * @param length number of desired locales
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return the best-matching supported locale, or the first supported locale
+     *         if none is close enough; NULL if there are no supported locales
+     *         or if an error occurred
+     * @draft ICU 64
+     */
+    const Locale *getBestMatch(const Locale *desiredLocales, int32_t length,
+                               UErrorCode &errorCode) const;
+
+    /**
+     * Parses an HTTP Accept-Language header value like "de-CH, de;q=0.9, en;q=0.5"
+     * and returns the supported locale which best matches one of its language tags.
+     * Tags are ordered by their quality values, and tags with equal qualities
+     * keep their order. Items that are not well-formed, the "*" wildcard,
+     * and tags with q=0 are ignored.
+     *
+     * @param desiredLocaleList Typically an Accept-Language header value.
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return the best-matching supported locale, or the first supported locale
+     *         if none is close enough; NULL if there are no supported locales
+     *         or if an error occurred
+     * @draft ICU 64
+     */
+    const Locale *getBestMatchForListString(StringPiece desiredLocaleList,
+                                            UErrorCode &errorCode) const;
+
+    /**
+     * Returns the distance from the desired locale to the supported locale,
+     * as used for matching. 0 means that they are equivalent.
+     * Locales at or beyond getThreshold() do not match.
+     *
+     * @param desired desired locale
+     * @param supported supported locale
+     * @param errorCode ICU error code. Its input value must pass the U_SUCCESS() test,
+     *                  or else the function returns immediately. Check for U_FAILURE()
+     *                  on output or use with function chaining. (See User Guide for details.)
+     * @return the distance
+     * @draft ICU 64
+     */
+    int32_t getDistance(const Locale &desired, const Locale &supported,
+                        UErrorCode &errorCode) const;
+
+    /**
+     * Returns the distance at which a desired locale no longer matches a supported one.
+     * It is the CLDR distance between different scripts.
+     *
+     * @return the threshold distance
+     * @draft ICU 64
+     */
+    int32_t getThreshold() const;
+
+private:
+    LocaleMatcher(const LocaleMatcher &other);  // not implemented
+    LocaleMatcher &operator=(const LocaleMatcher &other);  // not implemented
+
+    int32_t getBestIndex(const LSR &desired, int32_t &bestDistance) const;
+    void matchGroup(const LSR &desired, int32_t group,
+                    int32_t &bestIndex, int32_t &bestDistance) const;
+    const Locale *getBestMatch(const LSR *desired, int32_t length) const;
+    void matchDesired(const LSR &desired, int32_t demotion,
+                      int32_t &bestIndex, int32_t &bestScore) const;
+
+    const LocaleDistance *fDistance;
+    Locale *fSupportedLocales;
+    LSR *fSupportedLSRs;
+    int32_t fSupportedLength;
+    /** Supported locale indexes, grouped by language, in supported order within each group. */
+    int32_t *fGroupIndexes;
+    /** fGroupStarts[g]..fGroupStarts[g + 1] are the fGroupIndexes of group g. */
+    int32_t *fGroupStarts;
+    int32_t fGroupsLength;
+    /**
+     * Serialized BytesTrie. Maps each supported language like "en" to its group,
+     * and each maximized supported locale like "en_Latn_US" to the index
+     * of the first supported locale that maximizes to it.
+     */
+    uint8_t *fTrieBytes;
+    /** TRUE if a wildcard language rule can match within the threshold. */
+    UBool fMatchAllLanguages;
+    int32_t fThreshold;
+    int32_t fDemotionPerDesiredLocale;
+};
+
+U_NAMESPACE_END
+
+#endif  // U_HIDE_DRAFT_API
+#endif  // __LOCALEMATCHER_H__
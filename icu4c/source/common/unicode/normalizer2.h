@@ -247,6 +247,59 @@ class U_COMMON_API Normalizer2 : public UObject {
     normalizeUTF8(uint32_t options, StringPiece src, ByteSink &sink,
                   Edits *edits, UErrorCode &errorCode) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Writes the normalized form of the source string to the destination string
+     * (replacing its contents) and returns the destination string,
+     * like normalize() but optionally using several threads for a long string.
+     *
+     * The string is split at hasBoundaryBefore() positions into about
+     * numThreads parts which are normalized independently and concatenated.
+     * The result is the same as from normalize().
+     * Strings that are too short to benefit are normalized on the calling thread.
+     *
+     * @param src source string
+     * @param dest destination string; its contents is replaced with normalized src
+     * @param numThreads The maximum number of threads to use, including the calling one.
+     *                   1 (or less) normalizes the whole string on the calling thread.
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return dest
+     * @draft ICU 64
+     */
+    UnicodeString &
+    normalizeInParallel(const UnicodeString &src,
+                        UnicodeString &dest,
+                        int32_t numThreads,
+                        UErrorCode &errorCode) const;
+
+    /**
+     * Normalizes a UTF-8 string like normalizeUTF8() with options 0 and no edits,
+     * but optionally using several threads for a long string.
+     *
+     * The string is split at hasBoundaryBefore() positions into about
+     * numThreads parts which are normalized independently,
+     * and the results are written to the sink in order.
+     * The output is the same as from normalizeUTF8().
+     *
+     * @param src       Source UTF-8 string.
+     * @param sink      A ByteSink to which the normalized UTF-8 result string is written.
+     *                  sink.Flush() is called at the end.
+     * @param numThreads The maximum number of threads to use, including the calling one.
+     *                   1 (or less) normalizes the whole string on the calling thread.
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    void
+    normalizeUTF8InParallel(StringPiece src, ByteSink &sink,
+                            int32_t numThreads, UErrorCode &errorCode) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Appends the normalized form of the second string to the first string
      * (merging them at the boundary) and returns the first string.
@@ -0,0 +1,193 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  normstream.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*/
+
+#ifndef __NORMSTREAM_H__
+#define __NORMSTREAM_H__
+
+/**
+ * \file
+ * \brief C++ API: Normalization of text that arrives in chunks.
+ */
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/appendable.h"
+#include "unicode/bytestream.h"
+#include "unicode/normalizer2.h"
+#include "unicode/stringpiece.h"
+#include "unicode/unistr.h"
+
+U_NAMESPACE_BEGIN
+
+class CharString;
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Normalizes a text stream that is passed in as a sequence of arbitrary chunks,
+ * for example the buffers of a file or network reader,
+ * without ever holding the whole text in memory.
+ *
+ * Each chunk is normalized up to its last normalization boundary
+ * (see Normalizer2::hasBoundaryBefore() and Normalizer2::hasBoundaryAfter())
+ * and the result is written to the sink right away.
+ * Only the text from that boundary to the end of the chunk is held back,
+ * because it might interact with the start of the next chunk.
+ * A chunk may end in the middle of a surrogate pair or
+ * of a UTF-8 byte sequence.
+ * finish() or finishUTF8() normalizes the text that is still held back.
+ *
+ * The concatenation of the output is the same as normalizing
+ * the concatenation of the input in one piece.
+ *
+ * In normal text the held-back tail is at most a few characters long.
+ * It grows only in a sequence of characters without any boundary,
+ * such as a very long run of combining marks;
+ * see the Stream-Safe Text Format in UAX #15.
+ *
+ * One stream processes either UTF-16 or UTF-8 text, not a mix of both:
+ * Before switching, call finish() or finishUTF8() or reset().
+ *
+ * An instance is not thread-safe, but different instances
+ * may share the same Normalizer2.
+ *
+ * \code
+ * const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+ * StreamingNormalizer stream(*nfc);
+ * while (reader.read(buffer, length)) {
+ *     stream.normalizeUTF8(StringPiece(buffer, length), sink, errorCode);
+ * }
+ * stream.finishUTF8(sink, errorCode);
+ * \endcode
+ *
+ * @draft ICU 64
+ */
+class U_COMMON_API StreamingNormalizer : public UMemory {
+public:
+    /**
+     * Constructor.
+     * @param norm2 the normalizer to be used; it must outlive this object
+     * @draft ICU 64
+     */
+    explicit StreamingNormalizer(const Normalizer2 &norm2);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    ~StreamingNormalizer();
+
+    /**
+     * Normalizes the next chunk of UTF-16 text.
+     * Writes the normalized text up to the last boundary to dest
+     * and holds back the rest.
+     * @param chunk the next piece of the input text
+     * @param dest receives the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_INVALID_STATE_ERROR if UTF-8 text is held back.
+     * @draft ICU 64
+     */
+    void normalize(const UnicodeString &chunk, Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the next chunk of UTF-16 text.
+     * Writes the normalized text up to the last boundary to dest
+     * and holds back the rest.
+     * @param s the next piece of the input text
+     * @param length the length of s
+     * @param dest receives the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_INVALID_STATE_ERROR if UTF-8 text is held back.
+     * @draft ICU 64
+     */
+    void normalize(ConstChar16Ptr s, int32_t length, Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the text that is held back from previous UTF-16 chunks,
+     * writes it to dest, and resets this object for a new stream.
+     * @param dest receives the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    void finish(Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the next chunk of UTF-8 text.
+     * Writes the normalized text up to the last boundary to sink
+     * and holds back the rest.
+     * Ill-formed byte sequences are passed through like by Normalizer2::normalizeUTF8().
+     * @param chunk the next piece of the input text
+     * @param sink receives the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Set to U_INVALID_STATE_ERROR if UTF-16 text is held back.
+     * @draft ICU 64
+     */
+    void normalizeUTF8(StringPiece chunk, ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the text that is held back from previous UTF-8 chunks,
+     * writes it to sink, and resets this object for a new stream.
+     * @param sink receives the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 64
+     */
+    void finishUTF8(ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Discards the text that is held back, to start a new stream.
+     * @draft ICU 64
+     */
+    void reset();
+
+    /**
+     * Returns the number of code units (UChars or bytes) that are held back.
+     * @return the length of the held-back text
+     * @draft ICU 64
+     */
+    int32_t getPendingLength() const;
+
+private:
+    StreamingNormalizer(const StreamingNormalizer &other) = delete;
+    StreamingNormalizer &operator=(const StreamingNormalizer &other) = delete;
+
+    void flush(const char16_t *s, int32_t length, Appendable &dest, UErrorCode &errorCode);
+
+    const Normalizer2 &norm2;
+    /** Held-back UTF-16 text. */
+    UnicodeString pending;
+    /** Held-back UTF-8 text, allocated on first use. */
+    CharString *pending8;
+    /** Reused output buffer for UTF-16 text. */
+    UnicodeString buffer;
+};
+
+#endif  /* U_HIDE_DRAFT_API */
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
+#endif  // __NORMSTREAM_H__
@@ -119,6 +119,13 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     uint32_t            fDictionaryCharCount;
 
+    /**
+     * The maximum number of threads for dividing up one run of dictionary characters.
+     * See setDictionaryThreadCount().
+     * @internal (private)
+     */
+    int32_t             fDictionaryThreadCount;
+
     /**
      *   A character iterator that refers to the same text as the UText, above.
      *   Only included for compatibility with old API, which was based on CharacterIterators.
@@ -406,6 +413,30 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     virtual int32_t next(void);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Advances the iterator by up to capacity boundaries at once,
+     * and writes their positions and optionally their rule status values
+     * to the caller's arrays.
+     * This is equivalent to calling next() and getRuleStatus() until next()
+     * returns DONE or capacity boundaries have been found, but it is faster
+     * for long texts because it runs the rules directly
+     * rather than going through the boundary cache for every boundary.
+     *
+     * Afterwards, the iterator is on the last boundary that was returned,
+     * as with next(). If it was already on the last boundary of the text,
+     * then it returns 0 and the iterator position does not change.
+     *
+     * @param dest Receives the boundary positions.
+     * @param capacity The number of elements available in dest,
+     *                 and in ruleStatus if that is not NULL.
+     * @param ruleStatus If not NULL, receives the getRuleStatus() value for each boundary.
+     * @return The number of boundaries written to dest; 0 at the end of the text.
+     * @draft ICU 64
+     */
+    int32_t nextBoundaries(int32_t *dest, int32_t capacity, int32_t *ruleStatus);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Moves the iterator backwards, to the last boundary preceding this one.
      * @return The position of the last boundary position preceding this one.
@@ -613,6 +644,32 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     virtual RuleBasedBreakIterator &refreshInputText(UText *input, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Sets the maximum number of threads that this iterator may use to find the
+     * boundaries within one long run of Thai, Lao, Khmer or Myanmar text that is
+     * divided up into words with a dictionary.
+     * Such a run is split near equal offsets and the parts are divided up
+     * concurrently; the boundaries are the same as with a single thread.
+     * Runs shorter than several thousand code units per thread use fewer threads.
+     *
+     * The default is 1: no additional threads are started.
+     * The setting is copied by clone() and the assignment operator.
+     *
+     * @param count The maximum number of threads, including the calling one.
+     *              Values less than 1 are treated as 1.
+     * @draft ICU 64
+     */
+    void setDictionaryThreadCount(int32_t count);
+
+    /**
+     * Returns the maximum number of threads set by setDictionaryThreadCount().
+     * @return the maximum number of threads for one run of dictionary characters
+     * @draft ICU 64
+     */
+    int32_t getDictionaryThreadCount() const;
+#endif  /* U_HIDE_DRAFT_API */
+
 
 private:
     //=======================================================================
@@ -642,6 +699,13 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     int32_t handleSafePrevious(int32_t fromPosition);
 
+    /**
+     * The handleSafePrevious() state machine loop, for one row width of the state table.
+     * @internal (private)
+     */
+    template <typename RowType>
+    int32_t handleSafePreviousT(int32_t fromPosition);
+
     /**
      * Find a rule-based boundary by running the state machine.
      * Input
@@ -656,6 +720,14 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     int32_t handleNext();
 
+    /**
+     * The handleNext() state machine loop, for one row width of the state table
+     * and one way of reading the text.
+     * @internal (private)
+     */
+    template <typename RowType, typename TextReader>
+    int32_t handleNextT(TextReader &text);
+
 
     /**
      * This function returns the appropriate LanguageBreakEngine for a
@@ -393,6 +393,34 @@ udata_setCommonData(const void *data, UErrorCode *err);
 U_STABLE void U_EXPORT2
 udata_setAppData(const char *packageName, const void *data, UErrorCode *err);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Maps an application data package into memory once and keeps it there
+ * until u_cleanup(). The package is either a common data file (path ends with ".dat")
+ * or a directory of individual data files like .res files.
+ * For a directory, all of its ICU data files are mapped and indexed right away.
+ *
+ * Afterwards, udata_open() and ures_open() etc. with the package path
+ * (without ".dat", with or without a trailing separator) are served from the
+ * pinned package without any file system access, from any thread.
+ * Items that are not in the package fail right away; there is no fallback
+ * to other packages or files.
+ *
+ * Pinning a package path that is already pinned has no effect and sets
+ * U_USING_DEFAULT_WARNING.
+ * Like udata_setAppData(), this should be called before the package is used.
+ *
+ * @param path the path of the .dat file or of the directory
+ * @param err outgoing error status, for example U_FILE_ACCESS_ERROR if the
+ *            file or directory cannot be read, or U_UNSUPPORTED_ERROR for a
+ *            directory on a platform without directory listing support
+ * @see udata_setAppData
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+udata_pinPackage(const char *path, UErrorCode *err);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Possible settings for udata_setFileAccess()
  * @see udata_setFileAccess
@@ -652,6 +652,21 @@ uiter_setUTF16BE(UCharIterator *iter, const char *s, int32_t length);
 U_STABLE void U_EXPORT2
 uiter_setUTF8(UCharIterator *iter, const char *s, int32_t length);
 
+#ifndef U_HIDE_INTERNAL_API
+/**
+ * If the UCharIterator was set up with uiter_setUTF8(),
+ * then this returns its UTF-8 string, so that the caller can process
+ * the bytes directly rather than UTF-16 code units.
+ *
+ * @param iter UCharIterator structure
+ * @param pLength receives the length of the UTF-8 string in bytes
+ * @return the UTF-8 string, or NULL if iter is not a UTF-8 iterator
+ * @internal
+ */
+U_INTERNAL const char * U_EXPORT2
+uiter_getUTF8(const UCharIterator *iter, int32_t *pLength);
+#endif  /* U_HIDE_INTERNAL_API */
+
 #if U_SHOW_CPLUSPLUS_API
 
 /**
@@ -1170,6 +1170,65 @@ uloc_toLanguageTag(const char* localeID,
                    UBool strict,
                    UErrorCode* err);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Selects one of the caches behind uloc_addLikelySubtags(), uloc_minimizeSubtags()
+ * and uloc_toLanguageTag().
+ *
+ * Each of these functions remembers its most recently used results
+ * in a bounded cache keyed by the input locale ID,
+ * so that a process which converts the same few locale IDs over and over
+ * (for example, from HTTP Accept-Language headers) does the work only once per ID.
+ * The caches are thread-safe, and discard the least recently used results when full.
+ * Locale::addLikelySubtags(), Locale::minimizeSubtags() and Locale::toLanguageTag()
+ * use the same caches.
+ *
+ * @see uloc_getCacheCounts
+ * @see uloc_setCacheCapacity
+ * @draft ICU 64
+ */
+typedef enum ULocCacheType {
+    /** The cache for uloc_addLikelySubtags(). @draft ICU 64 */
+    ULOC_CACHE_ADD_LIKELY_SUBTAGS,
+    /** The cache for uloc_minimizeSubtags(). @draft ICU 64 */
+    ULOC_CACHE_MINIMIZE_SUBTAGS,
+    /** The cache for uloc_toLanguageTag(), strict or not. @draft ICU 64 */
+    ULOC_CACHE_TO_LANGUAGE_TAG
+} ULocCacheType;
+
+/**
+ * Gets the number of cache hits and misses since the process started
+ * or since the last uloc_setCacheCapacity().
+ * A call counts as a miss when the result was not in the cache, or,
+ * for uloc_addLikelySubtags() and uloc_minimizeSubtags(), when the cached result
+ * and its NUL terminator did not fit into the caller's output buffer.
+ * Calls with a NULL locale ID (the default locale) are not counted.
+ *
+ * @param type  selects the cache
+ * @param hits  receives the number of cache hits; can be NULL
+ * @param misses receives the number of cache misses; can be NULL
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+uloc_getCacheCounts(ULocCacheType type, int64_t *hits, int64_t *misses);
+
+/**
+ * Sets the maximum number of results that each of the caches
+ * behind uloc_addLikelySubtags(), uloc_minimizeSubtags() and uloc_toLanguageTag()
+ * remembers, empties the caches, and resets their hit and miss counts.
+ * A capacity of 0 turns caching off. The default capacity is 128.
+ *
+ * @param capacity  the maximum number of results per cache, must be at least 0
+ * @param status    ICU error code; set to U_ILLEGAL_ARGUMENT_ERROR if capacity<0
+ * @see ULocCacheType
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+uloc_setCacheCapacity(int32_t capacity, UErrorCode *status);
+
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Converts the specified keyword (legacy key, or BCP 47 Unicode locale
  * extension key) to the equivalent BCP 47 Unicode locale extension key.
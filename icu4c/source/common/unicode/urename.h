@@ -375,6 +375,7 @@
 #define u_strcmp U_ICU_ENTRY_POINT_RENAME(u_strcmp)
 #define u_strcmpCodePointOrder U_ICU_ENTRY_POINT_RENAME(u_strcmpCodePointOrder)
 #define u_strcmpFold U_ICU_ENTRY_POINT_RENAME(u_strcmpFold)
+#define u_strcmpFoldUTF8 U_ICU_ENTRY_POINT_RENAME(u_strcmpFoldUTF8)
 #define u_strcpy U_ICU_ENTRY_POINT_RENAME(u_strcpy)
 #define u_strcspn U_ICU_ENTRY_POINT_RENAME(u_strcspn)
 #define u_strlen U_ICU_ENTRY_POINT_RENAME(u_strlen)
@@ -418,6 +419,8 @@
 #define u_vsprintf_u U_ICU_ENTRY_POINT_RENAME(u_vsprintf_u)
 #define u_vsscanf U_ICU_ENTRY_POINT_RENAME(u_vsscanf)
 #define u_vsscanf_u U_ICU_ENTRY_POINT_RENAME(u_vsscanf_u)
+#define u_waitForWarmup U_ICU_ENTRY_POINT_RENAME(u_waitForWarmup)
+#define u_warmup U_ICU_ENTRY_POINT_RENAME(u_warmup)
 #define u_writeIdenticalLevelRun U_ICU_ENTRY_POINT_RENAME(u_writeIdenticalLevelRun)
 #define ubidi_addPropertyStarts U_ICU_ENTRY_POINT_RENAME(ubidi_addPropertyStarts)
 #define ubidi_close U_ICU_ENTRY_POINT_RENAME(ubidi_close)
@@ -728,6 +731,9 @@
 #define ucol_getRulesEx U_ICU_ENTRY_POINT_RENAME(ucol_getRulesEx)
 #define ucol_getShortDefinitionString U_ICU_ENTRY_POINT_RENAME(ucol_getShortDefinitionString)
 #define ucol_getSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getSortKey)
+#define ucol_getSortKeyUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeyUTF8)
+#define ucol_getSortKeys U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeys)
+#define ucol_getSortKeysUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeysUTF8)
 #define ucol_getStrength U_ICU_ENTRY_POINT_RENAME(ucol_getStrength)
 #define ucol_getTailoredSet U_ICU_ENTRY_POINT_RENAME(ucol_getTailoredSet)
 #define ucol_getUCAVersion U_ICU_ENTRY_POINT_RENAME(ucol_getUCAVersion)
@@ -762,6 +768,8 @@
 #define ucol_setStrength U_ICU_ENTRY_POINT_RENAME(ucol_setStrength)
 #define ucol_setText U_ICU_ENTRY_POINT_RENAME(ucol_setText)
 #define ucol_setVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_setVariableTop)
+#define ucol_sortStrings U_ICU_ENTRY_POINT_RENAME(ucol_sortStrings)
+#define ucol_sortStringsUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_sortStringsUTF8)
 #define ucol_strcoll U_ICU_ENTRY_POINT_RENAME(ucol_strcoll)
 #define ucol_strcollIter U_ICU_ENTRY_POINT_RENAME(ucol_strcollIter)
 #define ucol_strcollUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_strcollUTF8)
@@ -850,6 +858,7 @@
 #define udat_toPatternRelativeDate U_ICU_ENTRY_POINT_RENAME(udat_toPatternRelativeDate)
 #define udat_toPatternRelativeTime U_ICU_ENTRY_POINT_RENAME(udat_toPatternRelativeTime)
 #define udat_unregisterOpener U_ICU_ENTRY_POINT_RENAME(udat_unregisterOpener)
+#define udata_adviseWillNeed U_ICU_ENTRY_POINT_RENAME(udata_adviseWillNeed)
 #define udata_checkCommonData U_ICU_ENTRY_POINT_RENAME(udata_checkCommonData)
 #define udata_close U_ICU_ENTRY_POINT_RENAME(udata_close)
 #define udata_closeSwapper U_ICU_ENTRY_POINT_RENAME(udata_closeSwapper)
@@ -863,6 +872,7 @@
 #define udata_openChoice U_ICU_ENTRY_POINT_RENAME(udata_openChoice)
 #define udata_openSwapper U_ICU_ENTRY_POINT_RENAME(udata_openSwapper)
 #define udata_openSwapperForInputData U_ICU_ENTRY_POINT_RENAME(udata_openSwapperForInputData)
+#define udata_pinPackage U_ICU_ENTRY_POINT_RENAME(udata_pinPackage)
 #define udata_printError U_ICU_ENTRY_POINT_RENAME(udata_printError)
 #define udata_readInt16 U_ICU_ENTRY_POINT_RENAME(udata_readInt16)
 #define udata_readInt32 U_ICU_ENTRY_POINT_RENAME(udata_readInt32)
@@ -1002,6 +1012,7 @@
 #define uidna_toUnicode U_ICU_ENTRY_POINT_RENAME(uidna_toUnicode)
 #define uiter_current32 U_ICU_ENTRY_POINT_RENAME(uiter_current32)
 #define uiter_getState U_ICU_ENTRY_POINT_RENAME(uiter_getState)
+#define uiter_getUTF8 U_ICU_ENTRY_POINT_RENAME(uiter_getUTF8)
 #define uiter_next32 U_ICU_ENTRY_POINT_RENAME(uiter_next32)
 #define uiter_previous32 U_ICU_ENTRY_POINT_RENAME(uiter_previous32)
 #define uiter_setCharacterIterator U_ICU_ENTRY_POINT_RENAME(uiter_setCharacterIterator)
@@ -1049,6 +1060,7 @@
 #define uloc_forLanguageTag U_ICU_ENTRY_POINT_RENAME(uloc_forLanguageTag)
 #define uloc_getAvailable U_ICU_ENTRY_POINT_RENAME(uloc_getAvailable)
 #define uloc_getBaseName U_ICU_ENTRY_POINT_RENAME(uloc_getBaseName)
+#define uloc_getCacheCounts U_ICU_ENTRY_POINT_RENAME(uloc_getCacheCounts)
 #define uloc_getCharacterOrientation U_ICU_ENTRY_POINT_RENAME(uloc_getCharacterOrientation)
 #define uloc_getCountry U_ICU_ENTRY_POINT_RENAME(uloc_getCountry)
 #define uloc_getCurrentCountryID U_ICU_ENTRY_POINT_RENAME(uloc_getCurrentCountryID)
@@ -1080,6 +1092,7 @@
 #define uloc_minimizeSubtags U_ICU_ENTRY_POINT_RENAME(uloc_minimizeSubtags)
 #define uloc_openKeywordList U_ICU_ENTRY_POINT_RENAME(uloc_openKeywordList)
 #define uloc_openKeywords U_ICU_ENTRY_POINT_RENAME(uloc_openKeywords)
+#define uloc_setCacheCapacity U_ICU_ENTRY_POINT_RENAME(uloc_setCacheCapacity)
 #define uloc_setDefault U_ICU_ENTRY_POINT_RENAME(uloc_setDefault)
 #define uloc_setKeywordValue U_ICU_ENTRY_POINT_RENAME(uloc_setKeywordValue)
 #define uloc_toLanguageTag U_ICU_ENTRY_POINT_RENAME(uloc_toLanguageTag)
@@ -1103,6 +1116,7 @@
 #define ulocimp_getLanguage U_ICU_ENTRY_POINT_RENAME(ulocimp_getLanguage)
 #define ulocimp_getRegionForSupplementalData U_ICU_ENTRY_POINT_RENAME(ulocimp_getRegionForSupplementalData)
 #define ulocimp_getScript U_ICU_ENTRY_POINT_RENAME(ulocimp_getScript)
+#define ulocimp_parseSimpleLanguageTag U_ICU_ENTRY_POINT_RENAME(ulocimp_parseSimpleLanguageTag)
 #define ulocimp_toBcpKey U_ICU_ENTRY_POINT_RENAME(ulocimp_toBcpKey)
 #define ulocimp_toBcpType U_ICU_ENTRY_POINT_RENAME(ulocimp_toBcpType)
 #define ulocimp_toLegacyKey U_ICU_ENTRY_POINT_RENAME(ulocimp_toLegacyKey)
@@ -1252,6 +1266,7 @@
 #define uprops_getSource U_ICU_ENTRY_POINT_RENAME(uprops_getSource)
 #define upropsvec_addPropertyStarts U_ICU_ENTRY_POINT_RENAME(upropsvec_addPropertyStarts)
 #define uprv_add32_overflow U_ICU_ENTRY_POINT_RENAME(uprv_add32_overflow)
+#define uprv_adviseWillNeed U_ICU_ENTRY_POINT_RENAME(uprv_adviseWillNeed)
 #define uprv_aestrncpy U_ICU_ENTRY_POINT_RENAME(uprv_aestrncpy)
 #define uprv_asciiFromEbcdic U_ICU_ENTRY_POINT_RENAME(uprv_asciiFromEbcdic)
 #define uprv_asciitolower U_ICU_ENTRY_POINT_RENAME(uprv_asciitolower)
@@ -1696,6 +1711,8 @@
 #define usprep_prepare U_ICU_ENTRY_POINT_RENAME(usprep_prepare)
 #define usprep_swap U_ICU_ENTRY_POINT_RENAME(usprep_swap)
 #define ustr_hashCharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashCharsN)
+#define ustr_hashFoldUCharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashFoldUCharsN)
+#define ustr_hashFoldUTF8N U_ICU_ENTRY_POINT_RENAME(ustr_hashFoldUTF8N)
 #define ustr_hashICharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashICharsN)
 #define ustr_hashUCharsN U_ICU_ENTRY_POINT_RENAME(ustr_hashUCharsN)
 #define ustrcase_getCaseLocale U_ICU_ENTRY_POINT_RENAME(ustrcase_getCaseLocale)
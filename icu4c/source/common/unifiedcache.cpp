@@ -21,8 +21,18 @@
 #include "umutex.h"
 
 static icu::UnifiedCache *gCache = NULL;
-static UMutex gCacheMutex = U_MUTEX_INITIALIZER;
-static UConditionVar gInProgressValueAddedCond = U_CONDITION_INITIALIZER;
+// One mutex and condition variable per shard. They guard the shard's hash table.
+static UMutex gCacheMutexes[icu::UnifiedCache::SHARD_COUNT] = {
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER,
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER
+};
+static UConditionVar gInProgressValueAddedConds[icu::UnifiedCache::SHARD_COUNT] = {
+    U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER,
+    U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER, U_CONDITION_INITIALIZER
+};
+// Serializes eviction and flushing, and guards the eviction position and policy.
+// Must not be acquired while holding a shard mutex.
+static UMutex gCacheEvictionMutex = U_MUTEX_INITIALIZER;
 static icu::UInitOnce gCacheInitOnce = U_INITONCE_INITIALIZER;
 
 static const int32_t MAX_EVICT_ITERATIONS = 10;
@@ -92,14 +102,18 @@ UnifiedCache *UnifiedCache::getInstance(UErrorCode &status) {
 }
 
 UnifiedCache::UnifiedCache(UErrorCode &status) :
-        fHashtable(NULL),
-        fEvictPos(UHASH_FIRST),
+        fEvictShard(0),
+        fNumKeys(0),
         fNumValuesTotal(0),
         fNumValuesInUse(0),
         fMaxUnused(DEFAULT_MAX_UNUSED),
         fMaxPercentageOfInUse(DEFAULT_PERCENTAGE_OF_IN_USE),
         fAutoEvictedCount(0),
         fNoValue(nullptr) {
+    for (int32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+        fHashtables[shard] = nullptr;
+        fEvictPos[shard] = UHASH_FIRST;
+    }
     if (U_FAILURE(status)) {
         return;
     }
@@ -112,15 +126,23 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
     fNoValue->hardRefCount = 1;  // when other references to it are removed.
     fNoValue->cachePtr = this;
 
-    fHashtable = uhash_open(
-            &ucache_hashKeys,
-            &ucache_compareKeys,
-            NULL,
-            &status);
-    if (U_FAILURE(status)) {
-        return;
+    for (int32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+        fHashtables[shard] = uhash_open(
+                &ucache_hashKeys,
+                &ucache_compareKeys,
+                NULL,
+                &status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        uhash_setKeyDeleter(fHashtables[shard], &ucache_deleteKey);
     }
-    uhash_setKeyDeleter(fHashtable, &ucache_deleteKey);
+}
+
+int32_t UnifiedCache::_shardIndex(const CacheKeyBase &key) {
+    // uhash uses the low-order bits of the hash code modulo a prime,
+    // so take the shard index from the high-order bits.
+    return (int32_t)(((uint32_t)key.hashCode() * 0x9e3779b9u) >> 24) & (SHARD_COUNT - 1);
 }
 
 void UnifiedCache::setEvictionPolicy(
@@ -132,28 +154,26 @@ void UnifiedCache::setEvictionPolicy(
         status = U_ILLEGAL_ARGUMENT_ERROR;
         return;
     }
-    Mutex lock(&gCacheMutex);
-    fMaxUnused = count;
-    fMaxPercentageOfInUse = percentageOfInUseItems;
+    Mutex lock(&gCacheEvictionMutex);
+    umtx_storeRelease(fMaxUnused, count);
+    umtx_storeRelease(fMaxPercentageOfInUse, percentageOfInUseItems);
 }
 
 int32_t UnifiedCache::unusedCount() const {
-    Mutex lock(&gCacheMutex);
-    return uhash_count(fHashtable) - fNumValuesInUse;
+    return umtx_loadAcquire(fNumKeys) - umtx_loadAcquire(fNumValuesInUse);
 }
 
 int64_t UnifiedCache::autoEvictedCount() const {
-    Mutex lock(&gCacheMutex);
+    Mutex lock(&gCacheEvictionMutex);
     return fAutoEvictedCount;
 }
 
 int32_t UnifiedCache::keyCount() const {
-    Mutex lock(&gCacheMutex);
-    return uhash_count(fHashtable);
+    return umtx_loadAcquire(fNumKeys);
 }
 
 void UnifiedCache::flush() const {
-    Mutex lock(&gCacheMutex);
+    Mutex lock(&gCacheEvictionMutex);
 
     // Use a loop in case cache items that are flushed held hard references to
     // other cache items making those additional cache items eligible for
@@ -162,8 +182,7 @@ void UnifiedCache::flush() const {
 }
 
 void UnifiedCache::handleUnreferencedObject() const {
-    Mutex lock(&gCacheMutex);
-    --fNumValuesInUse;
+    umtx_atomic_dec(&fNumValuesInUse);
     _runEvictionSlice();
 }
 
@@ -181,36 +200,38 @@ void UnifiedCache::dump() {
 }
 
 void UnifiedCache::dumpContents() const {
-    Mutex lock(&gCacheMutex);
     _dumpContents();
 }
 
 // Dumps content of cache.
-// On entry, gCacheMutex must be held.
+// On entry, no cache mutex may be held.
 // On exit, cache contents dumped to stderr.
 void UnifiedCache::_dumpContents() const {
-    int32_t pos = UHASH_FIRST;
-    const UHashElement *element = uhash_nextElement(fHashtable, &pos);
     char buffer[256];
     int32_t cnt = 0;
-    for (; element != NULL; element = uhash_nextElement(fHashtable, &pos)) {
-        const SharedObject *sharedObject =
-                (const SharedObject *) element->value.pointer;
-        const CacheKeyBase *key =
-                (const CacheKeyBase *) element->key.pointer;
-        if (sharedObject->hasHardReferences()) {
-            ++cnt;
-            fprintf(
-                    stderr,
-                    "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
-                    key->writeDescription(buffer, 256),
-                    key->creationStatus,
-                    sharedObject == fNoValue ? NULL :sharedObject,
-                    sharedObject->getRefCount(),
-                    sharedObject->getSoftRefCount());
+    for (int32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+        Mutex lock(&gCacheMutexes[shard]);
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *element = uhash_nextElement(fHashtables[shard], &pos);
+        for (; element != NULL; element = uhash_nextElement(fHashtables[shard], &pos)) {
+            const SharedObject *sharedObject =
+                    (const SharedObject *) element->value.pointer;
+            const CacheKeyBase *key =
+                    (const CacheKeyBase *) element->key.pointer;
+            if (sharedObject->hasHardReferences()) {
+                ++cnt;
+                fprintf(
+                        stderr,
+                        "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
+                        key->writeDescription(buffer, 256),
+                        key->creationStatus,
+                        sharedObject == fNoValue ? NULL :sharedObject,
+                        sharedObject->getRefCount(),
+                        umtx_loadAcquire(sharedObject->softRefCount));
+            }
         }
     }
-    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, uhash_count(fHashtable));
+    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, keyCount());
 }
 #endif
 
@@ -221,75 +242,93 @@ UnifiedCache::~UnifiedCache() {
         // Now all that should be left in the cache are entries that refer to
         // each other and entries with hard references from outside the cache.
         // Nothing we can do about these so proceed to wipe out the cache.
-        Mutex lock(&gCacheMutex);
+        Mutex lock(&gCacheEvictionMutex);
         _flush(TRUE);
     }
-    uhash_close(fHashtable);
-    fHashtable = nullptr;
+    for (int32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+        uhash_close(fHashtables[shard]);
+        fHashtables[shard] = nullptr;
+    }
     delete fNoValue;
     fNoValue = nullptr;
 }
 
-const UHashElement *
-UnifiedCache::_nextElement() const {
-    const UHashElement *element = uhash_nextElement(fHashtable, &fEvictPos);
-    if (element == NULL) {
-        fEvictPos = UHASH_FIRST;
-        return uhash_nextElement(fHashtable, &fEvictPos);
-    }
-    return element;
-}
-
 UBool UnifiedCache::_flush(UBool all) const {
     UBool result = FALSE;
-    int32_t origSize = uhash_count(fHashtable);
-    for (int32_t i = 0; i < origSize; ++i) {
-        const UHashElement *element = _nextElement();
-        if (element == nullptr) {
-            break;
-        }
-        if (all || _isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            U_ASSERT(sharedObject->cachePtr == this);
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
-            result = TRUE;
+    for (int32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+        Mutex lock(&gCacheMutexes[shard]);
+        UHashtable *hashtable = fHashtables[shard];
+        // Removing elements does not rehash, so we can keep iterating.
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *element;
+        while ((element = uhash_nextElement(hashtable, &pos)) != nullptr) {
+            if (all || _isEvictable(element)) {
+                const SharedObject *sharedObject =
+                        (const SharedObject *) element->value.pointer;
+                U_ASSERT(sharedObject->cachePtr == this);
+                uhash_removeElement(hashtable, element);
+                umtx_atomic_dec(&fNumKeys);
+                removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
+                result = TRUE;
+            }
         }
     }
     return result;
 }
 
 int32_t UnifiedCache::_computeCountOfItemsToEvict() const {
-    int32_t totalItems = uhash_count(fHashtable);
-    int32_t evictableItems = totalItems - fNumValuesInUse;
+    int32_t numValuesInUse = umtx_loadAcquire(fNumValuesInUse);
+    int32_t totalItems = umtx_loadAcquire(fNumKeys);
+    int32_t evictableItems = totalItems - numValuesInUse;
 
-    int32_t unusedLimitByPercentage = fNumValuesInUse * fMaxPercentageOfInUse / 100;
-    int32_t unusedLimit = std::max(unusedLimitByPercentage, fMaxUnused);
+    int32_t unusedLimitByPercentage = numValuesInUse * umtx_loadAcquire(fMaxPercentageOfInUse) / 100;
+    int32_t unusedLimit = std::max(unusedLimitByPercentage, umtx_loadAcquire(fMaxUnused));
     int32_t countOfItemsToEvict = std::max(0, evictableItems - unusedLimit);
     return countOfItemsToEvict;
 }
 
 void UnifiedCache::_runEvictionSlice() const {
+    // Cheap check first so that the common case takes no lock at all.
+    if (_computeCountOfItemsToEvict() <= 0) {
+        return;
+    }
+    Mutex evictionLock(&gCacheEvictionMutex);
     int32_t maxItemsToEvict = _computeCountOfItemsToEvict();
     if (maxItemsToEvict <= 0) {
         return;
     }
-    for (int32_t i = 0; i < MAX_EVICT_ITERATIONS; ++i) {
-        const UHashElement *element = _nextElement();
-        if (element == nullptr) {
-            break;
-        }
-        if (_isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
-            ++fAutoEvictedCount;
-            if (--maxItemsToEvict == 0) {
-                break;
+    // Examine up to MAX_EVICT_ITERATIONS elements, continuing where the last slice
+    // left off, and moving on to the next shard at the end of each one.
+    // Stop after a full round through all shards, back to where we started,
+    // without finding any element.
+    int32_t examined = 0;
+    int32_t emptyShards = 0;
+    while (examined < MAX_EVICT_ITERATIONS && emptyShards <= SHARD_COUNT) {
+        int32_t shard = fEvictShard;
+        Mutex lock(&gCacheMutexes[shard]);
+        UHashtable *hashtable = fHashtables[shard];
+        const UHashElement *element = nullptr;
+        while (examined < MAX_EVICT_ITERATIONS &&
+                (element = uhash_nextElement(hashtable, &fEvictPos[shard])) != nullptr) {
+            ++examined;
+            emptyShards = 0;
+            if (_isEvictable(element)) {
+                const SharedObject *sharedObject =
+                        (const SharedObject *) element->value.pointer;
+                uhash_removeElement(hashtable, element);
+                umtx_atomic_dec(&fNumKeys);
+                removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
+                ++fAutoEvictedCount;
+                if (--maxItemsToEvict == 0) {
+                    return;
+                }
             }
         }
+        if (element == nullptr) {
+            fEvictPos[shard] = UHASH_FIRST;
+            fEvictShard = (shard + 1) & (SHARD_COUNT - 1);
+            ++emptyShards;
+        }
     }
 }
 
@@ -307,14 +346,15 @@ void UnifiedCache::_putNew(
         return;
     }
     keyToAdopt->fCreationStatus = creationStatus;
-    if (value->softRefCount == 0) {
+    if (umtx_loadAcquire(value->softRefCount) == 0) {
         _registerMaster(keyToAdopt, value);
     }
-    void *oldValue = uhash_put(fHashtable, keyToAdopt, (void *) value, &status);
+    void *oldValue = uhash_put(fHashtables[_shardIndex(key)], keyToAdopt, (void *) value, &status);
     U_ASSERT(oldValue == nullptr);
     (void)oldValue;
     if (U_SUCCESS(status)) {
-        value->softRefCount++;
+        umtx_atomic_inc(&fNumKeys);
+        umtx_atomic_inc(&value->softRefCount);
     }
 }
 
@@ -322,18 +362,21 @@ void UnifiedCache::_putIfAbsentAndGet(
         const CacheKeyBase &key,
         const SharedObject *&value,
         UErrorCode &status) const {
-    Mutex lock(&gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
-    if (element != NULL && !_inProgress(element)) {
-        _fetch(element, value, status);
-        return;
-    }
-    if (element == NULL) {
-        UErrorCode putError = U_ZERO_ERROR;
-        // best-effort basis only.
-        _putNew(key, value, status, putError);
-    } else {
-        _put(element, value, status);
+    {
+        int32_t shard = _shardIndex(key);
+        Mutex lock(&gCacheMutexes[shard]);
+        const UHashElement *element = uhash_find(fHashtables[shard], &key);
+        if (element != NULL && !_inProgress(element)) {
+            _fetch(element, value, status);
+            return;
+        }
+        if (element == NULL) {
+            UErrorCode putError = U_ZERO_ERROR;
+            // best-effort basis only.
+            _putNew(key, value, status, putError);
+        } else {
+            _put(element, value, status);
+        }
     }
     // Run an eviction slice. This will run even if we added a master entry
     // which doesn't increase the unused count, but that is still o.k
@@ -347,15 +390,16 @@ UBool UnifiedCache::_poll(
         UErrorCode &status) const {
     U_ASSERT(value == NULL);
     U_ASSERT(status == U_ZERO_ERROR);
-    Mutex lock(&gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
+    int32_t shard = _shardIndex(key);
+    Mutex lock(&gCacheMutexes[shard]);
+    const UHashElement *element = uhash_find(fHashtables[shard], &key);
 
     // If the hash table contains an inProgress placeholder entry for this key,
     // this means that another thread is currently constructing the value object.
     // Loop, waiting for that construction to complete.
      while (element != NULL && _inProgress(element)) {
-        umtx_condWait(&gInProgressValueAddedCond, &gCacheMutex);
-        element = uhash_find(fHashtable, &key);
+        umtx_condWait(&gInProgressValueAddedConds[shard], &gCacheMutexes[shard]);
+        element = uhash_find(fHashtables[shard], &key);
     }
 
     // If the hash table contains an entry for the key,
@@ -404,8 +448,8 @@ void UnifiedCache::_registerMaster(
             const CacheKeyBase *theKey, const SharedObject *value) const {
     theKey->fIsMaster = true;
     value->cachePtr = this;
-    ++fNumValuesTotal;
-    ++fNumValuesInUse;
+    umtx_atomic_inc(&fNumValuesTotal);
+    umtx_atomic_inc(&fNumValuesInUse);
 }
 
 void UnifiedCache::_put(
@@ -416,10 +460,10 @@ void UnifiedCache::_put(
     const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
     const SharedObject *oldValue = (const SharedObject *) element->value.pointer;
     theKey->fCreationStatus = status;
-    if (value->softRefCount == 0) {
+    if (umtx_loadAcquire(value->softRefCount) == 0) {
         _registerMaster(theKey, value);
     }
-    value->softRefCount++;
+    umtx_atomic_inc(&value->softRefCount);
     UHashElement *ptr = const_cast<UHashElement *>(element);
     ptr->value.pointer = (void *) value;
     U_ASSERT(oldValue == fNoValue);
@@ -427,7 +471,7 @@ void UnifiedCache::_put(
 
     // Tell waiting threads that we replace in-progress status with
     // an error.
-    umtx_condBroadcast(&gInProgressValueAddedCond);
+    umtx_condBroadcast(&gInProgressValueAddedConds[_shardIndex(*theKey)]);
 }
 
 void UnifiedCache::_fetch(
@@ -437,7 +481,7 @@ void UnifiedCache::_fetch(
     const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
     status = theKey->fCreationStatus;
 
-    // Since we have the cache lock, calling regular SharedObject add/removeRef
+    // Since we have a cache lock, calling regular SharedObject add/removeRef
     // could cause us to deadlock on ourselves since they may need to lock
     // the cache mutex.
     removeHardRef(value);
@@ -473,14 +517,15 @@ UBool UnifiedCache::_isEvictable(const UHashElement *element) const
 
     // We can evict entries that are either not a master or have just
     // one reference (The one reference being from the cache itself).
-    return (!theKey->fIsMaster || (theValue->softRefCount == 1 && theValue->noHardReferences()));
+    return (!theKey->fIsMaster ||
+            (umtx_loadAcquire(theValue->softRefCount) == 1 && theValue->noHardReferences()));
 }
 
 void UnifiedCache::removeSoftRef(const SharedObject *value) const {
     U_ASSERT(value->cachePtr == this);
-    U_ASSERT(value->softRefCount > 0);
-    if (--value->softRefCount == 0) {
-        --fNumValuesTotal;
+    U_ASSERT(umtx_loadAcquire(value->softRefCount) > 0);
+    if (umtx_atomic_dec(&value->softRefCount) == 0) {
+        umtx_atomic_dec(&fNumValuesTotal);
         if (value->noHardReferences()) {
             delete value;
         } else {
@@ -498,7 +543,7 @@ int32_t UnifiedCache::removeHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_dec(&value->hardRefCount);
         U_ASSERT(refCount >= 0);
         if (refCount == 0) {
-            --fNumValuesInUse;
+            umtx_atomic_dec(&fNumValuesInUse);
         }
     }
     return refCount;
@@ -510,7 +555,7 @@ int32_t UnifiedCache::addHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_inc(&value->hardRefCount);
         U_ASSERT(refCount >= 1);
         if (refCount == 1) {
-            fNumValuesInUse++;
+            umtx_atomic_inc(&fNumValuesInUse);
         }
     }
     return refCount;
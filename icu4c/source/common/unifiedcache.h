@@ -179,6 +179,12 @@ class LocaleCacheKey : public CacheKey<T> {
  * The unified cache. A singleton type.
  * Design doc here:
  * https://docs.google.com/document/d/1RwGQJs4N4tawNbf809iYDRCvXoMKqDJihxzYt1ysmd8/edit?usp=sharing
+ *
+ * The keys are partitioned by hash code into SHARD_COUNT shards, each with its own
+ * hash table and mutex, so that lookups of different keys rarely contend.
+ * The item counts used by the eviction policy are atomic and shared by all shards.
+ * Eviction slices are serialized by a separate eviction mutex and visit
+ * the shards round robin style, locking one shard at a time.
  */
 class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
  public:
@@ -344,13 +350,20 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    virtual void handleUnreferencedObject() const;
    virtual ~UnifiedCache();
    
+   /**
+    * The number of shards. Must be a power of 2.
+    */
+   enum { SHARD_COUNT = 8 };
+
  private:
-   UHashtable *fHashtable;
-   mutable int32_t fEvictPos;
-   mutable int32_t fNumValuesTotal;
-   mutable int32_t fNumValuesInUse;
-   int32_t fMaxUnused;
-   int32_t fMaxPercentageOfInUse;
+   UHashtable *fHashtables[SHARD_COUNT];
+   mutable int32_t fEvictShard;
+   mutable int32_t fEvictPos[SHARD_COUNT];
+   mutable u_atomic_int32_t fNumKeys;
+   mutable u_atomic_int32_t fNumValuesTotal;
+   mutable u_atomic_int32_t fNumValuesInUse;
+   mutable u_atomic_int32_t fMaxUnused;
+   mutable u_atomic_int32_t fMaxPercentageOfInUse;
    mutable int64_t fAutoEvictedCount;
    SharedObject *fNoValue;
    
@@ -361,7 +374,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * Flushes the contents of the cache. If cache values hold references to other
     * cache values then _flush should be called in a loop until it returns FALSE.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, gCacheEvictionMutex must be held and no shard mutex may be held.
     * On exit, those values with are evictable are flushed.
     * 
     *  @param all if false flush evictable items only, which are those with no external
@@ -376,7 +389,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
    /**
     * Gets value out of cache.
-    * On entry. gCacheMutex must not be held. value must be NULL. status
+    * On entry. No cache mutex may be held. value must be NULL. status
     * must be U_ZERO_ERROR.
     * On exit. value and status set to what is in cache at key or on cache
     * miss the key's createObject() is called and value and status are set to
@@ -393,7 +406,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
 
     /**
      * Attempts to fetch value and status for key from cache.
-     * On entry, gCacheMutex must not be held value must be NULL and status must
+     * On entry, no cache mutex may be held value must be NULL and status must
      * be U_ZERO_ERROR.
      * On exit, either returns FALSE (In this
      * case caller should try to create the object) or returns TRUE with value
@@ -409,7 +422,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     
     /**
      * Places a new value and creationStatus in the cache for the given key.
-     * On entry, gCacheMutex must be held. key must not exist in the cache. 
+     * On entry, the mutex of the key's shard must be held. key must not exist in the cache.
      * On exit, value and creation status placed under key. Soft reference added
      * to value on successful add. On error sets status.
      */
@@ -424,7 +437,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
      * entry for key is in progress. Otherwise, it leaves the current value and
      * status there.
      * 
-     * On entry. gCacheMutex must not be held. Value must be
+     * On entry. No cache mutex may be held. Value must be
      * included in the reference count of the object to which it points.
      * 
      * On exit, value and status are changed to what was already in the cache if
@@ -438,27 +451,27 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
            UErrorCode &status) const;
 
     /**
-     * Returns the next element in the cache round robin style.
-     * Returns nullptr if the cache is empty.
-     * On entry, gCacheMutex must be held.
+     * Returns the index of the shard that holds key.
      */
-    const UHashElement *_nextElement() const;
-   
+    static int32_t _shardIndex(const CacheKeyBase &key);
+
    /**
     * Return the number of cache items that would need to be evicted
     * to bring usage into conformance with eviction policy.
     * 
     * An item corresponds to an entry in the hash table, a hash table element.
     * 
-    * On entry, gCacheMutex must be held.
+    * Reads only atomic counters, so no mutex needs to be held, but then
+    * the result may already be outdated when it is returned.
     */
    int32_t _computeCountOfItemsToEvict() const;
    
    /**
     * Run an eviction slice.
-    * On entry, gCacheMutex must be held.
+    * On entry, no cache mutex may be held.
     * _runEvictionSlice runs a slice of the evict pipeline by examining the next
     * 10 entries in the cache round robin style evicting them if they are eligible.
+    * It returns right away, without locking anything, if no items need to be evicted.
     */
    void _runEvictionSlice() const;
  
@@ -468,7 +481,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * produce referneces to an already existing SharedObject are not masters -
     * they can be evicted and subsequently recreated.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, the mutex of the key's shard must be held.
     * On exit, items in use count incremented, entry is marked as a master
     * entry, and value registered with cache so that subsequent calls to
     * addRef() and removeRef() on it correctly interact with the cache.
@@ -477,7 +490,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
         
    /**
     * Store a value and creation error status in given hash entry.
-    * On entry, gCacheMutex must be held. Hash entry element must be in progress.
+    * On entry, the mutex of the element's shard must be held. Hash entry element must be in progress.
     * value must be non NULL.
     * On Exit, soft reference added to value. value and status stored in hash
     * entry. Soft reference removed from previous stored value. Waiting
@@ -490,14 +503,14 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     /**
      * Remove a soft reference, and delete the SharedObject if no references remain.
      * To be used from within the UnifiedCache implementation only.
-     * gCacheMutex must be held by caller.
+     * The mutex of the shard of the hash entry that held the reference must be held by caller.
      * @param value the SharedObject to be acted on.
      */
    void removeSoftRef(const SharedObject *value) const;
    
    /**
     * Increment the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * The mutex of the shard of the hash entry holding value must be held by the caller.
     * Update numValuesEvictable on transitions between zero and one reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -507,7 +520,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
   /**
     * Decrement the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * Thread-safe; the counts are atomic.
     * Update numValuesEvictable on transitions between one and zero reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -522,7 +535,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
    /**
     *  Fetch value and error code from a particular hash entry.
-    *  On entry, gCacheMutex must be held. value must be either NULL or must be
+    *  On entry, the mutex of the element's shard must be held. value must be either NULL or must be
     *  included in the ref count of the object to which it points.
     *  On exit, value and status set to what is in the hash entry. Caller must
     *  eventually call removeRef on value.
@@ -534,19 +547,19 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
                        
     /**
      * Determine if given hash entry is in progress.
-     * On entry, gCacheMutex must be held.
+     * On entry, the mutex of the element's shard must be held.
      */
    UBool _inProgress(const UHashElement *element) const;
    
    /**
     * Determine if given hash entry is in progress.
-    * On entry, gCacheMutex must be held.
+    * On entry, the mutex of the shard of the hash entry holding theValue must be held.
     */
    UBool _inProgress(const SharedObject *theValue, UErrorCode creationStatus) const;
    
    /**
     * Determine if given hash entry is eligible for eviction.
-    * On entry, gCacheMutex must be held.
+    * On entry, the mutex of the element's shard must be held.
     */
    UBool _isEvictable(const UHashElement *element) const;
 };
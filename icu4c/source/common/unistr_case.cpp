@@ -228,10 +228,8 @@ uhash_hashCaselessUnicodeString(const UElement key) {
     if (str == NULL) {
         return 0;
     }
-    // Inefficient; a better way would be to have a hash function in
-    // UnicodeString that does case folding on the fly.
-    UnicodeString copy(*str);
-    return copy.foldCase().hashCode();
+    // Case-fold on the fly rather than hashing a folded copy.
+    return ustr_hashFoldUCharsN(str->getBuffer(), str->length(), U_FOLD_CASE_DEFAULT);
 }
 
 // Defined here to reduce dependencies on break iterator
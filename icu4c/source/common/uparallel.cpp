@@ -0,0 +1,57 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  uparallel.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*/
+
+#include "unicode/utypes.h"
+
+#include <exception>
+#include <new>
+#include <thread>
+
+#include "cmemory.h"
+#include "uparallel.h"
+
+U_NAMESPACE_BEGIN
+
+U_COMMON_API void U_EXPORT2
+parallelFor(int32_t count, ParallelTaskFn *fn, void *context) {
+    if (count <= 0) {
+        return;
+    }
+    // std::thread objects are constructed in place so that a failure to start one
+    // leaves no object behind, and so that the ones already started can be joined.
+    // Destroying a joinable std::thread would call std::terminate().
+    std::thread *threads = NULL;
+    int32_t numStarted = 0;
+    if (count > 1) {
+        threads = static_cast<std::thread *>(uprv_malloc((count - 1) * sizeof(std::thread)));
+    }
+    if (threads != NULL) {
+        try {
+            while (numStarted < (count - 1)) {
+                new(threads + numStarted) std::thread(fn, context, numStarted + 1);
+                ++numStarted;
+            }
+        } catch (const std::exception &) {
+            // std::system_error if no more threads can be created,
+            // or std::bad_alloc. Run the remaining tasks here.
+        }
+    }
+    fn(context, 0);
+    for (int32_t i = numStarted + 1; i < count; ++i) {
+        fn(context, i);
+    }
+    for (int32_t i = 0; i < numStarted; ++i) {
+        threads[i].join();
+        threads[i].~thread();
+    }
+    uprv_free(threads);
+}
+
+U_NAMESPACE_END
@@ -0,0 +1,60 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  uparallel.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Runs a number of independent tasks on several threads,
+*   for the functions that split up large inputs.
+*/
+
+#ifndef UPARALLEL_H
+#define UPARALLEL_H
+
+#include "unicode/utypes.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * One task of a parallelFor() call.
+ * @param context as passed into parallelFor()
+ * @param index task index, 0..count-1
+ * @internal
+ */
+typedef void U_CALLCONV ParallelTaskFn(void *context, int32_t index);
+
+/**
+ * Calls fn(context, index) for each index from 0 to count-1 and returns
+ * when all of these calls have finished.
+ * Task 0 runs on the calling thread, each of the others on a new thread.
+ * If a thread cannot be started, then its task and all later ones
+ * run on the calling thread instead, so the caller need not handle failure.
+ * The tasks must not throw exceptions.
+ * @internal
+ */
+U_COMMON_API void U_EXPORT2
+parallelFor(int32_t count, ParallelTaskFn *fn, void *context);
+
+/** @internal */
+template<typename Task>
+void U_CALLCONV callParallelTask(void *context, int32_t index) {
+    (*static_cast<const Task *>(context))(index);
+}
+
+/**
+ * Calls task(index) for each index from 0 to count-1, concurrently,
+ * like the function-pointer version.
+ * Typically, task is a lambda that captures its inputs and outputs by reference.
+ * @internal
+ */
+template<typename Task>
+inline void parallelFor(int32_t count, const Task &task) {
+    parallelFor(count, callParallelTask<Task>, const_cast<Task *>(&task));
+}
+
+U_NAMESPACE_END
+
+#endif  // UPARALLEL_H
@@ -35,6 +35,7 @@
 #include "unicode/uenum.h"
 #include "uenumimp.h"
 #include "ulocimp.h"
+#include "mutex.h"
 #include "umutex.h"
 #include "putilimp.h"
 #include "uassert.h"
@@ -45,11 +46,23 @@ using namespace icu;
 Static cache for already opened resource bundles - mostly for keeping fallback info
 TODO: This cache should probably be removed when the deprecated code is
       completely removed.
+
+The cache is split into shards by hash code, each with its own mutex which
+guards only the shard's hash table. resbMutex serializes loading bundles
+and linking the fallback chains; it is taken before any shard mutex.
+Reference counts are atomic, so that entryOpenFromCache() and entryClose()
+do not need resbMutex.
 */
-static UHashtable *cache = NULL;
+#define RESB_CACHE_SHARD_COUNT 8
+
+static UHashtable *cache[RESB_CACHE_SHARD_COUNT] = { NULL };
 static icu::UInitOnce gCacheInitOnce;
 
 static UMutex resbMutex = U_MUTEX_INITIALIZER;
+static UMutex cacheMutexes[RESB_CACHE_SHARD_COUNT] = {
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER,
+    U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER, U_MUTEX_INITIALIZER
+};
 
 /* INTERNAL: hashes an entry  */
 static int32_t U_CALLCONV hashEntry(const UHashTok parm) {
@@ -73,6 +86,28 @@ static UBool U_CALLCONV compareEntries(const UHashTok p1, const UHashTok p2) {
         uhash_compareChars(path1, path2));
 }
 
+/* INTERNAL: returns the index of the cache shard for an entry */
+static int32_t cacheShard(const UResourceDataEntry *entry) {
+    UHashTok key;
+    key.pointer = (void *)entry;
+    /* uhash uses the low-order bits, so take the shard index from the high-order bits */
+    return (int32_t)((((uint32_t)hashEntry(key) * 0x9e3779b9u) >> 24) & (RESB_CACHE_SHARD_COUNT - 1));
+}
+
+/* INTERNAL: looks up an entry with the same name and path */
+static UResourceDataEntry *cacheGet(const UResourceDataEntry *find) {
+    int32_t shard = cacheShard(find);
+    Mutex lock(&cacheMutexes[shard]);
+    return (UResourceDataEntry *)uhash_get(cache[shard], find);
+}
+
+/* INTERNAL: adds an entry; there must not yet be one with the same name and path */
+static void cachePut(UResourceDataEntry *entry, UErrorCode *status) {
+    int32_t shard = cacheShard(entry);
+    Mutex lock(&cacheMutexes[shard]);
+    uhash_put(cache[shard], (void *)entry, entry, status);
+}
+
 
 /**
  *  Internal function, gets parts of locale name according 
@@ -93,13 +128,11 @@ static UBool chopLocale(char *name) {
  *  Internal function
  */
 static void entryIncrease(UResourceDataEntry *entry) {
-    umtx_lock(&resbMutex);
-    entry->fCountExisting++;
+    umtx_atomic_inc(&entry->fCountExisting);
     while(entry->fParent != NULL) {
       entry = entry->fParent;
-      entry->fCountExisting++;
+      umtx_atomic_inc(&entry->fCountExisting);
     }
-    umtx_unlock(&resbMutex);
 }
 
 /**
@@ -157,14 +190,14 @@ free_entry(UResourceDataEntry *entry) {
         uprv_free(entry->fPath);
     }
     if(entry->fPool != NULL) {
-        --entry->fPool->fCountExisting;
+        umtx_atomic_dec(&entry->fPool->fCountExisting);
     }
     alias = entry->fAlias;
     if(alias != NULL) {
         while(alias->fAlias != NULL) {
             alias = alias->fAlias;
         }
-        --alias->fCountExisting;
+        umtx_atomic_dec(&alias->fCountExisting);
     }
     uprv_free(entry);
 }
@@ -182,32 +215,42 @@ static int32_t ures_flushCache()
     * return 0
     */
     umtx_lock(&resbMutex);
-    if (cache == NULL) {
+    if (cache[0] == NULL) {
         umtx_unlock(&resbMutex);
         return 0;
     }
 
+    /*
+     * Hold all of the shards so that entryOpenFromCache() cannot revive
+     * an entry, or one of its parents, while we are deleting it.
+     */
+    int32_t shard;
+    for (shard = 0; shard < RESB_CACHE_SHARD_COUNT; ++shard) {
+        umtx_lock(&cacheMutexes[shard]);
+    }
     do {
         deletedMore = FALSE;
-        /*creates an enumeration to iterate through every element in the table */
-        pos = UHASH_FIRST;
-        while ((e = uhash_nextElement(cache, &pos)) != NULL)
-        {
-            resB = (UResourceDataEntry *) e->value.pointer;
-            /* Deletes only if reference counter == 0
-             * Don't worry about the children of this node.
-             * Those will eventually get deleted too, if not already.
-             * Don't worry about the parents of this node.
-             * Those will eventually get deleted too, if not already.
-             */
-            /* 04/05/2002 [weiv] fCountExisting should now be accurate. If it's not zero, that means that    */
-            /* some resource bundles are still open somewhere. */
-
-            if (resB->fCountExisting == 0) {
-                rbDeletedNum++;
-                deletedMore = TRUE;
-                uhash_removeElement(cache, e);
-                free_entry(resB);
+        for (shard = 0; shard < RESB_CACHE_SHARD_COUNT; ++shard) {
+            /*creates an enumeration to iterate through every element in the table */
+            pos = UHASH_FIRST;
+            while ((e = uhash_nextElement(cache[shard], &pos)) != NULL)
+            {
+                resB = (UResourceDataEntry *) e->value.pointer;
+                /* Deletes only if reference counter == 0
+                 * Don't worry about the children of this node.
+                 * Those will eventually get deleted too, if not already.
+                 * Don't worry about the parents of this node.
+                 * Those will eventually get deleted too, if not already.
+                 */
+                /* 04/05/2002 [weiv] fCountExisting should now be accurate. If it's not zero, that means that    */
+                /* some resource bundles are still open somewhere. */
+
+                if (umtx_loadAcquire(resB->fCountExisting) == 0) {
+                    rbDeletedNum++;
+                    deletedMore = TRUE;
+                    uhash_removeElement(cache[shard], e);
+                    free_entry(resB);
+                }
             }
         }
         /*
@@ -215,6 +258,9 @@ static int32_t ures_flushCache()
          * got decremented by free_entry().
          */
     } while(deletedMore);
+    for (shard = RESB_CACHE_SHARD_COUNT - 1; shard >= 0; --shard) {
+        umtx_unlock(&cacheMutexes[shard]);
+    }
     umtx_unlock(&resbMutex);
 
     return rbDeletedNum;
@@ -230,26 +276,32 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
   UResourceDataEntry *resB;
   
     umtx_lock(&resbMutex);
-    if (cache == NULL) {
+    if (cache[0] == NULL) {
       umtx_unlock(&resbMutex);
       fprintf(stderr,"%s:%d: RB Cache is NULL.\n", __FILE__, __LINE__);
       return FALSE;
     }
 
-    while ((e = uhash_nextElement(cache, &pos)) != NULL) {
-      cacheNotEmpty=TRUE;
-      resB = (UResourceDataEntry *) e->value.pointer;
-      fprintf(stderr,"%s:%d: RB Cache: Entry @0x%p, refcount %d, name %s:%s.  Pool 0x%p, alias 0x%p, parent 0x%p\n",
-              __FILE__, __LINE__,
-              (void*)resB, resB->fCountExisting,
-              resB->fName?resB->fName:"NULL",
-              resB->fPath?resB->fPath:"NULL",
-              (void*)resB->fPool,
-              (void*)resB->fAlias,
-              (void*)resB->fParent);       
+    int32_t count = 0;
+    for (int32_t shard = 0; shard < RESB_CACHE_SHARD_COUNT; ++shard) {
+        Mutex lock(&cacheMutexes[shard]);
+        count += uhash_count(cache[shard]);
+        pos = UHASH_FIRST;
+        while ((e = uhash_nextElement(cache[shard], &pos)) != NULL) {
+          cacheNotEmpty=TRUE;
+          resB = (UResourceDataEntry *) e->value.pointer;
+          fprintf(stderr,"%s:%d: RB Cache: Entry @0x%p, refcount %d, name %s:%s.  Pool 0x%p, alias 0x%p, parent 0x%p\n",
+                  __FILE__, __LINE__,
+                  (void*)resB, (int)umtx_loadAcquire(resB->fCountExisting),
+                  resB->fName?resB->fName:"NULL",
+                  resB->fPath?resB->fPath:"NULL",
+                  (void*)resB->fPool,
+                  (void*)resB->fAlias,
+                  (void*)resB->fParent);       
+        }
     }
     
-    fprintf(stderr,"%s:%d: RB Cache still contains %d items.\n", __FILE__, __LINE__, uhash_count(cache));
+    fprintf(stderr,"%s:%d: RB Cache still contains %d items.\n", __FILE__, __LINE__, count);
 
     umtx_unlock(&resbMutex);
     
@@ -260,10 +312,12 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
 
 static UBool U_CALLCONV ures_cleanup(void)
 {
-    if (cache != NULL) {
+    if (cache[0] != NULL) {
         ures_flushCache();
-        uhash_close(cache);
-        cache = NULL;
+        for (int32_t shard = 0; shard < RESB_CACHE_SHARD_COUNT; ++shard) {
+            uhash_close(cache[shard]);
+            cache[shard] = NULL;
+        }
     }
     gCacheInitOnce.reset();
     return TRUE;
@@ -271,8 +325,10 @@ static UBool U_CALLCONV ures_cleanup(void)
 
 /** INTERNAL: Initializes the cache for resources */
 static void U_CALLCONV createCache(UErrorCode &status) {
-    U_ASSERT(cache == NULL);
-    cache = uhash_open(hashEntry, compareEntries, NULL, &status);
+    U_ASSERT(cache[0] == NULL);
+    for (int32_t shard = 0; shard < RESB_CACHE_SHARD_COUNT; ++shard) {
+        cache[shard] = uhash_open(hashEntry, compareEntries, NULL, &status);
+    }
     ucln_common_registerCleanup(UCLN_COMMON_URES, ures_cleanup);
 }
      
@@ -338,7 +394,7 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
     /*hashValue = hashEntry(hashkey);*/
 
     /* check to see if we already have this entry */
-    r = (UResourceDataEntry *)uhash_get(cache, &find);
+    r = cacheGet(&find);
     if(r == NULL) {
         /* if the entry is not yet in the hash table, we'll try to construct a new one */
         r = (UResourceDataEntry *) uprv_malloc(sizeof(UResourceDataEntry));
@@ -347,7 +403,7 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
             return NULL;
         }
 
-        uprv_memset(r, 0, sizeof(UResourceDataEntry));
+        uprv_memset((void *)r, 0, sizeof(UResourceDataEntry));
         /*r->fHashKey = hashValue;*/
 
         setEntryName(r, name, status);
@@ -409,10 +465,10 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
 
         {
             UResourceDataEntry *oldR = NULL;
-            if((oldR = (UResourceDataEntry *)uhash_get(cache, r)) == NULL) { /* if the data is not cached */
+            if((oldR = cacheGet(r)) == NULL) { /* if the data is not cached */
                 /* just insert it in the cache */
                 UErrorCode cacheStatus = U_ZERO_ERROR;
-                uhash_put(cache, (void *)r, r, &cacheStatus);
+                cachePut(r, &cacheStatus);
                 if (U_FAILURE(cacheStatus)) {
                     *status = cacheStatus;
                     free_entry(r);
@@ -432,7 +488,7 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
         while(r->fAlias != NULL) {
             r = r->fAlias;
         }
-        r->fCountExisting++; /* we increase its reference count */
+        umtx_atomic_inc(&r->fCountExisting); /* we increase its reference count */
         /* if the resource has a warning */
         /* we don't want to overwrite a status with no error */
         if(r->fBogus != U_ZERO_ERROR && U_SUCCESS(*status)) {
@@ -477,7 +533,7 @@ findFirstExisting(const char* path, char* name,
             /* not to be used - as there might be parent   */
             /* lines in cache from previous openings that  */
             /* are not updated yet. */
-            r->fCountExisting--;
+            umtx_atomic_dec(&r->fCountExisting);
             /*entryCloseInt(r);*/
             r = NULL;
             *status = U_USING_FALLBACK_WARNING;
@@ -569,7 +625,7 @@ loadParentsExceptRoot(UResourceDataEntry *&t1,
             t1->fParent = t2;
             if (usingUSRData) {
                 // The USR override data wasn't found, set it to be deleted.
-                u2->fCountExisting = 0;
+                umtx_storeRelease(u2->fCountExisting, 0);
             }
         }
         t1 = t2;
@@ -624,6 +680,34 @@ enum UResOpenType {
 };
 typedef enum UResOpenType UResOpenType;
 
+/**
+ * Shortcut for entryOpen() without taking resbMutex:
+ * If the bundle for exactly this locale ID is cached together with its complete
+ * fallback chain, then this increments the reference counts along the chain
+ * and returns the bundle. Otherwise it returns NULL and entryOpen() does the work.
+ */
+static UResourceDataEntry *entryOpenFromCache(const char *path, const char *localeID) {
+    UResourceDataEntry find;
+    find.fName = (char *)(*localeID == 0 ? kRootLocaleName : localeID);
+    find.fPath = (char *)path;
+    int32_t shard = cacheShard(&find);
+    // The shard mutex keeps ures_flushCache() from deleting the entry or its parents
+    // while we increment their reference counts.
+    Mutex lock(&cacheMutexes[shard]);
+    UResourceDataEntry *r = (UResourceDataEntry *)uhash_get(cache[shard], &find);
+    if(r == NULL) {
+        return NULL;
+    }
+    while(r->fAlias != NULL) {
+        r = r->fAlias;
+    }
+    if(r->fBogus != U_ZERO_ERROR || umtx_loadAcquire(r->fHasParentChain) == 0) {
+        return NULL;
+    }
+    entryIncrease(r);
+    return r;
+}
+
 static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
                                      UResOpenType openType, UErrorCode* status) {
     U_ASSERT(openType != URES_OPEN_DIRECT);
@@ -645,6 +729,13 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
         return NULL;
     }
 
+    if(!usingUSRData && uprv_strlen(localeID) < sizeof(name)) {
+        r = entryOpenFromCache(path, localeID);
+        if(r != NULL) {
+            return r;
+        }
+    }
+
     uprv_strncpy(name, localeID, sizeof(name) - 1);
     name[sizeof(name) - 1] = 0;
 
@@ -688,7 +779,7 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
                         r = u1;
                     } else {
                         /* the USR override data wasn't found, set it to be deleted */
-                        u1->fCountExisting = 0;
+                        umtx_storeRelease(u1->fCountExisting, 0);
                     }
                 }
             }
@@ -754,9 +845,15 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
 
         // TODO: Does this ever loop?
         while(r != NULL && !isRoot && t1->fParent != NULL) {
-            t1->fParent->fCountExisting++;
+            umtx_atomic_inc(&t1->fParent->fCountExisting);
             t1 = t1->fParent;
         }
+
+        // The bundle for exactly this locale ID exists and its fallback chain is complete.
+        // Later entryOpen() calls for it can take the entryOpenFromCache() shortcut.
+        if(r != NULL && intStatus == U_ZERO_ERROR && !usingUSRData && U_SUCCESS(*status)) {
+            umtx_storeRelease(r->fHasParentChain, 1);
+        }
     } /* umtx_lock */
 finishUnlock:
     umtx_unlock(&resbMutex);
@@ -789,7 +886,7 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
     UResourceDataEntry *r = init_entry(localeID, path, status);
     if(U_SUCCESS(*status)) {
         if(r->fBogus != U_ZERO_ERROR) {
-            r->fCountExisting--;
+            umtx_atomic_dec(&r->fCountExisting);
             r = NULL;
         }
     } else {
@@ -818,7 +915,7 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
     if(r != NULL) {
         // TODO: Does this ever loop?
         while(t1->fParent != NULL) {
-            t1->fParent->fCountExisting++;
+            umtx_atomic_inc(&t1->fParent->fCountExisting);
             t1 = t1->fParent;
         }
     }
@@ -828,7 +925,6 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
 
 /**
  * Functions to create and destroy resource bundles.
- *     CAUTION:  resbMutex must be locked when calling this function.
  */
 /* INTERNAL: */
 static void entryCloseInt(UResourceDataEntry *resB) {
@@ -836,7 +932,7 @@ static void entryCloseInt(UResourceDataEntry *resB) {
 
     while(resB != NULL) {
         p = resB->fParent;
-        resB->fCountExisting--;
+        umtx_atomic_dec(&resB->fCountExisting);
 
         /* Entries are left in the cache. TODO: add ures_flushCache() to force a flush
          of the cache. */
@@ -865,9 +961,7 @@ static void entryCloseInt(UResourceDataEntry *resB) {
  */
 
 static void entryClose(UResourceDataEntry *resB) {
-  umtx_lock(&resbMutex);
   entryCloseInt(resB);
-  umtx_unlock(&resbMutex);
 }
 
 /*
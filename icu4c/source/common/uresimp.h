@@ -14,6 +14,9 @@
 #include "unicode/utypes.h"
 
 #include "uresdata.h"
+#ifdef __cplusplus
+#include "umutex.h"
+#endif
 
 #define kRootLocaleName         "root"
 #define kPoolBundleName         "pool"
@@ -52,7 +55,15 @@ struct UResourceDataEntry {
     UResourceDataEntry *fPool;
     ResourceData fData; /* data for low level access */
     char fNameBuffer[3]; /* A small buffer of free space for fName. The free space is due to struct padding. */
-    uint32_t fCountExisting; /* how much is this resource used */
+#ifdef __cplusplus
+    /* Atomic so that bundles can be opened from the cache and closed without a global lock. */
+    icu::u_atomic_int32_t fCountExisting; /* how much is this resource used */
+    /* Nonzero once entryOpen() has built the complete fallback chain for this exact entry. */
+    icu::u_atomic_int32_t fHasParentChain;
+#else
+    int32_t fCountExisting;
+    int32_t fHasParentChain;
+#endif
     UErrorCode fBogus;
     /* int32_t fHashKey;*/ /* for faster access in the hashtable */
 };
@@ -0,0 +1,586 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  usimd.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+* Bulk kernels for skipping and copying runs of "trivial" code units,
+* most importantly ASCII.
+* They use SSE2 or AArch64 NEON when available (see U_HAVE_SSE2 and U_HAVE_NEON
+* in putilimp.h) and otherwise plain loops which compilers may auto-vectorize.
+*
+* Each function looks at most at length code units, stops at the first unit
+* that does not qualify, and returns the number of qualifying units before it.
+* The callers continue with their regular per-character code from there,
+* so error handling and all other semantics are unaffected.
+*/
+
+#ifndef __USIMD_H__
+#define __USIMD_H__
+
+#include "unicode/utypes.h"
+#include "putilimp.h"
+
+#if U_HAVE_SSE2
+#include <emmintrin.h>
+#elif U_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
+/**
+ * Returns the length of the initial run of ASCII bytes (00..7F).
+ * @internal
+ */
+static inline int32_t
+usimd_spanASCII(const uint8_t *s, int32_t length) {
+    int32_t i=0;
+#if U_HAVE_SSE2
+    for(; (length-i)>=16; i+=16) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(s+i));
+        if(_mm_movemask_epi8(v)!=0) {
+            break;
+        }
+    }
+#elif U_HAVE_NEON
+    for(; (length-i)>=16; i+=16) {
+        if(vmaxvq_u8(vld1q_u8(s+i))>=0x80) {
+            break;
+        }
+    }
+#endif
+    while(i<length && s[i]<0x80) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns the length of the initial run of bytes that are less than limit.
+ * limit must be at least 1.
+ * @internal
+ */
+static inline int32_t
+usimd_spanBytesBelow(const uint8_t *s, int32_t length, uint8_t limit) {
+    int32_t i=0;
+#if U_HAVE_SSE2
+    // b<limit exactly when min(b, limit-1)==b, with unsigned byte minimum.
+    const __m128i max=_mm_set1_epi8((char)(limit-1));
+    for(; (length-i)>=16; i+=16) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(s+i));
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(v, max), v))!=0xffff) {
+            break;
+        }
+    }
+#elif U_HAVE_NEON
+    for(; (length-i)>=16; i+=16) {
+        if(vmaxvq_u8(vld1q_u8(s+i))>=limit) {
+            break;
+        }
+    }
+#endif
+    while(i<length && s[i]<limit) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns the length of the initial run of UChars that are less than limit.
+ * limit must be at least 1.
+ * @internal
+ */
+static inline int32_t
+usimd_spanUCharsBelow(const UChar *s, int32_t length, UChar limit) {
+    int32_t i=0;
+#if U_HAVE_SSE2
+    // SSE2 has only signed 16-bit comparisons: flip the sign bits on both sides.
+    const __m128i bias=_mm_set1_epi16((short)0x8000);
+    const __m128i biasedLimit=_mm_set1_epi16((short)(limit^0x8000));
+    for(; (length-i)>=8; i+=8) {
+        __m128i v=_mm_xor_si128(_mm_loadu_si128((const __m128i *)(s+i)), bias);
+        if(_mm_movemask_epi8(_mm_cmplt_epi16(v, biasedLimit))!=0xffff) {
+            break;
+        }
+    }
+#elif U_HAVE_NEON
+    for(; (length-i)>=8; i+=8) {
+        if(vmaxvq_u16(vld1q_u16((const uint16_t *)(s+i)))>=limit) {
+            break;
+        }
+    }
+#endif
+    while(i<length && s[i]<limit) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Copies the initial run of ASCII bytes to dest, widening each byte to a UChar.
+ * dest must have room for length UChars.
+ * @return the number of bytes/UChars copied
+ * @internal
+ */
+static inline int32_t
+usimd_widenASCII(const uint8_t *src, int32_t length, UChar *dest) {
+    int32_t i=0;
+#if U_HAVE_SSE2
+    const __m128i zero=_mm_setzero_si128();
+    for(; (length-i)>=16; i+=16) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(src+i));
+        if(_mm_movemask_epi8(v)!=0) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest+i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(dest+i+8), _mm_unpackhi_epi8(v, zero));
+    }
+#elif U_HAVE_NEON
+    for(; (length-i)>=16; i+=16) {
+        uint8x16_t v=vld1q_u8(src+i);
+        if(vmaxvq_u8(v)>=0x80) {
+            break;
+        }
+        vst1q_u16((uint16_t *)(dest+i), vmovl_u8(vget_low_u8(v)));
+        vst1q_u16((uint16_t *)(dest+i+8), vmovl_u8(vget_high_u8(v)));
+    }
+#endif
+    uint8_t b;
+    while(i<length && (b=src[i])<0x80) {
+        dest[i++]=b;
+    }
+    return i;
+}
+
+/**
+ * Copies the initial run of ASCII UChars (U+0000..U+007F) to dest, one byte each.
+ * dest must have room for length bytes.
+ * @return the number of UChars/bytes copied
+ * @internal
+ */
+static inline int32_t
+usimd_narrowASCII(const UChar *src, int32_t length, uint8_t *dest) {
+    int32_t i=0;
+#if U_HAVE_SSE2
+    const __m128i nonASCII=_mm_set1_epi16((short)0xff80);
+    const __m128i zero=_mm_setzero_si128();
+    for(; (length-i)>=16; i+=16) {
+        __m128i lo=_mm_loadu_si128((const __m128i *)(src+i));
+        __m128i hi=_mm_loadu_si128((const __m128i *)(src+i+8));
+        __m128i high=_mm_and_si128(_mm_or_si128(lo, hi), nonASCII);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero))!=0xffff) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest+i), _mm_packus_epi16(lo, hi));
+    }
+#elif U_HAVE_NEON
+    for(; (length-i)>=16; i+=16) {
+        uint16x8_t lo=vld1q_u16((const uint16_t *)(src+i));
+        uint16x8_t hi=vld1q_u16((const uint16_t *)(src+i+8));
+        if(vmaxvq_u16(vorrq_u16(lo, hi))>=0x80) {
+            break;
+        }
+        vst1q_u8(dest+i, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+    }
+#endif
+    UChar c;
+    while(i<length && (c=src[i])<0x80) {
+        dest[i++]=(uint8_t)c;
+    }
+    return i;
+}
+
+/** Maximum number of ranges in a USimdRanges. @internal */
+#define USIMD_MAX_RANGES 8
+
+/**
+ * Up to USIMD_MAX_RANGES ranges of code points below a limit,
+ * for the range span functions below.
+ * A code point c qualifies if c<limit and whether it is in one of the ranges
+ * matches the inRanges parameter of those functions.
+ * @internal
+ */
+typedef struct USimdRanges {
+    /** Number of ranges, or -1 if the ranges are not used. */
+    int32_t count;
+    /** Code points at or above limit never qualify. 1..0x800 */
+    uint16_t limit;
+    /** Range i is starts[i]..starts[i]+deltas[i]. */
+    uint16_t starts[USIMD_MAX_RANGES];
+    uint16_t deltas[USIMD_MAX_RANGES];
+} USimdRanges;
+
+/**
+ * 1 if the range span functions below work on whole vectors,
+ * 0 if they always return 0 on this platform.
+ * @internal
+ */
+#if U_HAVE_SSE2 || U_HAVE_NEON
+#   define USIMD_HAVE_RANGE_SPANS 1
+#else
+#   define USIMD_HAVE_RANGE_SPANS 0
+#endif
+
+#if U_HAVE_SSE2
+
+// The ranges of a USimdRanges broadcast into vectors once per span call,
+// rather than once per vector, because the ranges are not compile-time constants.
+typedef struct USimdRangeVectors {
+    int32_t count;
+    __m128i max;
+    __m128i starts[USIMD_MAX_RANGES];
+    __m128i deltas[USIMD_MAX_RANGES];
+} USimdRangeVectors;
+
+static inline void
+usimd_initRangeVectors16(USimdRangeVectors *rv, const USimdRanges *r) {
+    rv->count=r->count;
+    rv->max=_mm_set1_epi16((short)(r->limit-1));
+    for(int32_t k=0; k<r->count; ++k) {
+        rv->starts[k]=_mm_set1_epi16((short)r->starts[k]);
+        rv->deltas[k]=_mm_set1_epi16((short)r->deltas[k]);
+    }
+}
+
+static inline void
+usimd_initRangeVectors8(USimdRangeVectors *rv, const USimdRanges *r) {
+    rv->count=r->count;
+    rv->max=_mm_set1_epi8((char)(r->limit-1));
+    for(int32_t k=0; k<r->count; ++k) {
+        rv->starts[k]=_mm_set1_epi8((char)r->starts[k]);
+        rv->deltas[k]=_mm_set1_epi8((char)r->deltas[k]);
+    }
+}
+
+// Lane-wise "qualifies" masks for the range span functions.
+// start<=x<=start+delta exactly when the unsigned saturating (x-start)-delta is 0.
+static inline __m128i
+usimd_qualify16(__m128i v, const USimdRangeVectors *rv, UBool inRanges) {
+    const __m128i zero=_mm_setzero_si128();
+    __m128i in=zero;
+    for(int32_t k=0; k<rv->count; ++k) {
+        __m128i d=_mm_subs_epu16(_mm_sub_epi16(v, rv->starts[k]), rv->deltas[k]);
+        in=_mm_or_si128(in, _mm_cmpeq_epi16(d, zero));
+    }
+    __m128i below=_mm_cmpeq_epi16(_mm_subs_epu16(v, rv->max), zero);
+    return inRanges ? _mm_and_si128(below, in) : _mm_andnot_si128(in, below);
+}
+
+static inline __m128i
+usimd_qualify8(__m128i v, const USimdRangeVectors *rv, UBool inRanges) {
+    const __m128i zero=_mm_setzero_si128();
+    __m128i in=zero;
+    for(int32_t k=0; k<rv->count; ++k) {
+        __m128i d=_mm_subs_epu8(_mm_sub_epi8(v, rv->starts[k]), rv->deltas[k]);
+        in=_mm_or_si128(in, _mm_cmpeq_epi8(d, zero));
+    }
+    __m128i below=_mm_cmpeq_epi8(_mm_subs_epu8(v, rv->max), zero);
+    return inRanges ? _mm_and_si128(below, in) : _mm_andnot_si128(in, below);
+}
+
+// Reads 16 bytes as 8 two-byte UTF-8 sequences (lead byte in the low half of each lane).
+// Returns the decoded code points, and sets valid to all-ones for well-formed pairs.
+static inline __m128i
+usimd_decodeTwoBytes(const uint8_t *s, __m128i *valid) {
+    const __m128i zero=_mm_setzero_si128();
+    const __m128i low6=_mm_set1_epi16(0x3f);
+    __m128i w=_mm_loadu_si128((const __m128i *)s);
+    __m128i lead=_mm_and_si128(w, _mm_set1_epi16(0xff));
+    __m128i trail=_mm_srli_epi16(w, 8);
+    // lead C2..DF, trail 80..BF
+    *valid=_mm_and_si128(
+        _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(lead, _mm_set1_epi16(0xc2)),
+                                       _mm_set1_epi16(0xdf-0xc2)), zero),
+        _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(trail, _mm_set1_epi16(0x80)), low6), zero));
+    return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(lead, _mm_set1_epi16(0x1f)), 6),
+                        _mm_and_si128(trail, low6));
+}
+
+#define USIMD_ALL_LANES(mask) (_mm_movemask_epi8(mask)==0xffff)
+
+#elif U_HAVE_NEON
+
+typedef struct USimdRangeVectors16 {
+    int32_t count;
+    uint16x8_t limit;
+    uint16x8_t starts[USIMD_MAX_RANGES];
+    uint16x8_t deltas[USIMD_MAX_RANGES];
+} USimdRangeVectors16;
+
+typedef struct USimdRangeVectors8 {
+    int32_t count;
+    uint8x16_t limit;
+    uint8x16_t starts[USIMD_MAX_RANGES];
+    uint8x16_t deltas[USIMD_MAX_RANGES];
+} USimdRangeVectors8;
+
+static inline void
+usimd_initRangeVectors16(USimdRangeVectors16 *rv, const USimdRanges *r) {
+    rv->count=r->count;
+    rv->limit=vdupq_n_u16(r->limit);
+    for(int32_t k=0; k<r->count; ++k) {
+        rv->starts[k]=vdupq_n_u16(r->starts[k]);
+        rv->deltas[k]=vdupq_n_u16(r->deltas[k]);
+    }
+}
+
+static inline void
+usimd_initRangeVectors8(USimdRangeVectors8 *rv, const USimdRanges *r) {
+    rv->count=r->count;
+    rv->limit=vdupq_n_u8((uint8_t)r->limit);
+    for(int32_t k=0; k<r->count; ++k) {
+        rv->starts[k]=vdupq_n_u8((uint8_t)r->starts[k]);
+        rv->deltas[k]=vdupq_n_u8((uint8_t)r->deltas[k]);
+    }
+}
+
+static inline uint16x8_t
+usimd_qualify16(uint16x8_t v, const USimdRangeVectors16 *rv, UBool inRanges) {
+    uint16x8_t in=vdupq_n_u16(0);
+    for(int32_t k=0; k<rv->count; ++k) {
+        uint16x8_t d=vqsubq_u16(vsubq_u16(v, rv->starts[k]), rv->deltas[k]);
+        in=vorrq_u16(in, vceqzq_u16(d));
+    }
+    uint16x8_t below=vcltq_u16(v, rv->limit);
+    return inRanges ? vandq_u16(below, in) : vbicq_u16(below, in);
+}
+
+static inline uint8x16_t
+usimd_qualify8(uint8x16_t v, const USimdRangeVectors8 *rv, UBool inRanges) {
+    uint8x16_t in=vdupq_n_u8(0);
+    for(int32_t k=0; k<rv->count; ++k) {
+        uint8x16_t d=vqsubq_u8(vsubq_u8(v, rv->starts[k]), rv->deltas[k]);
+        in=vorrq_u8(in, vceqzq_u8(d));
+    }
+    uint8x16_t below=vcltq_u8(v, rv->limit);
+    return inRanges ? vandq_u8(below, in) : vbicq_u8(below, in);
+}
+
+static inline uint16x8_t
+usimd_decodeTwoBytes(const uint8_t *s, uint16x8_t *valid) {
+    uint16x8_t w=vreinterpretq_u16_u8(vld1q_u8(s));
+    uint16x8_t lead=vandq_u16(w, vdupq_n_u16(0xff));
+    uint16x8_t trail=vshrq_n_u16(w, 8);
+    *valid=vandq_u16(
+        vceqzq_u16(vqsubq_u16(vsubq_u16(lead, vdupq_n_u16(0xc2)), vdupq_n_u16(0xdf-0xc2))),
+        vceqzq_u16(vqsubq_u16(vsubq_u16(trail, vdupq_n_u16(0x80)), vdupq_n_u16(0x3f))));
+    return vorrq_u16(vshlq_n_u16(vandq_u16(lead, vdupq_n_u16(0x1f)), 6),
+                     vandq_u16(trail, vdupq_n_u16(0x3f)));
+}
+
+#endif
+
+/*
+ * The range span functions look only at whole vectors:
+ * They return the number of code units in the initial (or trailing) vectors
+ * in which all code points qualify, and leave partial vectors to the caller.
+ * They never consume surrogates or code points at or above r->limit.
+ */
+
+/**
+ * Returns the length of the initial run of whole 8-UChar vectors
+ * where each UChar qualifies according to r and inRanges.
+ * @internal
+ */
+static inline int32_t
+usimd_spanUCharsInRanges(const UChar *s, int32_t length, const USimdRanges *r, UBool inRanges) {
+    int32_t i=0;
+#if U_HAVE_SSE2
+    USimdRangeVectors rv;
+    usimd_initRangeVectors16(&rv, r);
+    for(; (length-i)>=8; i+=8) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(s+i));
+        if(!USIMD_ALL_LANES(usimd_qualify16(v, &rv, inRanges))) {
+            break;
+        }
+    }
+#elif U_HAVE_NEON
+    USimdRangeVectors16 rv;
+    usimd_initRangeVectors16(&rv, r);
+    for(; (length-i)>=8; i+=8) {
+        uint16x8_t v=vld1q_u16((const uint16_t *)(s+i));
+        if(vminvq_u16(usimd_qualify16(v, &rv, inRanges))==0) {
+            break;
+        }
+    }
+#else
+    (void)s; (void)length; (void)r; (void)inRanges;
+#endif
+    return i;
+}
+
+/**
+ * Returns the length of the trailing run of whole 8-UChar vectors
+ * where each UChar qualifies according to r and inRanges.
+ * @internal
+ */
+static inline int32_t
+usimd_spanBackUCharsInRanges(const UChar *s, int32_t length, const USimdRanges *r, UBool inRanges) {
+    int32_t i=length;
+#if U_HAVE_SSE2
+    USimdRangeVectors rv;
+    usimd_initRangeVectors16(&rv, r);
+    for(; i>=8; i-=8) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(s+i-8));
+        if(!USIMD_ALL_LANES(usimd_qualify16(v, &rv, inRanges))) {
+            break;
+        }
+    }
+#elif U_HAVE_NEON
+    USimdRangeVectors16 rv;
+    usimd_initRangeVectors16(&rv, r);
+    for(; i>=8; i-=8) {
+        uint16x8_t v=vld1q_u16((const uint16_t *)(s+i-8));
+        if(vminvq_u16(usimd_qualify16(v, &rv, inRanges))==0) {
+            break;
+        }
+    }
+#else
+    (void)s; (void)r; (void)inRanges;
+#endif
+    return length-i;
+}
+
+/**
+ * Returns the length of the initial run of whole 16-byte vectors
+ * where each byte qualifies according to r and inRanges.
+ * r->limit must be at most 0x80.
+ * @internal
+ */
+static inline int32_t
+usimd_spanBytesInRanges(const uint8_t *s, int32_t length, const USimdRanges *r, UBool inRanges) {
+    int32_t i=0;
+#if U_HAVE_SSE2
+    USimdRangeVectors rv;
+    usimd_initRangeVectors8(&rv, r);
+    for(; (length-i)>=16; i+=16) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(s+i));
+        if(!USIMD_ALL_LANES(usimd_qualify8(v, &rv, inRanges))) {
+            break;
+        }
+    }
+#elif U_HAVE_NEON
+    USimdRangeVectors8 rv;
+    usimd_initRangeVectors8(&rv, r);
+    for(; (length-i)>=16; i+=16) {
+        if(vminvq_u8(usimd_qualify8(vld1q_u8(s+i), &rv, inRanges))==0) {
+            break;
+        }
+    }
+#else
+    (void)s; (void)length; (void)r; (void)inRanges;
+#endif
+    return i;
+}
+
+/**
+ * Returns the length of the trailing run of whole 16-byte vectors
+ * where each byte qualifies according to r and inRanges.
+ * r->limit must be at most 0x80.
+ * @internal
+ */
+static inline int32_t
+usimd_spanBackBytesInRanges(const uint8_t *s, int32_t length, const USimdRanges *r, UBool inRanges) {
+    int32_t i=length;
+#if U_HAVE_SSE2
+    USimdRangeVectors rv;
+    usimd_initRangeVectors8(&rv, r);
+    for(; i>=16; i-=16) {
+        __m128i v=_mm_loadu_si128((const __m128i *)(s+i-16));
+        if(!USIMD_ALL_LANES(usimd_qualify8(v, &rv, inRanges))) {
+            break;
+        }
+    }
+#elif U_HAVE_NEON
+    USimdRangeVectors8 rv;
+    usimd_initRangeVectors8(&rv, r);
+    for(; i>=16; i-=16) {
+        if(vminvq_u8(usimd_qualify8(vld1q_u8(s+i-16), &rv, inRanges))==0) {
+            break;
+        }
+    }
+#else
+    (void)s; (void)r; (void)inRanges;
+#endif
+    return length-i;
+}
+
+/**
+ * Returns the length of the initial run of whole 16-byte vectors
+ * which consist of well-formed two-byte UTF-8 sequences (U+0080..U+07FF)
+ * whose code points qualify according to r and inRanges.
+ * s must start at a character boundary.
+ * @internal
+ */
+static inline int32_t
+usimd_spanUTF8TwoBytesInRanges(const uint8_t *s, int32_t length,
+                               const USimdRanges *r, UBool inRanges) {
+    int32_t i=0;
+#if U_HAVE_SSE2
+    USimdRangeVectors rv;
+    usimd_initRangeVectors16(&rv, r);
+    for(; (length-i)>=16; i+=16) {
+        __m128i valid;
+        __m128i c=usimd_decodeTwoBytes(s+i, &valid);
+        if(!USIMD_ALL_LANES(_mm_and_si128(valid, usimd_qualify16(c, &rv, inRanges)))) {
+            break;
+        }
+    }
+#elif U_HAVE_NEON
+    USimdRangeVectors16 rv;
+    usimd_initRangeVectors16(&rv, r);
+    for(; (length-i)>=16; i+=16) {
+        uint16x8_t valid;
+        uint16x8_t c=usimd_decodeTwoBytes(s+i, &valid);
+        if(vminvq_u16(vandq_u16(valid, usimd_qualify16(c, &rv, inRanges)))==0) {
+            break;
+        }
+    }
+#else
+    (void)s; (void)length; (void)r; (void)inRanges;
+#endif
+    return i;
+}
+
+/**
+ * Returns the length of the trailing run of whole 16-byte vectors
+ * which consist of well-formed two-byte UTF-8 sequences (U+0080..U+07FF)
+ * whose code points qualify according to r and inRanges.
+ * s+length must be at a character boundary.
+ * Lead bytes are never trail bytes, so a vector of eight well-formed pairs
+ * ending at a boundary is read the same as when going forward.
+ * @internal
+ */
+static inline int32_t
+usimd_spanBackUTF8TwoBytesInRanges(const uint8_t *s, int32_t length,
+                                   const USimdRanges *r, UBool inRanges) {
+    int32_t i=length;
+#if U_HAVE_SSE2
+    USimdRangeVectors rv;
+    usimd_initRangeVectors16(&rv, r);
+    for(; i>=16; i-=16) {
+        __m128i valid;
+        __m128i c=usimd_decodeTwoBytes(s+i-16, &valid);
+        if(!USIMD_ALL_LANES(_mm_and_si128(valid, usimd_qualify16(c, &rv, inRanges)))) {
+            break;
+        }
+    }
+#elif U_HAVE_NEON
+    USimdRangeVectors16 rv;
+    usimd_initRangeVectors16(&rv, r);
+    for(; i>=16; i-=16) {
+        uint16x8_t valid;
+        uint16x8_t c=usimd_decodeTwoBytes(s+i-16, &valid);
+        if(vminvq_u16(vandq_u16(valid, usimd_qualify16(c, &rv, inRanges)))==0) {
+            break;
+        }
+    }
+#else
+    (void)s; (void)r; (void)inRanges;
+#endif
+    return length-i;
+}
+
+#endif
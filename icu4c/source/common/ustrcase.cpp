@@ -30,10 +30,13 @@
 #include "unicode/ubrk.h"
 #include "unicode/utf.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "ucase.h"
 #include "ucasemap_imp.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 #include "uassert.h"
 
 U_NAMESPACE_BEGIN
@@ -215,7 +218,9 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
     const UTrie2 *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = srcStart;
-    int32_t srcIndex = srcStart;
+    // Many strings are all or mostly ASCII/Latin-1 that does not change.
+    int32_t srcIndex = srcStart + usimd_spanUCharsInRanges(src + srcStart, srcLimit - srcStart,
+                                                           &LatinCase::LOWER_UNCHANGED, TRUE);
     for (;;) {
         // fast path for simple cases
         UChar lead = 0;
@@ -226,7 +231,14 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
                 int8_t d = latinToLower[lead];
                 if (d == LatinCase::EXC) { break; }
                 ++srcIndex;
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    if (((srcIndex - prev) & 0xf) == 0) {
+                        // Long run of unchanged text: Skip whole vectors of it.
+                        srcIndex += usimd_spanUCharsInRanges(src + srcIndex, srcLimit - srcIndex,
+                                                             &LatinCase::LOWER_UNCHANGED, TRUE);
+                    }
+                    continue;
+                }
                 delta = d;
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
@@ -310,7 +322,8 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
     const UTrie2 *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = 0;
-    int32_t srcIndex = 0;
+    // Many strings are all or mostly ASCII/Latin-1 that does not change.
+    int32_t srcIndex = usimd_spanUCharsInRanges(src, srcLength, &LatinCase::UPPER_UNCHANGED, TRUE);
     for (;;) {
         // fast path for simple cases
         UChar lead = 0;
@@ -321,7 +334,14 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
                 int8_t d = latinToUpper[lead];
                 if (d == LatinCase::EXC) { break; }
                 ++srcIndex;
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    if (((srcIndex - prev) & 0xf) == 0) {
+                        // Long run of unchanged text: Skip whole vectors of it.
+                        srcIndex += usimd_spanUCharsInRanges(src + srcIndex, srcLength - srcIndex,
+                                                             &LatinCase::UPPER_UNCHANGED, TRUE);
+                    }
+                    continue;
+                }
                 delta = d;
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
@@ -1371,6 +1391,16 @@ U_NAMESPACE_END
  * the normalization code.
  */
 
+/**
+ * Latin-1 and Latin Extended-A characters below U+017F case-fold
+ * like they lowercase, except for LatinCase::EXC.
+ * See the fast path in toLower() above.
+ */
+static inline const int8_t *getLatinToFold(uint32_t options) {
+    return (options & _FOLD_CASE_OPTIONS_MASK) == U_FOLD_CASE_DEFAULT ?
+        LatinCase::TO_LOWER_NORMAL : LatinCase::TO_LOWER_TR_LT;
+}
+
 /* stack element for previous-level source/decomposition pointers */
 struct CmpEquivLevel {
     const UChar *start, *s, *limit;
@@ -1424,6 +1454,8 @@ static int32_t _cmpFold(
     /* current code units, and code points for lookups */
     UChar32 c1, c2, cp1, cp2;
 
+    const int8_t *latinToFold=getLatinToFold(options);
+
     /* no argument error checking because this itself is not an API */
 
     /*
@@ -1572,6 +1604,28 @@ static int32_t _cmpFold(
         }
         /* c1!=c2 && c1>=0 && c2>=0 */
 
+        /*
+         * Fast path (not in unorm_cmpEquivFold()):
+         * Most differences are between Latin letters that case-fold to single code units.
+         * Compare their foldings directly rather than going down a level for each.
+         */
+        if(level1==0 && level2==0 && c1<LatinCase::LONG_S && c2<LatinCase::LONG_S) {
+            int32_t d1=latinToFold[c1], d2=latinToFold[c2];
+            if(d1!=LatinCase::EXC && d2!=LatinCase::EXC) {
+                c1+=d1;
+                c2+=d2;
+                if(c1!=c2) {
+                    cmpRes=c1-c2;
+                    break;
+                }
+                /* both code points are fully consumed */
+                m1=s1;
+                m2=s2;
+                c1=c2=-1;
+                continue;
+            }
+        }
+
         /* get complete code points for c1, c2 for lookups if either is a surrogate */
         cp1=c1;
         if(U_IS_SURROGATE(c1)) {
@@ -1816,3 +1870,176 @@ u_caseInsensitivePrefixMatch(const UChar *s1, int32_t length1,
     _cmpFold(s1, length1, s2, length2, options,
         matchLen1, matchLen2, pErrorCode);
 }
+
+/* case-insensitive hashing and UTF-8 comparison ---------------------------- */
+
+/*
+ * These fold one code point at a time and read multi-code point foldings
+ * directly from the ucase data, so that they never allocate or copy.
+ */
+
+namespace {
+
+inline uint32_t hashUChar(uint32_t hash, UChar c) {
+    return hash * 37 + c;  // same as STRING_HASH() in ustring.cpp
+}
+
+/** Adds the UTF-16 code units of the case folding of c to the hash. */
+uint32_t hashFolding(uint32_t hash, UChar32 c, uint32_t options) {
+    const UChar *p;
+    int32_t result = ucase_toFullFolding(c, &p, options);
+    if (result < 0) {
+        c = ~result;
+    } else if (result <= UCASE_MAX_STRING_LENGTH) {
+        for (int32_t i = 0; i < result; ++i) {
+            hash = hashUChar(hash, p[i]);
+        }
+        return hash;
+    } else {
+        c = result;
+    }
+    if (c <= 0xffff) {
+        return hashUChar(hash, (UChar)c);
+    }
+    return hashUChar(hashUChar(hash, U16_LEAD(c)), U16_TRAIL(c));
+}
+
+/**
+ * Returns the case folding of a UTF-8 string one code point at a time.
+ * Ill-formed sequences are returned as U+FFFD.
+ */
+class UTF8FoldingIterator {
+public:
+    UTF8FoldingIterator(const uint8_t *s, int32_t start, int32_t length, uint32_t options) :
+            s(s), index(start), length(length), options(options),
+            latinToFold(getLatinToFold(options)),
+            fold(nullptr), foldIndex(0), foldLength(0) {}
+
+    /** @return the next code point of the case folding, or U_SENTINEL at the end */
+    UChar32 next() {
+        UChar32 c;
+        if (foldIndex < foldLength) {
+            U16_NEXT_UNSAFE(fold, foldIndex, c);
+            return c;
+        }
+        for (;;) {
+            if (index >= length) {
+                return U_SENTINEL;
+            }
+            c = s[index];
+            if (c <= 0x7f) {
+                ++index;
+                int8_t d = latinToFold[c];
+                if (d != LatinCase::EXC) {
+                    return c + d;
+                }
+            } else {
+                U8_NEXT_OR_FFFD(s, index, length, c);
+            }
+            int32_t result = ucase_toFullFolding(c, &fold, options);
+            if (result < 0) {
+                return c;
+            } else if (result > UCASE_MAX_STRING_LENGTH) {
+                return result;
+            } else if (result > 0) {
+                foldIndex = 0;
+                foldLength = result;
+                U16_NEXT_UNSAFE(fold, foldIndex, c);
+                return c;
+            }
+        }
+    }
+
+private:
+    const uint8_t *s;
+    int32_t index, length;
+    uint32_t options;
+    const int8_t *latinToFold;
+    const UChar *fold;
+    int32_t foldIndex, foldLength;
+};
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+u_strcmpFoldUTF8(const char *s1, int32_t length1,
+                 const char *s2, int32_t length2,
+                 uint32_t options,
+                 UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(length1<0) {
+        length1=(int32_t)uprv_strlen(s1);
+    }
+    if(length2<0) {
+        length2=(int32_t)uprv_strlen(s2);
+    }
+    // Skip the identical prefix, which folds the same,
+    // but back up to where both strings start a new character:
+    // U8_NEXT() never consumes a non-trail byte as part of an earlier sequence.
+    int32_t start=0;
+    int32_t minLength=length1<length2 ? length1 : length2;
+    while(start<minLength && s1[start]==s2[start]) {
+        ++start;
+    }
+    while(start>0 &&
+            ((start<length1 && U8_IS_TRAIL(s1[start])) ||
+             (start<length2 && U8_IS_TRAIL(s2[start])))) {
+        --start;
+    }
+    UTF8FoldingIterator iter1((const uint8_t *)s1, start, length1, options);
+    UTF8FoldingIterator iter2((const uint8_t *)s2, start, length2, options);
+    for(;;) {
+        UChar32 c1=iter1.next();
+        UChar32 c2=iter2.next();
+        if(c1!=c2) {
+            return c1-c2;
+        } else if(c1<0) {
+            return 0;
+        }
+    }
+}
+
+U_CAPI int32_t U_EXPORT2
+ustr_hashFoldUCharsN(const UChar *s, int32_t length, uint32_t options) {
+    const int8_t *latinToFold = getLatinToFold(options);
+    uint32_t hash = 0;
+    for (int32_t i = 0; i < length;) {
+        UChar32 c = s[i++];
+        if (c < LatinCase::LONG_S) {
+            int8_t d = latinToFold[c];
+            if (d != LatinCase::EXC) {
+                hash = hashUChar(hash, (UChar)(c + d));
+                continue;
+            }
+        } else if (U16_IS_LEAD(c) && i < length && U16_IS_TRAIL(s[i])) {
+            c = U16_GET_SUPPLEMENTARY(c, s[i]);
+            ++i;
+        }
+        hash = hashFolding(hash, c, options);
+    }
+    return (int32_t)hash;
+}
+
+U_CAPI int32_t U_EXPORT2
+ustr_hashFoldUTF8N(const char *s, int32_t length, uint32_t options) {
+    const uint8_t *s8 = (const uint8_t *)s;
+    const int8_t *latinToFold = getLatinToFold(options);
+    uint32_t hash = 0;
+    for (int32_t i = 0; i < length;) {
+        UChar32 c = s8[i];
+        if (c <= 0x7f) {
+            ++i;
+            int8_t d = latinToFold[c];
+            if (d != LatinCase::EXC) {
+                hash = hashUChar(hash, (UChar)(c + d));
+                continue;
+            }
+        } else {
+            U8_NEXT_OR_FFFD(s8, i, length, c);
+        }
+        hash = hashFolding(hash, c, options);
+    }
+    return (int32_t)hash;
+}
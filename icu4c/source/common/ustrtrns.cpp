@@ -35,6 +35,7 @@
 #include "cmemory.h"
 #include "ustr_imp.h"
 #include "uassert.h"
+#include "usimd.h"
 
 U_CAPI UChar* U_EXPORT2 
 u_strFromUTF32WithSub(UChar *dest,
@@ -403,6 +404,14 @@ u_strFromUTF8WithSub(UChar *dest,
                 c = (uint8_t)src[i++];
                 if(U8_IS_SINGLE(c)) {
                     *pDest++=(UChar)c;
+                    if(count > 16 && U8_IS_SINGLE(src[i])) {
+                        // Widen a run of ASCII in bulk.
+                        // Each ASCII byte takes one of the remaining count iterations.
+                        int32_t n = usimd_widenASCII((const uint8_t *)src + i, count - 1, pDest);
+                        i += n;
+                        pDest += n;
+                        count -= n;
+                    }
                 } else {
                     uint8_t __t1, __t2;
                     if( /* handle U+0800..U+FFFF inline */
@@ -491,7 +500,9 @@ u_strFromUTF8WithSub(UChar *dest,
             // modified copy of U8_NEXT()
             c = (uint8_t)src[i++];
             if(U8_IS_SINGLE(c)) {
-                ++reqLength;
+                int32_t n = usimd_spanASCII((const uint8_t *)src + i, srcLength - i);
+                i += n;
+                reqLength += 1 + n;
             } else {
                 uint8_t __t1, __t2;
                 if( /* handle U+0800..U+FFFF inline */
@@ -921,6 +932,13 @@ u_strToUTF8WithSub(char *dest,
                 ch=*pSrc++;
                 if(ch <= 0x7f) {
                     *pDest++ = (uint8_t)ch;
+                    if(count > 16 && *pSrc <= 0x7f) {
+                        /* narrow a run of ASCII in bulk, one of the remaining count iterations per UChar */
+                        int32_t n = usimd_narrowASCII(pSrc, count - 1, pDest);
+                        pSrc += n;
+                        pDest += n;
+                        count -= n;
+                    }
                 } else if(ch <= 0x7ff) {
                     *pDest++=(uint8_t)((ch>>6)|0xc0);
                     *pDest++=(uint8_t)((ch&0x3f)|0x80);
@@ -1019,7 +1037,9 @@ u_strToUTF8WithSub(char *dest,
         while(pSrc<pSrcLimit) {
             ch=*pSrc++;
             if(ch<=0x7f) {
-                ++reqLength;
+                int32_t n = usimd_spanUCharsBelow(pSrc, (int32_t)(pSrcLimit - pSrc), 0x80);
+                pSrc += n;
+                reqLength += 1 + n;
             } else if(ch<=0x7ff) {
                 reqLength+=2;
             } else if(!U16_IS_SURROGATE(ch)) {
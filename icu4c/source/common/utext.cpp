@@ -25,6 +25,7 @@
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
 #include "ustr_imp.h"
+#include "utext_imp.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "uassert.h"
@@ -2873,3 +2874,15 @@ utext_openCharacterIterator(UText *ut, CharacterIterator *ci, UErrorCode *status
     }
     return ut;
 }
+
+//------------------------------------------------------------------------------
+//
+//     Direct access to the text, see utext_imp.h
+//
+//------------------------------------------------------------------------------
+
+U_NAMESPACE_BEGIN
+
+const UTextFuncs * const gUTF8TextFuncs = &utf8Funcs;
+
+U_NAMESPACE_END
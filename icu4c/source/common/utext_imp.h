@@ -0,0 +1,46 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  utext_imp.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Internal access to the text behind some UText providers,
+*   for code that wants to read the text directly rather than chunk by chunk.
+*/
+
+#ifndef __UTEXT_IMP_H__
+#define __UTEXT_IMP_H__
+
+#include "unicode/utypes.h"
+#include "unicode/utext.h"
+
+U_NAMESPACE_BEGIN
+
+/** The provider functions of a UText from utext_openUTF8(). @internal */
+extern const UTextFuncs * const gUTF8TextFuncs;
+
+/**
+ * If ut is a UTF-8 UText from utext_openUTF8(), then this function
+ * returns the UTF-8 string and sets length, determining it if necessary.
+ * Native indexes are then the same as offsets into the string.
+ * Otherwise it returns NULL.
+ * Inline so that the check for other kinds of UText is cheap.
+ *
+ * The string is valid until the UText is closed or re-opened.
+ * @internal
+ */
+inline const uint8_t *
+utext_getUTF8Buffer(UText *ut, int32_t &length) {
+    if (ut->pFuncs != gUTF8TextFuncs) {
+        return NULL;
+    }
+    length = (int32_t)utext_nativeLength(ut);
+    return (const uint8_t *)ut->context;
+}
+
+U_NAMESPACE_END
+
+#endif
@@ -537,6 +537,87 @@ UCollationResult Collator::compareUTF8(const StringPiece &source,
     return compare(sIter, tIter, status);
 }
 
+void Collator::sortStrings(UnicodeString strings[], int32_t count, int32_t numThreads,
+                           UErrorCode &status) const {
+    if(U_FAILURE(status)) {
+        return;
+    }
+    if(count < 0 || (strings == NULL && count > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if(count <= 1) {
+        return;
+    }
+    LocalMemory<const UChar *> sources;
+    LocalMemory<int32_t> lengths;
+    LocalMemory<int32_t> indexes;
+    LocalArray<UnicodeString> sorted(new UnicodeString[count]);
+    if(sources.allocateInsteadAndReset(count) == NULL ||
+            lengths.allocateInsteadAndReset(count) == NULL ||
+            indexes.allocateInsteadAndReset(count) == NULL ||
+            sorted.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        // A bogus string sorts like an empty one.
+        sources[i] = strings[i].getBuffer();
+        lengths[i] = sources[i] != NULL ? strings[i].length() : 0;
+    }
+    ucol_sortStrings(toUCollator(), sources.getAlias(), lengths.getAlias(), count,
+                     indexes.getAlias(), numThreads, &status);
+    if(U_FAILURE(status)) {
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        sorted[i].moveFrom(strings[indexes[i]]);
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        strings[i].moveFrom(sorted[i]);
+    }
+}
+
+void Collator::sortStrings(StringPiece strings[], int32_t count, int32_t numThreads,
+                           UErrorCode &status) const {
+    if(U_FAILURE(status)) {
+        return;
+    }
+    if(count < 0 || (strings == NULL && count > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if(count <= 1) {
+        return;
+    }
+    LocalMemory<const char *> sources;
+    LocalMemory<int32_t> lengths;
+    LocalMemory<int32_t> indexes;
+    LocalArray<StringPiece> sorted(new StringPiece[count]);
+    if(sources.allocateInsteadAndReset(count) == NULL ||
+            lengths.allocateInsteadAndReset(count) == NULL ||
+            indexes.allocateInsteadAndReset(count) == NULL ||
+            sorted.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        sources[i] = strings[i].data();
+        lengths[i] = strings[i].length();
+    }
+    ucol_sortStringsUTF8(toUCollator(), sources.getAlias(), lengths.getAlias(), count,
+                         indexes.getAlias(), numThreads, &status);
+    if(U_FAILURE(status)) {
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        sorted[i] = strings[indexes[i]];
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        strings[i] = sorted[i];
+    }
+}
+
 UBool Collator::equals(const UnicodeString& source, 
                        const UnicodeString& target) const
 {
@@ -284,6 +284,11 @@ CollationBuilder::parseAndBuild(const UnicodeString &ruleString,
     ownedSettings.fastLatinOptions = CollationFastLatin::getOptions(
         tailoring->data, ownedSettings,
         ownedSettings.fastLatinPrimaries, UPRV_LENGTHOF(ownedSettings.fastLatinPrimaries));
+    tailoring->buildFastScriptTable(errorCode);
+    if(U_FAILURE(errorCode)) { return NULL; }
+    ownedSettings.fastScriptOptions = CollationFastLatin::getScriptOptions(
+        tailoring->data, tailoring->fastScriptTable, ownedSettings,
+        ownedSettings.fastScriptPrimaries, UPRV_LENGTHOF(ownedSettings.fastScriptPrimaries));
     tailoring->rules = ruleString;
     tailoring->rules.getTerminatedBuffer();  // ensure NUL-termination
     tailoring->setVersion(base->version, rulesVersion);
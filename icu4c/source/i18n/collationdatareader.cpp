@@ -451,6 +451,11 @@ CollationDataReader::read(const CollationTailoring *base, const uint8_t *inBytes
     settings->fastLatinOptions = CollationFastLatin::getOptions(
         tailoring.data, *settings,
         settings->fastLatinPrimaries, UPRV_LENGTHOF(settings->fastLatinPrimaries));
+
+    tailoring.buildFastScriptTable(errorCode);
+    settings->fastScriptOptions = CollationFastLatin::getScriptOptions(
+        tailoring.data, tailoring.fastScriptTable, *settings,
+        settings->fastScriptPrimaries, UPRV_LENGTHOF(settings->fastScriptPrimaries));
 }
 
 UBool U_CALLCONV
@@ -16,6 +16,7 @@
 #if !UCONFIG_NO_COLLATION
 
 #include "unicode/ucol.h"
+#include "unicode/uscript.h"
 #include "collationdata.h"
 #include "collationfastlatin.h"
 #include "collationsettings.h"
@@ -26,7 +27,21 @@ U_NAMESPACE_BEGIN
 int32_t
 CollationFastLatin::getOptions(const CollationData *data, const CollationSettings &settings,
                                uint16_t *primaries, int32_t capacity) {
-    const uint16_t *table = data->fastLatinTable;
+    return getOptions(data, data->fastLatinTable, USCRIPT_LATIN, settings, primaries, capacity);
+}
+
+int32_t
+CollationFastLatin::getScriptOptions(const CollationData *data, const uint16_t *table,
+                                     const CollationSettings &settings,
+                                     uint16_t *primaries, int32_t capacity) {
+    if(table == NULL || (table[0] & 0xff) != SCRIPT_HEADER_LENGTH) { return -1; }
+    return getOptions(data, table, table[SCRIPT_HEADER_LENGTH - 2], settings, primaries, capacity);
+}
+
+int32_t
+CollationFastLatin::getOptions(const CollationData *data, const uint16_t *table, int32_t script,
+                               const CollationSettings &settings,
+                               uint16_t *primaries, int32_t capacity) {
     if(table == NULL) { return -1; }
     U_ASSERT(capacity == LATIN_LIMIT);
     if(capacity != LATIN_LIMIT) { return -1; }
@@ -61,7 +76,7 @@ CollationFastLatin::getOptions(const CollationData *data, const CollationSetting
                 digitStart = start;
             } else if(start != 0) {
                 if(start < prevStart) {
-                    // The permutation affects the groups up to Latin.
+                    // The permutation affects the groups up to Latin (or the table's script).
                     return -1;
                 }
                 // In the future, there might be a special group between digits & Latin.
@@ -71,13 +86,13 @@ CollationFastLatin::getOptions(const CollationData *data, const CollationSetting
                 prevStart = start;
             }
         }
-        uint32_t latinStart = data->getFirstPrimaryForGroup(USCRIPT_LATIN);
-        latinStart = settings.reorder(latinStart);
-        if(latinStart < prevStart) {
+        uint32_t scriptStart = data->getFirstPrimaryForGroup(script);
+        scriptStart = settings.reorder(scriptStart);
+        if(scriptStart < prevStart) {
             return -1;
         }
         if(afterDigitStart == 0) {
-            afterDigitStart = latinStart;
+            afterDigitStart = scriptStart;
         }
         if(!(beforeDigitStart < digitStart && digitStart < afterDigitStart)) {
             digitsAreReordered = TRUE;
@@ -115,6 +130,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
     // Keep compareUTF16() and compareUTF8() in sync very closely!
 
     U_ASSERT((table[0] >> 8) == VERSION);
+    const uint16_t *scriptCEs = getScriptCEs(table);
     table += (table[0] & 0xff);  // skip the header
     uint32_t variableTop = (uint32_t)options >> 16;  // see getOptions()
     options &= 0xffff;  // needed for CollationSettings::getStrength() to work
@@ -145,7 +161,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
             } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
                 leftPair = table[c - PUNCT_START + LATIN_LIMIT];
             } else {
-                leftPair = lookup(table, c);
+                leftPair = lookup(table, scriptCEs, c);
             }
             if(leftPair >= MIN_SHORT) {
                 leftPair &= SHORT_PRIMARY_MASK;
@@ -176,7 +192,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
             } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
                 rightPair = table[c - PUNCT_START + LATIN_LIMIT];
             } else {
-                rightPair = lookup(table, c);
+                rightPair = lookup(table, scriptCEs, c);
             }
             if(rightPair >= MIN_SHORT) {
                 rightPair &= SHORT_PRIMARY_MASK;
@@ -227,7 +243,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
                     leftPair = table[c - PUNCT_START + LATIN_LIMIT];
                 } else {
-                    leftPair = lookup(table, c);
+                    leftPair = lookup(table, scriptCEs, c);
                 }
                 if(leftPair >= MIN_SHORT) {
                     leftPair = getSecondariesFromOneShortCE(leftPair);
@@ -252,7 +268,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
                     rightPair = table[c - PUNCT_START + LATIN_LIMIT];
                 } else {
-                    rightPair = lookup(table, c);
+                    rightPair = lookup(table, scriptCEs, c);
                 }
                 if(rightPair >= MIN_SHORT) {
                     rightPair = getSecondariesFromOneShortCE(rightPair);
@@ -298,7 +314,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                     break;
                 }
                 UChar32 c = left[leftIndex++];
-                leftPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+                leftPair = (c <= LATIN_MAX) ? table[c] : lookup(table, scriptCEs, c);
                 if(leftPair < MIN_LONG) {
                     leftPair = nextPair(table, c, leftPair, left, NULL, leftIndex, leftLength);
                 }
@@ -311,7 +327,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                     break;
                 }
                 UChar32 c = right[rightIndex++];
-                rightPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+                rightPair = (c <= LATIN_MAX) ? table[c] : lookup(table, scriptCEs, c);
                 if(rightPair < MIN_LONG) {
                     rightPair = nextPair(table, c, rightPair, right, NULL, rightIndex, rightLength);
                 }
@@ -351,7 +367,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = left[leftIndex++];
-            leftPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+            leftPair = (c <= LATIN_MAX) ? table[c] : lookup(table, scriptCEs, c);
             if(leftPair < MIN_LONG) {
                 leftPair = nextPair(table, c, leftPair, left, NULL, leftIndex, leftLength);
             }
@@ -364,7 +380,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = right[rightIndex++];
-            rightPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+            rightPair = (c <= LATIN_MAX) ? table[c] : lookup(table, scriptCEs, c);
             if(rightPair < MIN_LONG) {
                 rightPair = nextPair(table, c, rightPair, right, NULL, rightIndex, rightLength);
             }
@@ -407,7 +423,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = left[leftIndex++];
-            leftPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+            leftPair = (c <= LATIN_MAX) ? table[c] : lookup(table, scriptCEs, c);
             if(leftPair < MIN_LONG) {
                 leftPair = nextPair(table, c, leftPair, left, NULL, leftIndex, leftLength);
             }
@@ -420,7 +436,7 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
                 break;
             }
             UChar32 c = right[rightIndex++];
-            rightPair = (c <= LATIN_MAX) ? table[c] : lookup(table, c);
+            rightPair = (c <= LATIN_MAX) ? table[c] : lookup(table, scriptCEs, c);
             if(rightPair < MIN_LONG) {
                 rightPair = nextPair(table, c, rightPair, right, NULL, rightIndex, rightLength);
             }
@@ -451,6 +467,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
     // Keep compareUTF16() and compareUTF8() in sync very closely!
 
     U_ASSERT((table[0] >> 8) == VERSION);
+    const uint16_t *scriptCEs = getScriptCEs(table);
     table += (table[0] & 0xff);  // skip the header
     uint32_t variableTop = (uint32_t)options >> 16;  // see RuleBasedCollator::getFastLatinOptions()
     options &= 0xffff;  // needed for CollationSettings::getStrength() to work
@@ -490,7 +507,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 if(leftPair != 0) { break; }
                 leftPair = table[c];
             } else {
-                leftPair = lookupUTF8(table, c, left, leftIndex, leftLength);
+                leftPair = lookupUTF8(table, scriptCEs, c, left, leftIndex, leftLength);
             }
             if(leftPair >= MIN_SHORT) {
                 leftPair &= SHORT_PRIMARY_MASK;
@@ -527,7 +544,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 if(rightPair != 0) { break; }
                 rightPair = table[c];
             } else {
-                rightPair = lookupUTF8(table, c, right, rightIndex, rightLength);
+                rightPair = lookupUTF8(table, scriptCEs, c, right, rightIndex, rightLength);
             }
             if(rightPair >= MIN_SHORT) {
                 rightPair &= SHORT_PRIMARY_MASK;
@@ -578,7 +595,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 } else if(c <= LATIN_MAX_UTF8_LEAD) {
                     leftPair = table[((c - 0xc2) << 6) + left[leftIndex++]];
                 } else {
-                    leftPair = lookupUTF8Unsafe(table, c, left, leftIndex);
+                    leftPair = lookupUTF8Unsafe(table, scriptCEs, c, left, leftIndex);
                 }
                 if(leftPair >= MIN_SHORT) {
                     leftPair = getSecondariesFromOneShortCE(leftPair);
@@ -603,7 +620,7 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 } else if(c <= LATIN_MAX_UTF8_LEAD) {
                     rightPair = table[((c - 0xc2) << 6) + right[rightIndex++]];
                 } else {
-                    rightPair = lookupUTF8Unsafe(table, c, right, rightIndex);
+                    rightPair = lookupUTF8Unsafe(table, scriptCEs, c, right, rightIndex);
                 }
                 if(rightPair >= MIN_SHORT) {
                     rightPair = getSecondariesFromOneShortCE(rightPair);
@@ -649,7 +666,8 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                     break;
                 }
                 UChar32 c = left[leftIndex++];
-                leftPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, left, leftIndex);
+                leftPair = (c <= 0x7f) ? table[c] :
+                        lookupUTF8Unsafe(table, scriptCEs, c, left, leftIndex);
                 if(leftPair < MIN_LONG) {
                     leftPair = nextPair(table, c, leftPair, NULL, left, leftIndex, leftLength);
                 }
@@ -662,7 +680,8 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                     break;
                 }
                 UChar32 c = right[rightIndex++];
-                rightPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, right, rightIndex);
+                rightPair = (c <= 0x7f) ? table[c] :
+                        lookupUTF8Unsafe(table, scriptCEs, c, right, rightIndex);
                 if(rightPair < MIN_LONG) {
                     rightPair = nextPair(table, c, rightPair, NULL, right, rightIndex, rightLength);
                 }
@@ -702,7 +721,8 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 break;
             }
             UChar32 c = left[leftIndex++];
-            leftPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, left, leftIndex);
+            leftPair = (c <= 0x7f) ? table[c] :
+                    lookupUTF8Unsafe(table, scriptCEs, c, left, leftIndex);
             if(leftPair < MIN_LONG) {
                 leftPair = nextPair(table, c, leftPair, NULL, left, leftIndex, leftLength);
             }
@@ -715,7 +735,8 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 break;
             }
             UChar32 c = right[rightIndex++];
-            rightPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, right, rightIndex);
+            rightPair = (c <= 0x7f) ? table[c] :
+                    lookupUTF8Unsafe(table, scriptCEs, c, right, rightIndex);
             if(rightPair < MIN_LONG) {
                 rightPair = nextPair(table, c, rightPair, NULL, right, rightIndex, rightLength);
             }
@@ -758,7 +779,8 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 break;
             }
             UChar32 c = left[leftIndex++];
-            leftPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, left, leftIndex);
+            leftPair = (c <= 0x7f) ? table[c] :
+                    lookupUTF8Unsafe(table, scriptCEs, c, left, leftIndex);
             if(leftPair < MIN_LONG) {
                 leftPair = nextPair(table, c, leftPair, NULL, left, leftIndex, leftLength);
             }
@@ -771,7 +793,8 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
                 break;
             }
             UChar32 c = right[rightIndex++];
-            rightPair = (c <= 0x7f) ? table[c] : lookupUTF8Unsafe(table, c, right, rightIndex);
+            rightPair = (c <= 0x7f) ? table[c] :
+                    lookupUTF8Unsafe(table, scriptCEs, c, right, rightIndex);
             if(rightPair < MIN_LONG) {
                 rightPair = nextPair(table, c, rightPair, NULL, right, rightIndex, rightLength);
             }
@@ -796,10 +819,12 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
 }
 
 uint32_t
-CollationFastLatin::lookup(const uint16_t *table, UChar32 c) {
+CollationFastLatin::lookup(const uint16_t *table, const uint16_t *scriptCEs, UChar32 c) {
     U_ASSERT(c > LATIN_MAX);
     if(PUNCT_START <= c && c < PUNCT_LIMIT) {
         return table[c - PUNCT_START + LATIN_LIMIT];
+    } else if(SCRIPT_START <= c && c < SCRIPT_LIMIT && scriptCEs != NULL) {
+        return scriptCEs[c - SCRIPT_START];
     } else if(c == 0xfffe) {
         return MERGE_WEIGHT;
     } else if(c == 0xffff) {
@@ -810,10 +835,21 @@ CollationFastLatin::lookup(const uint16_t *table, UChar32 c) {
 }
 
 uint32_t
-CollationFastLatin::lookupUTF8(const uint16_t *table, UChar32 c,
+CollationFastLatin::lookupUTF8(const uint16_t *table, const uint16_t *scriptCEs, UChar32 c,
                                const uint8_t *s8, int32_t &sIndex, int32_t sLength) {
     // The caller handled ASCII and valid/supported Latin.
     U_ASSERT(c > 0x7f);
+    if(SCRIPT_MIN_UTF8_LEAD <= c && c <= SCRIPT_MAX_UTF8_LEAD) {
+        uint8_t t;
+        if(scriptCEs != NULL && sIndex != sLength && 0x80 <= (t = s8[sIndex]) && t <= 0xbf) {
+            c = ((c & 0x1f) << 6) | (t & 0x3f);
+            if(SCRIPT_START <= c && c < SCRIPT_LIMIT) {
+                ++sIndex;
+                return scriptCEs[c - SCRIPT_START];
+            }
+        }
+        return BAIL_OUT;
+    }
     int32_t i2 = sIndex + 1;
     if(i2 < sLength || sLength < 0) {
         uint8_t t1 = s8[sIndex];
@@ -833,13 +869,16 @@ CollationFastLatin::lookupUTF8(const uint16_t *table, UChar32 c,
 }
 
 uint32_t
-CollationFastLatin::lookupUTF8Unsafe(const uint16_t *table, UChar32 c,
+CollationFastLatin::lookupUTF8Unsafe(const uint16_t *table, const uint16_t *scriptCEs, UChar32 c,
                                      const uint8_t *s8, int32_t &sIndex) {
     // The caller handled ASCII.
     // The string is well-formed and contains only supported characters.
     U_ASSERT(c > 0x7f);
     if(c <= LATIN_MAX_UTF8_LEAD) {
         return table[((c - 0xc2) << 6) + s8[sIndex++]];  // 0080..017F
+    } else if(c <= SCRIPT_MAX_UTF8_LEAD) {
+        c = ((c & 0x1f) << 6) | (s8[sIndex++] & 0x3f);
+        return scriptCEs[c - SCRIPT_START];  // 0370..04FF
     }
     uint8_t t2 = s8[sIndex + 1];
     sIndex += 2;
@@ -46,6 +46,25 @@ class U_I18N_API CollationFastLatin /* all static */ {
     // excludes U+FFFE & U+FFFF
     static const int32_t NUM_FAST_CHARS = LATIN_LIMIT + (PUNCT_LIMIT - PUNCT_START);
 
+    /**
+     * A fast script table (see CollationFastLatinBuilder::forScript())
+     * additionally has mini CEs for Greek and Cyrillic U+0370..U+04FF.
+     * Only the characters of its one script are supported;
+     * it bails out for Latin letters and for the other script.
+     */
+    static const int32_t SCRIPT_START = 0x370;
+    static const int32_t SCRIPT_LIMIT = 0x500;
+    static const int32_t SCRIPT_MIN_UTF8_LEAD = 0xcd;  // UTF-8 lead byte of SCRIPT_START
+    static const int32_t SCRIPT_MAX_UTF8_LEAD = 0xd3;  // UTF-8 lead byte of SCRIPT_LIMIT-1
+    static const int32_t NUM_SCRIPT_CHARS = SCRIPT_LIMIT - SCRIPT_START;
+
+    /**
+     * Header length of a fast script table:
+     * The regular header plus the script code and
+     * the offset of the script characters' mini CEs.
+     */
+    static const int32_t SCRIPT_HEADER_LENGTH = 7;
+
     // Note on the supported weight ranges:
     // Analysis of UCA 6.3 and CLDR 23 non-search tailorings shows that
     // the CEs for characters in the above ranges, excluding expansions with length >2,
@@ -210,6 +229,14 @@ class U_I18N_API CollationFastLatin /* all static */ {
     static int32_t getOptions(const CollationData *data, const CollationSettings &settings,
                               uint16_t *primaries, int32_t capacity);
 
+    /**
+     * Same as getOptions() but for a fast script table.
+     * Returns -1 if table is NULL or not supported for the data and settings.
+     */
+    static int32_t getScriptOptions(const CollationData *data, const uint16_t *table,
+                                    const CollationSettings &settings,
+                                    uint16_t *primaries, int32_t capacity);
+
     static int32_t compareUTF16(const uint16_t *table, const uint16_t *primaries, int32_t options,
                                 const UChar *left, int32_t leftLength,
                                 const UChar *right, int32_t rightLength);
@@ -219,10 +246,27 @@ class U_I18N_API CollationFastLatin /* all static */ {
                                const uint8_t *right, int32_t rightLength);
 
 private:
-    static uint32_t lookup(const uint16_t *table, UChar32 c);
-    static uint32_t lookupUTF8(const uint16_t *table, UChar32 c,
+    static int32_t getOptions(const CollationData *data, const uint16_t *table, int32_t script,
+                              const CollationSettings &settings,
+                              uint16_t *primaries, int32_t capacity);
+
+    /**
+     * Returns the mini CEs for U+0370..U+04FF of a fast script table,
+     * or NULL for a regular fast Latin table.
+     */
+    static inline const uint16_t *getScriptCEs(const uint16_t *table) {
+        int32_t headerLength = table[0] & 0xff;
+        if(headerLength == SCRIPT_HEADER_LENGTH) {
+            return table + headerLength + table[headerLength - 1];
+        } else {
+            return NULL;
+        }
+    }
+
+    static uint32_t lookup(const uint16_t *table, const uint16_t *scriptCEs, UChar32 c);
+    static uint32_t lookupUTF8(const uint16_t *table, const uint16_t *scriptCEs, UChar32 c,
                                const uint8_t *s8, int32_t &sIndex, int32_t sLength);
-    static uint32_t lookupUTF8Unsafe(const uint16_t *table, UChar32 c,
+    static uint32_t lookupUTF8Unsafe(const uint16_t *table, const uint16_t *scriptCEs, UChar32 c,
                                      const uint8_t *s8, int32_t &sIndex);
 
     static uint32_t nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
@@ -303,6 +347,28 @@ class U_I18N_API CollationFastLatin /* all static */ {
  *   for when there is no contraction match.
  *
  * -----------------
+ * Fast script tables
+ *
+ * A fast script table is built at runtime for one of Greek or Cyrillic
+ * and is never serialized.
+ * Its header has SCRIPT_HEADER_LENGTH=7 units:
+ * The regular version & length unit and varTops[4],
+ * followed by the UScriptCode of its script and
+ * the offset from the start of the miniCEs to the script miniCEs.
+ *
+ * uint16_t miniCEs[0x1c0], expansions and contractions as above,
+ * except that Latin letters (and other primaries after the digits
+ * and outside the script) always map to BAIL_OUT,
+ * and the digits always have long mini primaries.
+ * Expansion and contraction indexes are relative to just after the miniCEs[0x1c0]
+ * for all characters.
+ *
+ * uint16_t scriptMiniCEs[0x190]
+ *   A mini CE for each character U+0370..U+04FF, encoded like the miniCEs.
+ *   Contraction suffixes in this range are not supported:
+ *   The fastpath bails out when such a character follows a contraction starter.
+ *
+ * -----------------
  * Changes for version 2 (ICU 55)
  *
  * Special reorder groups do not necessarily start on whole primary lead bytes any more.
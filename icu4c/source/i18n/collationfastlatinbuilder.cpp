@@ -88,9 +88,12 @@ binarySearch(const int64_t list[], int32_t limit, int64_t ce) {
 
 CollationFastLatinBuilder::CollationFastLatinBuilder(UErrorCode &errorCode)
         : ce0(0), ce1(0),
+          numChars(CollationFastLatin::NUM_FAST_CHARS),
+          onlyCommonScriptChars(FALSE),
           contractionCEs(errorCode), uniqueCEs(errorCode),
           miniCEs(NULL),
           firstDigitPrimary(0), firstLatinPrimary(0), lastLatinPrimary(0),
+          script(USCRIPT_LATIN), firstScriptPrimary(0), lastScriptPrimary(0),
           firstShortPrimary(0), shortPrimaryOverflow(FALSE),
           headerLength(0) {
 }
@@ -106,13 +109,46 @@ CollationFastLatinBuilder::forData(const CollationData &data, UErrorCode &errorC
         errorCode = U_INVALID_STATE_ERROR;
         return FALSE;
     }
+    return build(data, errorCode);
+}
+
+UBool
+CollationFastLatinBuilder::forScript(const CollationData &data, int32_t sc,
+                                     UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return FALSE; }
+    if(!result.isEmpty()) {  // This builder is not reusable.
+        errorCode = U_INVALID_STATE_ERROR;
+        return FALSE;
+    }
+    // The script must be covered by U+0370..U+04FF.
+    if(sc != USCRIPT_GREEK && sc != USCRIPT_CYRILLIC) { return FALSE; }
+    script = sc;
+    numChars = CollationFastLatin::NUM_FAST_CHARS + CollationFastLatin::NUM_SCRIPT_CHARS;
+    return build(data, errorCode);
+}
+
+UBool
+CollationFastLatinBuilder::build(const CollationData &data, UErrorCode &errorCode) {
     if(!loadGroups(data, errorCode)) { return FALSE; }
 
-    // Fast handling of digits.
-    firstShortPrimary = firstDigitPrimary;
+    if(script == USCRIPT_LATIN) {
+        // Fast handling of digits.
+        firstShortPrimary = firstDigitPrimary;
+    } else {
+        // Reserve the short primaries for the script's letters.
+        firstShortPrimary = firstScriptPrimary;
+    }
     getCEs(data, errorCode);
     if(!encodeUniqueCEs(errorCode)) { return FALSE; }
-    if(shortPrimaryOverflow) {
+    if(shortPrimaryOverflow && script != USCRIPT_LATIN) {
+        // Bail out for rare letters,
+        // so that there are more short primaries for the common ones.
+        onlyCommonScriptChars = TRUE;
+        resetCEs();
+        getCEs(data, errorCode);
+        if(!encodeUniqueCEs(errorCode)) { return FALSE; }
+    }
+    if(shortPrimaryOverflow && script == USCRIPT_LATIN) {
         // Give digits long mini primaries,
         // so that there are more short primaries for letters.
         firstShortPrimary = firstLatinPrimary;
@@ -130,6 +166,16 @@ CollationFastLatinBuilder::forData(const CollationData &data, UErrorCode &errorC
 
     UBool ok = !shortPrimaryOverflow &&
             encodeCharCEs(errorCode) && encodeContractions(errorCode);
+    if(ok && numChars > CollationFastLatin::NUM_FAST_CHARS) {
+        // Append the script characters' mini CEs and store their offset in the header.
+        result.setCharAt(headerLength - 1, (UChar)(result.length() - headerLength));
+        result.append(reinterpret_cast<const UChar *>(scriptMiniCEs),
+                      CollationFastLatin::NUM_SCRIPT_CHARS);
+        if(result.isBogus()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            ok = FALSE;
+        }
+    }
     contractionCEs.removeAllElements();  // might reduce heap memory usage
     uniqueCEs.removeAllElements();
     return ok;
@@ -139,6 +185,10 @@ UBool
 CollationFastLatinBuilder::loadGroups(const CollationData &data, UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return FALSE; }
     headerLength = 1 + NUM_SPECIAL_GROUPS;
+    if(script != USCRIPT_LATIN) {
+        headerLength += 2;  // script code & offset of the script mini CEs
+        U_ASSERT(headerLength == CollationFastLatin::SCRIPT_HEADER_LENGTH);
+    }
     uint32_t r0 = (CollationFastLatin::VERSION << 8) | headerLength;
     result.append((UChar)r0);
     // The first few reordering groups should be special groups
@@ -159,6 +209,16 @@ CollationFastLatinBuilder::loadGroups(const CollationData &data, UErrorCode &err
         // missing data
         return FALSE;
     }
+    if(script != USCRIPT_LATIN) {
+        firstScriptPrimary = data.getFirstPrimaryForGroup(script);
+        lastScriptPrimary = data.getLastPrimaryForGroup(script);
+        if(firstScriptPrimary <= lastLatinPrimary) {
+            // missing data, or the script does not sort after Latin
+            return FALSE;
+        }
+        result.append((UChar)script);
+        result.append((UChar)0);  // reserve a slot for the offset of the script mini CEs
+    }
     return TRUE;
 }
 
@@ -193,6 +253,17 @@ CollationFastLatinBuilder::inSameGroup(uint32_t p, uint32_t q) const {
     }
 }
 
+UBool
+CollationFastLatinBuilder::isSupportedPrimary(uint32_t p) const {
+    if(script == USCRIPT_LATIN) {
+        // We only support primaries up to the Latin script.
+        return p <= lastLatinPrimary;
+    } else {
+        // Special groups and digits, and the script's primaries but not Latin.
+        return p < firstLatinPrimary || (firstScriptPrimary <= p && p <= lastScriptPrimary);
+    }
+}
+
 void
 CollationFastLatinBuilder::resetCEs() {
     contractionCEs.removeAllElements();
@@ -209,6 +280,9 @@ CollationFastLatinBuilder::getCEs(const CollationData &data, UErrorCode &errorCo
         if(c == CollationFastLatin::LATIN_LIMIT) {
             c = CollationFastLatin::PUNCT_START;
         } else if(c == CollationFastLatin::PUNCT_LIMIT) {
+            if(i == numChars) { break; }
+            c = CollationFastLatin::SCRIPT_START;
+        } else if(c == CollationFastLatin::SCRIPT_LIMIT) {
             break;
         }
         const CollationData *d;
@@ -219,7 +293,9 @@ CollationFastLatinBuilder::getCEs(const CollationData &data, UErrorCode &errorCo
         } else {
             d = &data;
         }
-        if(getCEsFromCE32(*d, c, ce32, errorCode)) {
+        if((c < CollationFastLatin::SCRIPT_START || c >= CollationFastLatin::SCRIPT_LIMIT ||
+                    !onlyCommonScriptChars || isCommonScriptChar(c)) &&
+                getCEsFromCE32(*d, c, ce32, errorCode)) {
             charCEs[i][0] = ce0;
             charCEs[i][1] = ce1;
             addUniqueCE(ce0, errorCode);
@@ -303,8 +379,7 @@ CollationFastLatinBuilder::getCEsFromCE32(const CollationData &data, UChar32 c,
     // We do not support an ignorable ce0 unless it is completely ignorable.
     uint32_t p0 = (uint32_t)(ce0 >> 32);
     if(p0 == 0) { return FALSE; }
-    // We only support primaries up to the Latin script.
-    if(p0 > lastLatinPrimary) { return FALSE; }
+    if(!isSupportedPrimary(p0)) { return FALSE; }
     // We support non-common secondary and case weights only together with short primaries.
     uint32_t lower32_0 = (uint32_t)ce0;
     if(p0 < firstShortPrimary) {
@@ -321,6 +396,7 @@ CollationFastLatinBuilder::getCEsFromCE32(const CollationData &data, UChar32 c,
         // and determine for both whether they are variable.
         uint32_t p1 = (uint32_t)(ce1 >> 32);
         if(p1 == 0 ? p0 < firstShortPrimary : !inSameGroup(p0, p1)) { return FALSE; }
+        if(p1 != 0 && !isSupportedPrimary(p1)) { return FALSE; }
         uint32_t lower32_1 = (uint32_t)ce1;
         // No tertiary CEs.
         if((lower32_1 >> 16) == 0) { return FALSE; }
@@ -564,12 +640,12 @@ CollationFastLatinBuilder::encodeUniqueCEs(UErrorCode &errorCode) {
 UBool
 CollationFastLatinBuilder::encodeCharCEs(UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return FALSE; }
-    int32_t miniCEsStart = result.length();
     for(int32_t i = 0; i < CollationFastLatin::NUM_FAST_CHARS; ++i) {
         result.append((UChar)0);  // initialize to completely ignorable
     }
+    uprv_memset(scriptMiniCEs, 0, sizeof(scriptMiniCEs));
     int32_t indexBase = result.length();
-    for(int32_t i = 0; i < CollationFastLatin::NUM_FAST_CHARS; ++i) {
+    for(int32_t i = 0; i < numChars; ++i) {
         int64_t ce = charCEs[i][0];
         if(isContractionCharCE(ce)) { continue; }  // defer contraction
         uint32_t miniCE = encodeTwoCEs(ce, charCEs[i][1]);
@@ -585,7 +661,7 @@ CollationFastLatinBuilder::encodeCharCEs(UErrorCode &errorCode) {
                 miniCE = CollationFastLatin::EXPANSION | expansionIndex;
             }
         }
-        result.setCharAt(miniCEsStart + i, (UChar)miniCE);
+        setCharMiniCE(i, miniCE);
     }
     return U_SUCCESS(errorCode);
 }
@@ -597,12 +673,12 @@ CollationFastLatinBuilder::encodeContractions(UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return FALSE; }
     int32_t indexBase = headerLength + CollationFastLatin::NUM_FAST_CHARS;
     int32_t firstContractionIndex = result.length();
-    for(int32_t i = 0; i < CollationFastLatin::NUM_FAST_CHARS; ++i) {
+    for(int32_t i = 0; i < numChars; ++i) {
         int64_t ce = charCEs[i][0];
         if(!isContractionCharCE(ce)) { continue; }
         int32_t contractionIndex = result.length() - indexBase;
         if(contractionIndex > (int32_t)CollationFastLatin::INDEX_MASK) {
-            result.setCharAt(headerLength + i, CollationFastLatin::BAIL_OUT);
+            setCharMiniCE(i, CollationFastLatin::BAIL_OUT);
             continue;
         }
         UBool firstTriple = TRUE;
@@ -626,8 +702,7 @@ CollationFastLatinBuilder::encodeContractions(UErrorCode &errorCode) {
         // Note: There is a chance that this new contraction list is the same as a previous one,
         // and if so, then we could truncate the result and reuse the other list.
         // However, that seems unlikely.
-        result.setCharAt(headerLength + i,
-                         (UChar)(CollationFastLatin::CONTRACTION | contractionIndex));
+        setCharMiniCE(i, CollationFastLatin::CONTRACTION | contractionIndex);
     }
     if(result.length() > firstContractionIndex) {
         // Terminate the last contraction list.
@@ -666,6 +741,15 @@ CollationFastLatinBuilder::encodeContractions(UErrorCode &errorCode) {
     return TRUE;
 }
 
+void
+CollationFastLatinBuilder::setCharMiniCE(int32_t i, uint32_t miniCE) {
+    if(i < CollationFastLatin::NUM_FAST_CHARS) {
+        result.setCharAt(headerLength + i, (UChar)miniCE);
+    } else {
+        scriptMiniCEs[i - CollationFastLatin::NUM_FAST_CHARS] = (uint16_t)miniCE;
+    }
+}
+
 uint32_t
 CollationFastLatinBuilder::encodeTwoCEs(int64_t first, int64_t second) const {
     if(first == 0) {
@@ -36,6 +36,15 @@ class U_I18N_API CollationFastLatinBuilder : public UObject {
 
     UBool forData(const CollationData &data, UErrorCode &errorCode);
 
+    /**
+     * Builds a fast script table for Greek or Cyrillic text.
+     * It has short mini primaries for the script rather than for Latin,
+     * and it bails out for Latin letters.
+     * See the CollationFastLatin data format description.
+     * Returns FALSE if the script is not supported or the table cannot be built.
+     */
+    UBool forScript(const CollationData &data, int32_t script, UErrorCode &errorCode);
+
     const uint16_t *getTable() const {
         return reinterpret_cast<const uint16_t *>(result.getBuffer());
     }
@@ -47,6 +56,8 @@ class U_I18N_API CollationFastLatinBuilder : public UObject {
 
     UBool loadGroups(const CollationData &data, UErrorCode &errorCode);
     UBool inSameGroup(uint32_t p, uint32_t q) const;
+    UBool isSupportedPrimary(uint32_t p) const;
+    UBool build(const CollationData &data, UErrorCode &errorCode);
 
     void resetCEs();
     void getCEs(const CollationData &data, UErrorCode &errorCode);
@@ -61,6 +72,13 @@ class U_I18N_API CollationFastLatinBuilder : public UObject {
     UBool encodeCharCEs(UErrorCode &errorCode);
     UBool encodeContractions(UErrorCode &errorCode);
     uint32_t encodeTwoCEs(int64_t first, int64_t second) const;
+    void setCharMiniCE(int32_t i, uint32_t miniCE);
+
+    static UBool isCommonScriptChar(UChar32 c) {
+        // Greek, and Cyrillic used for Russian, Ukrainian, Belarusian, Bulgarian,
+        // Serbian and Macedonian.
+        return c < 0x460 || c == 0x490 || c == 0x491;
+    }
 
     static UBool isContractionCharCE(int64_t ce) {
         return (uint32_t)(ce >> 32) == Collation::NO_CE_PRIMARY && ce != Collation::NO_CE;
@@ -71,7 +89,16 @@ class U_I18N_API CollationFastLatinBuilder : public UObject {
     // temporary "buffer"
     int64_t ce0, ce1;
 
-    int64_t charCEs[CollationFastLatin::NUM_FAST_CHARS][2];
+    int64_t charCEs[CollationFastLatin::NUM_FAST_CHARS + CollationFastLatin::NUM_SCRIPT_CHARS][2];
+    /** NUM_FAST_CHARS, plus NUM_SCRIPT_CHARS for a fast script table. */
+    int32_t numChars;
+    /** Mini CEs for U+0370..U+04FF, appended to a fast script table. */
+    uint16_t scriptMiniCEs[CollationFastLatin::NUM_SCRIPT_CHARS];
+    /**
+     * If TRUE, then the fast script table bails out for the less common
+     * Cyrillic letters, so that there are enough short primaries for the others.
+     */
+    UBool onlyCommonScriptChars;
 
     UVector64 contractionCEs;
     UVector64 uniqueCEs;
@@ -84,6 +111,10 @@ class U_I18N_API CollationFastLatinBuilder : public UObject {
     uint32_t firstDigitPrimary;
     uint32_t firstLatinPrimary;
     uint32_t lastLatinPrimary;
+    // The script of a fast script table, or USCRIPT_LATIN.
+    int32_t script;
+    uint32_t firstScriptPrimary;
+    uint32_t lastScriptPrimary;
     // This determines the first normal primary weight which is mapped to
     // a short mini primary. It must be >=firstDigitPrimary.
     uint32_t firstShortPrimary;
@@ -18,10 +18,12 @@
 #include "unicode/udata.h"
 #include "unicode/unistr.h"
 #include "unicode/ures.h"
+#include "unicode/uscript.h"
 #include "unicode/uversion.h"
 #include "unicode/uvernum.h"
 #include "cmemory.h"
 #include "collationdata.h"
+#include "collationfastlatinbuilder.h"
 #include "collationsettings.h"
 #include "collationtailoring.h"
 #include "normalizer2impl.h"
@@ -35,8 +37,9 @@ U_NAMESPACE_BEGIN
 CollationTailoring::CollationTailoring(const CollationSettings *baseSettings)
         : data(NULL), settings(baseSettings),
           actualLocale(""),
+          fastScriptTable(NULL),
           ownedData(NULL),
-          builder(NULL), memory(NULL), bundle(NULL),
+          builder(NULL), fastScriptBuilder(NULL), memory(NULL), bundle(NULL),
           trie(NULL), unsafeBackwardSet(NULL),
           maxExpansions(NULL) {
     if(baseSettings != NULL) {
@@ -58,6 +61,7 @@ CollationTailoring::~CollationTailoring() {
     SharedObject::clearPtr(settings);
     delete ownedData;
     delete builder;
+    delete fastScriptBuilder;
     udata_close(memory);
     ures_close(bundle);
     utrie2_close(trie);
@@ -82,6 +86,30 @@ CollationTailoring::ensureOwnedData(UErrorCode &errorCode) {
     return TRUE;
 }
 
+void
+CollationTailoring::buildFastScriptTable(UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode) || data == NULL || fastScriptBuilder != NULL) { return; }
+    int32_t script = USCRIPT_INVALID_CODE;
+    for(int32_t i = 0; i < settings->reorderCodesLength; ++i) {
+        if(settings->reorderCodes[i] >= 0) {
+            script = settings->reorderCodes[i];
+            break;
+        }
+    }
+    if(script != USCRIPT_GREEK && script != USCRIPT_CYRILLIC) { return; }
+    CollationFastLatinBuilder *fastBuilder = new CollationFastLatinBuilder(errorCode);
+    if(fastBuilder == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    if(fastBuilder->forScript(*data, script, errorCode)) {
+        fastScriptTable = fastBuilder->getTable();
+        fastScriptBuilder = fastBuilder;
+    } else {
+        delete fastBuilder;
+    }
+}
+
 void
 CollationTailoring::makeBaseVersion(const UVersionInfo ucaVersion, UVersionInfo version) {
     version[0] = UCOL_BUILDER_VERSION;
@@ -56,6 +56,13 @@ struct U_I18N_API CollationTailoring : public SharedObject {
 
     UBool ensureOwnedData(UErrorCode &errorCode);
 
+    /**
+     * Builds the fastScriptTable if the settings reorder
+     * a script with CollationFastLatin script support (Greek or Cyrillic) first.
+     * Call this after data and settings are complete.
+     */
+    void buildFastScriptTable(UErrorCode &errorCode);
+
     static void makeBaseVersion(const UVersionInfo ucaVersion, UVersionInfo version);
     void setVersion(const UVersionInfo baseVersion, const UVersionInfo rulesVersion);
     int32_t getUCAVersion() const;
@@ -73,10 +80,13 @@ struct U_I18N_API CollationTailoring : public SharedObject {
     // version[2]: bits 7..6=w, bits 5..0=r
     // version[3]= (s<<5)+(s>>3)+t+(q<<4)+(q>>4)
     UVersionInfo version;
+    // Optional CollationFastLatin table for Greek or Cyrillic text, or NULL.
+    const uint16_t *fastScriptTable;
 
     // owned objects
     CollationData *ownedData;
     UObject *builder;
+    UObject *fastScriptBuilder;
     UDataMemory *memory;
     UResourceBundle *bundle;
     UTrie2 *trie;
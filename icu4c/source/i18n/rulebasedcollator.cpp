@@ -29,6 +29,7 @@
 #include "unicode/uniset.h"
 #include "unicode/unistr.h"
 #include "unicode/usetiter.h"
+#include "unicode/ustring.h"
 #include "unicode/utf8.h"
 #include "unicode/uversion.h"
 #include "bocsu.h"
@@ -46,10 +47,12 @@
 #include "collationsettings.h"
 #include "collationtailoring.h"
 #include "cstring.h"
+#include "uarrsort.h"
 #include "uassert.h"
 #include "ucol_imp.h"
 #include "uhash.h"
 #include "uitercollationiterator.h"
+#include "uparallel.h"
 #include "ustr_imp.h"
 #include "utf16collationiterator.h"
 #include "utf8collationiterator.h"
@@ -87,6 +90,160 @@ FixedSortKeyByteSink::Resize(int32_t /*appendCapacity*/, int32_t /*length*/) {
     return FALSE;
 }
 
+/**
+ * Collects the sort keys for one part of a batch in a growable buffer.
+ */
+class BatchSortKeyByteSink : public SortKeyByteSink {
+public:
+    BatchSortKeyByteSink(MaybeStackArray<char, 1024> &buffer)
+            : SortKeyByteSink(buffer.getAlias(), buffer.getCapacity()),
+              storage_(buffer) {}
+    virtual ~BatchSortKeyByteSink();
+
+private:
+    virtual void AppendBeyondCapacity(const char *bytes, int32_t n, int32_t length);
+    virtual UBool Resize(int32_t appendCapacity, int32_t length);
+
+    MaybeStackArray<char, 1024> &storage_;
+};
+
+BatchSortKeyByteSink::~BatchSortKeyByteSink() {}
+
+void
+BatchSortKeyByteSink::AppendBeyondCapacity(const char *bytes, int32_t n, int32_t length) {
+    // buffer_ != NULL && bytes != NULL && n > 0 && appended_ > capacity_
+    if (Resize(n, length)) {
+        uprv_memcpy(buffer_ + length, bytes, n);
+    }
+}
+
+UBool
+BatchSortKeyByteSink::Resize(int32_t appendCapacity, int32_t length) {
+    if (buffer_ == NULL) {
+        return FALSE;  // allocation failed before already
+    }
+    int32_t newCapacity = 2 * capacity_;
+    int32_t altCapacity = length + 2 * appendCapacity;
+    if (newCapacity < altCapacity) {
+        newCapacity = altCapacity;
+    }
+    char *newBuffer = storage_.resize(newCapacity, length);
+    if (newBuffer == NULL) {
+        SetNotOk();
+        return FALSE;
+    }
+    buffer_ = newBuffer;
+    capacity_ = newCapacity;
+    return TRUE;
+}
+
+/**
+ * Sort keys for a part of a batch that is processed on another thread.
+ */
+struct SortKeysPart : public UMemory {
+    SortKeysPart() : start(0), limit(0), length(0), errorCode(U_ZERO_ERROR) {}
+
+    int32_t start, limit;
+    MaybeStackArray<char, 1024> buffer;
+    int32_t length;
+    UErrorCode errorCode;
+};
+
+/** Minimum number of strings per thread for ucol_getSortKeys(). */
+const int32_t MIN_SORT_KEYS_PER_THREAD = 64;
+
+/** Minimum number of strings per thread for ucol_sortStrings(). */
+const int32_t MIN_SORT_STRINGS_PER_THREAD = 1024;
+
+/** Number of sort key bytes that ucol_sortStrings() computes up front for each string. */
+const int32_t SORT_PREFIX_LENGTH = 16;
+
+/**
+ * The beginning of the sort key for one of the strings in ucol_sortStrings(),
+ * padded with zero bytes.
+ * Sort keys contain no zero bytes except for the terminator,
+ * so comparing the padded prefixes orders shorter keys before longer ones.
+ */
+struct SortPrefix {
+    uint8_t key[SORT_PREFIX_LENGTH];
+    int32_t index;
+    /** TRUE if key contains the whole sort key. */
+    UBool isComplete;
+};
+
+template<typename CharType>
+struct SortStringsContext {
+    const RuleBasedCollator *coll;
+    const CharType *const *sources;
+    const int32_t *sourceLengths;
+};
+
+inline UCollationResult
+compareSources(const RuleBasedCollator &coll,
+               const UChar *left, int32_t leftLength,
+               const UChar *right, int32_t rightLength, UErrorCode &errorCode) {
+    return coll.compare(left, leftLength, right, rightLength, errorCode);
+}
+
+inline UCollationResult
+compareSources(const RuleBasedCollator &coll,
+               const char *left, int32_t leftLength,
+               const char *right, int32_t rightLength, UErrorCode &errorCode) {
+    return coll.internalCompareUTF8(left, leftLength, right, rightLength, errorCode);
+}
+
+/**
+ * Compares two sort prefixes, and the strings themselves only if
+ * the prefixes are equal but not complete.
+ * Equal strings are ordered by their input indexes,
+ * so that the order is total and the sort is stable.
+ */
+template<typename CharType>
+int32_t U_CALLCONV
+compareSortPrefixes(const void *context, const void *left, const void *right) {
+    const SortPrefix &l = *static_cast<const SortPrefix *>(left);
+    const SortPrefix &r = *static_cast<const SortPrefix *>(right);
+    int32_t result = uprv_memcmp(l.key, r.key, SORT_PREFIX_LENGTH);
+    if(result != 0) { return result; }
+    if(!l.isComplete || !r.isComplete) {
+        const SortStringsContext<CharType> &ctx =
+            *static_cast<const SortStringsContext<CharType> *>(context);
+        const int32_t *lengths = ctx.sourceLengths;
+        UErrorCode errorCode = U_ZERO_ERROR;
+        result = compareSources(*ctx.coll,
+                                ctx.sources[l.index], lengths != NULL ? lengths[l.index] : -1,
+                                ctx.sources[r.index], lengths != NULL ? lengths[r.index] : -1,
+                                errorCode);
+        if(result != 0) { return result; }
+    }
+    return l.index < r.index ? -1 : l.index > r.index ? 1 : 0;
+}
+
+/**
+ * Merges the sorted runs src[start..middle[ and src[middle..limit[
+ * into dest[start..limit[.
+ */
+template<typename CharType>
+void
+mergeSortPrefixes(const SortPrefix *src, int32_t start, int32_t middle, int32_t limit,
+                  SortPrefix *dest, const SortStringsContext<CharType> *context) {
+    int32_t i = start;
+    int32_t j = middle;
+    int32_t k = start;
+    while(i < middle && j < limit) {
+        if(compareSortPrefixes<CharType>(context, src + j, src + i) < 0) {
+            dest[k++] = src[j++];
+        } else {
+            dest[k++] = src[i++];
+        }
+    }
+    if(i < middle) {
+        uprv_memcpy(dest + k, src + i, (middle - i) * sizeof(SortPrefix));
+    } else if(j < limit) {
+        uprv_memcpy(dest + k, src + j, (limit - j) * sizeof(SortPrefix));
+    }
+}
+
 }  // namespace
 
 // Not in an anonymous namespace, so that it can be a friend of CollationKey.
@@ -694,6 +851,9 @@ RuleBasedCollator::setFastLatinOptions(CollationSettings &ownedSettings) const {
     ownedSettings.fastLatinOptions = CollationFastLatin::getOptions(
             data, ownedSettings,
             ownedSettings.fastLatinPrimaries, UPRV_LENGTHOF(ownedSettings.fastLatinPrimaries));
+    ownedSettings.fastScriptOptions = CollationFastLatin::getScriptOptions(
+            data, tailoring->fastScriptTable, ownedSettings,
+            ownedSettings.fastScriptPrimaries, UPRV_LENGTHOF(ownedSettings.fastScriptPrimaries));
 }
 
 UCollationResult
@@ -1044,6 +1204,29 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     } else {
         result = CollationFastLatin::BAIL_OUT_RESULT;
     }
+    // Greek or Cyrillic text: Try the tailoring's fast script table.
+    int32_t fastScriptOptions = settings->fastScriptOptions;
+    if(result == CollationFastLatin::BAIL_OUT_RESULT && fastScriptOptions >= 0 &&
+            (equalPrefixLength == leftLength ||
+                left[equalPrefixLength] < CollationFastLatin::SCRIPT_LIMIT) &&
+            (equalPrefixLength == rightLength ||
+                right[equalPrefixLength] < CollationFastLatin::SCRIPT_LIMIT)) {
+        if(leftLength >= 0) {
+            result = CollationFastLatin::compareUTF16(tailoring->fastScriptTable,
+                                                      settings->fastScriptPrimaries,
+                                                      fastScriptOptions,
+                                                      left + equalPrefixLength,
+                                                      leftLength - equalPrefixLength,
+                                                      right + equalPrefixLength,
+                                                      rightLength - equalPrefixLength);
+        } else {
+            result = CollationFastLatin::compareUTF16(tailoring->fastScriptTable,
+                                                      settings->fastScriptPrimaries,
+                                                      fastScriptOptions,
+                                                      left + equalPrefixLength, -1,
+                                                      right + equalPrefixLength, -1);
+        }
+    }
 
     if(result == CollationFastLatin::BAIL_OUT_RESULT) {
         if(settings->dontCheckFCD()) {
@@ -1173,6 +1356,29 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
     } else {
         result = CollationFastLatin::BAIL_OUT_RESULT;
     }
+    // Greek or Cyrillic text: Try the tailoring's fast script table.
+    int32_t fastScriptOptions = settings->fastScriptOptions;
+    if(result == CollationFastLatin::BAIL_OUT_RESULT && fastScriptOptions >= 0 &&
+            (equalPrefixLength == leftLength ||
+                left[equalPrefixLength] <= CollationFastLatin::SCRIPT_MAX_UTF8_LEAD) &&
+            (equalPrefixLength == rightLength ||
+                right[equalPrefixLength] <= CollationFastLatin::SCRIPT_MAX_UTF8_LEAD)) {
+        if(leftLength >= 0) {
+            result = CollationFastLatin::compareUTF8(tailoring->fastScriptTable,
+                                                     settings->fastScriptPrimaries,
+                                                     fastScriptOptions,
+                                                     left + equalPrefixLength,
+                                                     leftLength - equalPrefixLength,
+                                                     right + equalPrefixLength,
+                                                     rightLength - equalPrefixLength);
+        } else {
+            result = CollationFastLatin::compareUTF8(tailoring->fastScriptTable,
+                                                     settings->fastScriptPrimaries,
+                                                     fastScriptOptions,
+                                                     left + equalPrefixLength, -1,
+                                                     right + equalPrefixLength, -1);
+        }
+    }
 
     if(result == CollationFastLatin::BAIL_OUT_RESULT) {
         if(settings->dontCheckFCD()) {
@@ -1353,6 +1559,390 @@ RuleBasedCollator::writeSortKey(const UChar *s, int32_t length,
     sink.Append(&terminator, 1);
 }
 
+void
+RuleBasedCollator::writeSortKeys(const UChar *const sources[], const int32_t sourceLengths[],
+                                 int32_t start, int32_t limit, SortKeyByteSink &sink,
+                                 int32_t offsets[], UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    // Set up the iterators once and only reset them for each string.
+    UBool numeric = settings->isNumeric();
+    UBool checkFCD = !settings->dontCheckFCD();
+    UBool identical = settings->getStrength() == UCOL_IDENTICAL;
+    UTF16CollationIterator iter(data, numeric, NULL, NULL, NULL);
+    FCDUTF16CollationIterator fcdIter(data, numeric, NULL, NULL, NULL);
+    CollationKeys::LevelCallback callback;
+    static const char terminator = 0;  // TERMINATOR_BYTE
+    for(int32_t i = start; i < limit; ++i) {
+        offsets[i] = sink.NumberOfBytesAppended();
+        const UChar *s = sources[i];
+        int32_t length = sourceLengths != NULL ? sourceLengths[i] : -1;
+        if(s == NULL) {
+            // NULL with length 0, see getSortKeys()
+            static const UChar empty = 0;
+            s = &empty;
+        }
+        const UChar *sLimit = (length >= 0) ? s + length : NULL;
+        if(checkFCD) {
+            fcdIter.setText(s, sLimit);
+            CollationKeys::writeSortKeyUpToQuaternary(fcdIter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        } else {
+            iter.setText(s, sLimit);
+            CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        }
+        if(identical) {
+            writeIdenticalLevel(s, sLimit, sink, errorCode);
+        }
+        sink.Append(&terminator, 1);
+        if(U_FAILURE(errorCode)) { return; }
+    }
+}
+
+void
+RuleBasedCollator::writeSortKeys(const char *const sources[], const int32_t sourceLengths[],
+                                 int32_t start, int32_t limit, SortKeyByteSink &sink,
+                                 int32_t offsets[], UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    // Same as for UTF-16 but with the UTF-8 iterators.
+    UBool numeric = settings->isNumeric();
+    UBool checkFCD = !settings->dontCheckFCD();
+    UBool identical = settings->getStrength() == UCOL_IDENTICAL;
+    UTF8CollationIterator iter(data, numeric, NULL, 0, 0);
+    FCDUTF8CollationIterator fcdIter(data, numeric, NULL, 0, 0);
+    CollationKeys::LevelCallback callback;
+    static const char terminator = 0;  // TERMINATOR_BYTE
+    for(int32_t i = start; i < limit; ++i) {
+        offsets[i] = sink.NumberOfBytesAppended();
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(sources[i]);
+        int32_t length = sourceLengths != NULL ? sourceLengths[i] : -1;
+        if(s == NULL) {
+            // NULL with length 0, see getSortKeys()
+            static const uint8_t empty = 0;
+            s = &empty;
+        }
+        if(checkFCD) {
+            fcdIter.setText(s, length);
+            CollationKeys::writeSortKeyUpToQuaternary(fcdIter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        } else {
+            iter.setText(s, length);
+            CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                      sink, Collation::PRIMARY_LEVEL,
+                                                      callback, TRUE, errorCode);
+        }
+        if(identical) {
+            writeIdenticalLevelUTF8(s, length, sink, errorCode);
+        }
+        sink.Append(&terminator, 1);
+        if(U_FAILURE(errorCode)) { return; }
+    }
+}
+
+template<typename CharType>
+int32_t
+RuleBasedCollator::getSortKeys(const CharType *const sources[], const int32_t sourceLengths[],
+                               int32_t count, uint8_t *dest, int32_t capacity,
+                               int32_t offsets[], int32_t numThreads, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+            capacity < 0 || (dest == NULL && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        if(sources[i] == NULL) {
+            if(sourceLengths == NULL || sourceLengths[i] != 0) {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return 0;
+            }
+        }
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == NULL) {
+        // Distinguish pure preflighting from an allocation error.
+        dest = noDest;
+        capacity = 0;
+    }
+
+    // Split the batch into one part per thread.
+    // This thread writes the first part directly into dest,
+    // the other threads write into their own buffers which are then appended.
+    if(numThreads > count / MIN_SORT_KEYS_PER_THREAD) {
+        numThreads = count / MIN_SORT_KEYS_PER_THREAD;
+    }
+    int32_t numParts = numThreads > 1 ? numThreads : 1;
+    LocalArray<SortKeysPart> parts;
+    if(numParts > 1) {
+        parts.adoptInstead(new SortKeysPart[numParts - 1]);
+        if(parts.isNull()) {
+            // Fall back to doing all of the work on this thread.
+            numParts = 1;
+        }
+    }
+    int32_t firstLimit = count / numParts;
+    if(numParts == 1) {
+        firstLimit = count;
+    }
+    for(int32_t i = 0; i < numParts - 1; ++i) {
+        SortKeysPart &part = parts[i];
+        part.start = (int32_t)(((int64_t)count * (i + 1)) / numParts);
+        part.limit = (int32_t)(((int64_t)count * (i + 2)) / numParts);
+    }
+
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), capacity);
+    parallelFor(numParts, [&](int32_t i) {
+        if(i == 0) {
+            writeSortKeys(sources, sourceLengths, 0, firstLimit, sink, offsets, errorCode);
+        } else {
+            SortKeysPart &part = parts[i - 1];
+            BatchSortKeyByteSink partSink(part.buffer);
+            writeSortKeys(sources, sourceLengths, part.start, part.limit,
+                          partSink, offsets, part.errorCode);
+            if(U_SUCCESS(part.errorCode) && !partSink.IsOk()) {
+                part.errorCode = U_MEMORY_ALLOCATION_ERROR;
+            }
+            part.length = partSink.NumberOfBytesAppended();
+        }
+    });
+    int32_t length = sink.NumberOfBytesAppended();
+
+    for(int32_t i = 0; i < numParts - 1; ++i) {
+        SortKeysPart &part = parts[i];
+        if(U_FAILURE(part.errorCode) && U_SUCCESS(errorCode)) {
+            errorCode = part.errorCode;
+        }
+        if(U_FAILURE(errorCode)) { continue; }
+        for(int32_t j = part.start; j < part.limit; ++j) {
+            offsets[j] += length;
+        }
+        if(length < capacity) {
+            int32_t n = capacity - length;
+            if(n > part.length) {
+                n = part.length;
+            }
+            uprv_memcpy(dest + length, part.buffer.getAlias(), n);
+        }
+        length += part.length;
+    }
+    if(U_FAILURE(errorCode)) { return 0; }
+    offsets[count] = length;
+    if(length > capacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+int32_t
+RuleBasedCollator::internalGetSortKeys(const UChar *const sources[], const int32_t sourceLengths[],
+                                       int32_t count, uint8_t *dest, int32_t capacity,
+                                       int32_t offsets[], int32_t numThreads,
+                                       UErrorCode &errorCode) const {
+    return getSortKeys(sources, sourceLengths, count, dest, capacity,
+                       offsets, numThreads, errorCode);
+}
+
+int32_t
+RuleBasedCollator::internalGetSortKeysUTF8(const char *const sources[], const int32_t sourceLengths[],
+                                           int32_t count, uint8_t *dest, int32_t capacity,
+                                           int32_t offsets[], int32_t numThreads,
+                                           UErrorCode &errorCode) const {
+    return getSortKeys(sources, sourceLengths, count, dest, capacity,
+                       offsets, numThreads, errorCode);
+}
+
+namespace {
+
+void
+writeSortPrefix(CollationIterator &iter, const CollationData &data,
+                const CollationSettings &settings, UBool identical,
+                SortPrefix &prefix, UErrorCode &errorCode) {
+    uprv_memset(prefix.key, 0, SORT_PREFIX_LENGTH);
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(prefix.key), SORT_PREFIX_LENGTH);
+    CollationKeys::LevelCallback callback;
+    // Not preflighting: Stops as soon as the primary level overflows the prefix.
+    CollationKeys::writeSortKeyUpToQuaternary(iter, data.compressibleBytes, settings,
+                                              sink, Collation::PRIMARY_LEVEL,
+                                              callback, FALSE, errorCode);
+    // The identical level is not written, so such prefixes are never complete.
+    prefix.isComplete = !sink.Overflowed() && !identical;
+}
+
+void
+writeSortPrefixes(const CollationData *data, const CollationSettings &settings,
+                  const UChar *const sources[], const int32_t sourceLengths[],
+                  int32_t start, int32_t limit, SortPrefix prefixes[], UErrorCode &errorCode) {
+    UBool numeric = settings.isNumeric();
+    UBool checkFCD = !settings.dontCheckFCD();
+    UBool identical = settings.getStrength() == UCOL_IDENTICAL;
+    UTF16CollationIterator iter(data, numeric, NULL, NULL, NULL);
+    FCDUTF16CollationIterator fcdIter(data, numeric, NULL, NULL, NULL);
+    for(int32_t i = start; i < limit && U_SUCCESS(errorCode); ++i) {
+        SortPrefix &prefix = prefixes[i];
+        prefix.index = i;
+        const UChar *s = sources[i];
+        int32_t length = sourceLengths != NULL ? sourceLengths[i] : -1;
+        if(s == NULL) {
+            // NULL with length 0, see sortStrings()
+            static const UChar empty = 0;
+            s = &empty;
+        }
+        const UChar *sLimit = (length >= 0) ? s + length : NULL;
+        if(checkFCD) {
+            fcdIter.setText(s, sLimit);
+            writeSortPrefix(fcdIter, *data, settings, identical, prefix, errorCode);
+        } else {
+            iter.setText(s, sLimit);
+            writeSortPrefix(iter, *data, settings, identical, prefix, errorCode);
+        }
+    }
+}
+
+void
+writeSortPrefixes(const CollationData *data, const CollationSettings &settings,
+                  const char *const sources[], const int32_t sourceLengths[],
+                  int32_t start, int32_t limit, SortPrefix prefixes[], UErrorCode &errorCode) {
+    UBool numeric = settings.isNumeric();
+    UBool checkFCD = !settings.dontCheckFCD();
+    UBool identical = settings.getStrength() == UCOL_IDENTICAL;
+    UTF8CollationIterator iter(data, numeric, NULL, 0, 0);
+    FCDUTF8CollationIterator fcdIter(data, numeric, NULL, 0, 0);
+    for(int32_t i = start; i < limit && U_SUCCESS(errorCode); ++i) {
+        SortPrefix &prefix = prefixes[i];
+        prefix.index = i;
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(sources[i]);
+        int32_t length = sourceLengths != NULL ? sourceLengths[i] : -1;
+        if(s == NULL) {
+            // NULL with length 0, see sortStrings()
+            static const uint8_t empty = 0;
+            s = &empty;
+        }
+        if(checkFCD) {
+            fcdIter.setText(s, length);
+            writeSortPrefix(fcdIter, *data, settings, identical, prefix, errorCode);
+        } else {
+            iter.setText(s, length);
+            writeSortPrefix(iter, *data, settings, identical, prefix, errorCode);
+        }
+    }
+}
+
+}  // namespace
+
+template<typename CharType>
+void
+RuleBasedCollator::sortStrings(const CharType *const sources[], const int32_t sourceLengths[],
+                               int32_t count, int32_t indexes[], int32_t numThreads,
+                               UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    if(count < 0 || (sources == NULL && count > 0) || (indexes == NULL && count > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        if(sources[i] == NULL) {
+            if(sourceLengths == NULL || sourceLengths[i] != 0) {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+        }
+    }
+    if(count == 0) { return; }
+
+    // Split the array into one part per thread.
+    // Each thread computes the sort key prefixes for its part and sorts them.
+    // Then adjacent sorted runs are merged pairwise, again one merge per thread,
+    // until there is only one run left.
+    if(numThreads > count / MIN_SORT_STRINGS_PER_THREAD) {
+        numThreads = count / MIN_SORT_STRINGS_PER_THREAD;
+    }
+    int32_t numParts = numThreads > 1 ? numThreads : 1;
+    LocalMemory<SortPrefix> prefixes;
+    LocalMemory<SortPrefix> buffer;
+    if(prefixes.allocateInsteadAndReset(count) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    MaybeStackArray<int32_t, 20> bounds;
+    MaybeStackArray<UErrorCode, 20> errorCodes;
+    if(numParts > 1) {
+        if(buffer.allocateInsteadAndReset(count) == NULL ||
+                bounds.resize(numParts + 1) == NULL || errorCodes.resize(numParts) == NULL) {
+            // Fall back to doing all of the work on this thread.
+            numParts = 1;
+        }
+    }
+    for(int32_t i = 0; i <= numParts; ++i) {
+        bounds[i] = (int32_t)(((int64_t)count * i) / numParts);
+    }
+    for(int32_t i = 0; i < numParts; ++i) {
+        errorCodes[i] = U_ZERO_ERROR;
+    }
+
+    SortStringsContext<CharType> context = { this, sources, sourceLengths };
+    SortPrefix *src = prefixes.getAlias();
+    parallelFor(numParts, [&](int32_t i) {
+        writeSortPrefixes(data, *settings, sources, sourceLengths,
+                          bounds[i], bounds[i + 1], src, errorCodes[i]);
+        uprv_sortArray(src + bounds[i], bounds[i + 1] - bounds[i], (int32_t)sizeof(SortPrefix),
+                       compareSortPrefixes<CharType>, &context, FALSE, &errorCodes[i]);
+    });
+    for(int32_t i = 0; i < numParts; ++i) {
+        if(U_FAILURE(errorCodes[i]) && U_SUCCESS(errorCode)) {
+            errorCode = errorCodes[i];
+        }
+    }
+    if(U_FAILURE(errorCode)) { return; }
+
+    SortPrefix *dest = buffer.getAlias();
+    int32_t numRuns = numParts;
+    while(numRuns > 1) {
+        int32_t numMerges = numRuns / 2;
+        parallelFor(numMerges, [&](int32_t i) {
+            mergeSortPrefixes(src, bounds[2 * i], bounds[2 * i + 1], bounds[2 * i + 2],
+                              dest, &context);
+        });
+        if((numRuns & 1) != 0) {
+            int32_t start = bounds[numRuns - 1];
+            uprv_memcpy(dest + start, src + start,
+                        (bounds[numRuns] - start) * sizeof(SortPrefix));
+        }
+        // Keep the bounds of the merged runs.
+        int32_t j = 0;
+        for(int32_t i = 0; i <= numRuns; i += 2) {
+            bounds[j++] = bounds[i];
+        }
+        if((numRuns & 1) != 0) {
+            bounds[j++] = bounds[numRuns];
+        }
+        numRuns = j - 1;
+        SortPrefix *temp = src;
+        src = dest;
+        dest = temp;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        indexes[i] = src[i].index;
+    }
+}
+
+void
+RuleBasedCollator::internalSortStrings(const UChar *const sources[], const int32_t sourceLengths[],
+                                       int32_t count, int32_t indexes[], int32_t numThreads,
+                                       UErrorCode &errorCode) const {
+    sortStrings(sources, sourceLengths, count, indexes, numThreads, errorCode);
+}
+
+void
+RuleBasedCollator::internalSortStringsUTF8(const char *const sources[],
+                                           const int32_t sourceLengths[],
+                                           int32_t count, int32_t indexes[], int32_t numThreads,
+                                           UErrorCode &errorCode) const {
+    sortStrings(sources, sourceLengths, count, indexes, numThreads, errorCode);
+}
+
 void
 RuleBasedCollator::writeIdenticalLevel(const UChar *s, const UChar *limit,
                                        SortKeyByteSink &sink, UErrorCode &errorCode) const {
@@ -1379,6 +1969,30 @@ RuleBasedCollator::writeIdenticalLevel(const UChar *s, const UChar *limit,
     u_writeIdenticalLevelRun(prev, nfd.getBuffer(), nfd.length(), sink);
 }
 
+void
+RuleBasedCollator::writeIdenticalLevelUTF8(const uint8_t *s, int32_t length,
+                                           SortKeyByteSink &sink, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    // The identical level is rarely used; go through UTF-16,
+    // with ill-formed sequences as U+FFFD like the UTF-8 collation iterators.
+    if(length < 0) {
+        length = static_cast<int32_t>(uprv_strlen(reinterpret_cast<const char *>(s)));
+    }
+    UnicodeString s16;
+    // The UTF-16 string is not longer than the UTF-8 one.
+    UChar *buffer = s16.getBuffer(length);
+    if(buffer == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t length16 = 0;
+    u_strFromUTF8WithSub(buffer, s16.getCapacity(), &length16,
+                         reinterpret_cast<const char *>(s), length, 0xfffd, NULL, &errorCode);
+    s16.releaseBuffer(length16);
+    if(U_FAILURE(errorCode)) { return; }
+    writeIdenticalLevel(s16.getBuffer(), s16.getBuffer() + length16, sink, errorCode);
+}
+
 namespace {
 
 /**
@@ -1437,7 +2051,20 @@ RuleBasedCollator::internalNextSortKeyPart(UCharIterator *iter, uint32_t state[2
     if(level <= Collation::QUATERNARY_LEVEL) {
         UBool numeric = settings->isNumeric();
         PartLevelCallback callback(sink);
-        if(settings->dontCheckFCD()) {
+        int32_t length8;
+        const uint8_t *s8 = reinterpret_cast<const uint8_t *>(uiter_getUTF8(iter, &length8));
+        if(s8 != NULL) {
+            // Iterate over the UTF-8 bytes directly rather than via UTF-16 code units.
+            if(settings->dontCheckFCD()) {
+                UTF8CollationIterator ci(data, numeric, s8, 0, length8);
+                CollationKeys::writeSortKeyUpToQuaternary(ci, data->compressibleBytes, *settings,
+                                                          sink, level, callback, FALSE, errorCode);
+            } else {
+                FCDUTF8CollationIterator ci(data, numeric, s8, 0, length8);
+                CollationKeys::writeSortKeyUpToQuaternary(ci, data->compressibleBytes, *settings,
+                                                          sink, level, callback, FALSE, errorCode);
+            }
+        } else if(settings->dontCheckFCD()) {
             UIterCollationIterator ci(data, numeric, *iter);
             CollationKeys::writeSortKeyUpToQuaternary(ci, data->compressibleBytes, *settings,
                                                       sink, level, callback, FALSE, errorCode);
@@ -33,6 +33,7 @@
 #include "collation.h"
 #include "cstring.h"
 #include "putilimp.h"
+#include "uarrsort.h"
 #include "uassert.h"
 #include "utracimp.h"
 
@@ -209,6 +210,200 @@ ucol_getSortKey(const    UCollator    *coll,
     return keySize;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyUTF8(const UCollator *coll,
+                    const char *source, int32_t sourceLength,
+                    uint8_t *result, int32_t resultLength,
+                    UErrorCode *status)
+{
+    // A batch of one.
+    const char *sources[1] = { source };
+    int32_t sourceLengths[1] = { sourceLength };
+    int32_t offsets[2];
+    return ucol_getSortKeysUTF8(coll, sources, sourceLengths, 1,
+                                result, resultLength, offsets, 1, status);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const sources[], const int32_t sourceLengths[], int32_t count,
+                 uint8_t *dest, int32_t destCapacity, int32_t offsets[],
+                 int32_t numThreads, UErrorCode *status)
+{
+    if(status==NULL || U_FAILURE(*status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        return rbc->internalGetSortKeys(sources, sourceLengths, count,
+                                        dest, destCapacity, offsets, numThreads, *status);
+    }
+    // Not a RuleBasedCollator: one string at a time.
+    if(count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+            destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const Collator *c = Collator::fromUCollator(coll);
+    int32_t length = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = length;
+        int32_t capacity = length < destCapacity ? destCapacity - length : 0;
+        int32_t keyLength = c->getSortKey(sources[i], sourceLengths != NULL ? sourceLengths[i] : -1,
+                                          capacity > 0 ? dest + length : NULL, capacity);
+        if(keyLength == 0) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        length += keyLength;
+    }
+    offsets[count] = length;
+    if(length > destCapacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const sources[], const int32_t sourceLengths[], int32_t count,
+                     uint8_t *dest, int32_t destCapacity, int32_t offsets[],
+                     int32_t numThreads, UErrorCode *status)
+{
+    if(status==NULL || U_FAILURE(*status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        return rbc->internalGetSortKeysUTF8(sources, sourceLengths, count,
+                                            dest, destCapacity, offsets, numThreads, *status);
+    }
+    // Not a RuleBasedCollator: one string at a time.
+    if(count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+            destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const Collator *c = Collator::fromUCollator(coll);
+    UnicodeString s16;
+    int32_t length = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = length;
+        int32_t sourceLength = sourceLengths != NULL ? sourceLengths[i] : -1;
+        if(sourceLength < 0) {
+            sourceLength = (int32_t)uprv_strlen(sources[i]);
+        }
+        s16 = UnicodeString::fromUTF8(StringPiece(sources[i], sourceLength));
+        int32_t capacity = length < destCapacity ? destCapacity - length : 0;
+        int32_t keyLength = c->getSortKey(s16, capacity > 0 ? dest + length : NULL, capacity);
+        if(keyLength == 0) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+        length += keyLength;
+    }
+    offsets[count] = length;
+    if(length > destCapacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+namespace {
+
+template<typename CharType>
+struct CollatorSortContext {
+    const Collator *coll;
+    const CharType *const *sources;
+    const int32_t *sourceLengths;
+};
+
+inline UCollationResult
+compareSources(const Collator &coll,
+               const UChar *left, int32_t leftLength,
+               const UChar *right, int32_t rightLength, UErrorCode &errorCode) {
+    return coll.compare(left, leftLength, right, rightLength, errorCode);
+}
+
+inline UCollationResult
+compareSources(const Collator &coll,
+               const char *left, int32_t leftLength,
+               const char *right, int32_t rightLength, UErrorCode &errorCode) {
+    return coll.internalCompareUTF8(left, leftLength, right, rightLength, errorCode);
+}
+
+template<typename CharType>
+int32_t U_CALLCONV
+compareIndexedSources(const void *context, const void *left, const void *right) {
+    const CollatorSortContext<CharType> &ctx =
+        *static_cast<const CollatorSortContext<CharType> *>(context);
+    int32_t l = *static_cast<const int32_t *>(left);
+    int32_t r = *static_cast<const int32_t *>(right);
+    const int32_t *lengths = ctx.sourceLengths;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    return compareSources(*ctx.coll,
+                          ctx.sources[l], lengths != NULL ? lengths[l] : -1,
+                          ctx.sources[r], lengths != NULL ? lengths[r] : -1,
+                          errorCode);
+}
+
+/**
+ * Implements ucol_sortStrings() for collators that are not RuleBasedCollators:
+ * Stable sort of the indexes, comparing the strings.
+ */
+template<typename CharType>
+void
+sortIndexedSources(const Collator &coll,
+                   const CharType *const sources[], const int32_t sourceLengths[], int32_t count,
+                   int32_t indexes[], UErrorCode &errorCode) {
+    if(count < 0 || (sources == NULL && count > 0) || (indexes == NULL && count > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        indexes[i] = i;
+    }
+    CollatorSortContext<CharType> context = { &coll, sources, sourceLengths };
+    uprv_sortArray(indexes, count, (int32_t)sizeof(int32_t),
+                   compareIndexedSources<CharType>, &context, TRUE, &errorCode);
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const sources[], const int32_t sourceLengths[], int32_t count,
+                 int32_t indexes[], int32_t numThreads, UErrorCode *status)
+{
+    if(status==NULL || U_FAILURE(*status)) {
+        return;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        rbc->internalSortStrings(sources, sourceLengths, count, indexes, numThreads, *status);
+    } else {
+        sortIndexedSources(*Collator::fromUCollator(coll), sources, sourceLengths, count,
+                           indexes, *status);
+    }
+}
+
+U_CAPI void U_EXPORT2
+ucol_sortStringsUTF8(const UCollator *coll,
+                     const char *const sources[], const int32_t sourceLengths[], int32_t count,
+                     int32_t indexes[], int32_t numThreads, UErrorCode *status)
+{
+    if(status==NULL || U_FAILURE(*status)) {
+        return;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        rbc->internalSortStringsUTF8(sources, sourceLengths, count, indexes, numThreads, *status);
+    } else {
+        sortIndexedSources(*Collator::fromUCollator(coll), sources, sourceLengths, count,
+                           indexes, *status);
+    }
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_nextSortKeyPart(const UCollator *coll,
                      UCharIterator *iter,
@@ -1023,6 +1023,44 @@ class U_I18N_API Collator : public UObject {
     virtual int32_t getSortKey(const char16_t*source, int32_t sourceLength,
                                uint8_t*result, int32_t resultLength) const = 0;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Sorts an array of strings according to this collator, in place.
+     * Strings that compare equal keep their relative order (the sort is stable).
+     *
+     * For large arrays, this is much faster than sorting with compare():
+     * A short prefix of each sort key is computed once, and the strings are
+     * compared only when their prefixes are equal.
+     * Optionally, the work is split across several threads.
+     *
+     * @param strings Array of strings to be sorted.
+     * @param count The number of strings.
+     * @param numThreads The maximum number of threads to use, including the calling one.
+     *                   1 (or less) sorts the whole array on the calling thread.
+     * @param status ICU error code.
+     * @see ucol_sortStrings
+     * @draft ICU 64
+     */
+    void sortStrings(UnicodeString strings[], int32_t count, int32_t numThreads,
+                     UErrorCode &status) const;
+
+    /**
+     * Sorts an array of UTF-8 strings according to this collator, in place.
+     * Same as the UnicodeString version except that the strings are in UTF-8.
+     * Only the StringPiece objects are reordered, not the string contents.
+     *
+     * @param strings Array of UTF-8 strings to be sorted.
+     * @param count The number of strings.
+     * @param numThreads The maximum number of threads to use, including the calling one.
+     *                   1 (or less) sorts the whole array on the calling thread.
+     * @param status ICU error code.
+     * @see ucol_sortStringsUTF8
+     * @draft ICU 64
+     */
+    void sortStrings(StringPiece strings[], int32_t count, int32_t numThreads,
+                     UErrorCode &status) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Produce a bound for a given sortkey and a number of levels.
      * Return value is always the number of bytes needed, regardless of
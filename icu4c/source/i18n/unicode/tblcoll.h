@@ -790,6 +790,40 @@ class U_I18N_API RuleBasedCollator : public Collator {
      * @internal for tests & tools
      */
     void internalGetCEs(const UnicodeString &str, UVector64 &ces, UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_getSortKeys().
+     * @internal
+     */
+    int32_t internalGetSortKeys(const char16_t *const sources[], const int32_t sourceLengths[],
+                                int32_t count, uint8_t *dest, int32_t capacity,
+                                int32_t offsets[], int32_t numThreads,
+                                UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_getSortKeysUTF8().
+     * @internal
+     */
+    int32_t internalGetSortKeysUTF8(const char *const sources[], const int32_t sourceLengths[],
+                                    int32_t count, uint8_t *dest, int32_t capacity,
+                                    int32_t offsets[], int32_t numThreads,
+                                    UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_sortStrings().
+     * @internal
+     */
+    void internalSortStrings(const char16_t *const sources[], const int32_t sourceLengths[],
+                             int32_t count, int32_t indexes[], int32_t numThreads,
+                             UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_sortStringsUTF8().
+     * @internal
+     */
+    void internalSortStringsUTF8(const char *const sources[], const int32_t sourceLengths[],
+                                 int32_t count, int32_t indexes[], int32_t numThreads,
+                                 UErrorCode &errorCode) const;
 #endif  // U_HIDE_INTERNAL_API
 
 protected:
@@ -834,6 +868,28 @@ class U_I18N_API RuleBasedCollator : public Collator {
     void writeIdenticalLevel(const char16_t *s, const char16_t *limit,
                              SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
+    void writeIdenticalLevelUTF8(const uint8_t *s, int32_t length,
+                                 SortKeyByteSink &sink, UErrorCode &errorCode) const;
+
+    // Batch sort keys: Appends the keys for sources[start..limit[ to the sink
+    // and sets offsets[start..limit[ to where they start in the sink.
+    void writeSortKeys(const char16_t *const sources[], const int32_t sourceLengths[],
+                       int32_t start, int32_t limit, SortKeyByteSink &sink,
+                       int32_t offsets[], UErrorCode &errorCode) const;
+    void writeSortKeys(const char *const sources[], const int32_t sourceLengths[],
+                       int32_t start, int32_t limit, SortKeyByteSink &sink,
+                       int32_t offsets[], UErrorCode &errorCode) const;
+
+    template<typename CharType>
+    int32_t getSortKeys(const CharType *const sources[], const int32_t sourceLengths[],
+                        int32_t count, uint8_t *dest, int32_t capacity,
+                        int32_t offsets[], int32_t numThreads, UErrorCode &errorCode) const;
+
+    template<typename CharType>
+    void sortStrings(const CharType *const sources[], const int32_t sourceLengths[],
+                     int32_t count, int32_t indexes[], int32_t numThreads,
+                     UErrorCode &errorCode) const;
+
     const CollationSettings &getDefaultSettings() const;
 
     void setAttributeDefault(int32_t attribute) {
@@ -1020,6 +1020,32 @@ ucol_getSortKey(const    UCollator    *coll,
         int32_t        resultLength);
 
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Get a sort key for a UTF-8 string from a UCollator.
+ * The key is the same as the one from ucol_getSortKey() for the equivalent
+ * UTF-16 string; ill-formed UTF-8 sequences are treated like U+FFFD.
+ * The string is not converted to UTF-16 (except for the identical level).
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The UTF-8 string to transform.
+ * @param sourceLength The length of source in bytes, or -1 if NUL-terminated.
+ * @param result A pointer to a buffer to receive the sort key.
+ * @param resultLength The maximum size of result.
+ * @param status ICU error code. Set to U_BUFFER_OVERFLOW_ERROR
+ *               if the key does not fit into result.
+ * @return The size needed to fully store the sort key,
+ *         including the terminating zero byte.
+ * @see ucol_getSortKey
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getSortKeyUTF8(const UCollator *coll,
+                    const char *source, int32_t sourceLength,
+                    uint8_t *result, int32_t resultLength,
+                    UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /** Gets the next count bytes of a sort key. Caller needs
  *  to preserve state array between calls and to provide
  *  the same type of UCharIterator set with the same string.
@@ -1028,6 +1054,8 @@ ucol_getSortKey(const    UCollator    *coll,
  *
  *  The generated sort key may or may not be compatible with
  *  sort keys generated using ucol_getSortKey().
+ *  An iterator set up with uiter_setUTF8() is processed
+ *  directly in UTF-8.
  *  @param coll The UCollator containing the collation rules.
  *  @param iter UCharIterator containing the string we need 
  *              the sort key to be calculated for.
@@ -1047,6 +1075,136 @@ ucol_nextSortKeyPart(const UCollator *coll,
                      uint8_t *dest, int32_t count,
                      UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Gets the sort keys for an array of strings.
+ * The keys are the same as those from ucol_getSortKey(), each including its
+ * terminating zero byte. They are written one after another into the dest buffer,
+ * and offsets[i] is set to the index in dest where the key for sources[i] starts.
+ * offsets[count] is set to the total length.
+ * The length of the key for sources[i] is offsets[i+1]-offsets[i].
+ *
+ * This is faster than calling ucol_getSortKey() for each string
+ * because the setup is done only once for the whole batch.
+ * Optionally, the batch is split across several threads.
+ * The result does not depend on the number of threads.
+ *
+ * This function supports preflighting: If the total length is greater than
+ * destCapacity, then *status is set to U_BUFFER_OVERFLOW_ERROR,
+ * the offsets are set as if dest had been large enough,
+ * and the contents of dest are undefined.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count pointers to the strings.
+ *                A pointer can be NULL if the corresponding length is 0.
+ * @param sourceLengths Array of count string lengths; a length can be -1 if
+ *                      the string is NUL-terminated. If sourceLengths is NULL,
+ *                      then all of the strings must be NUL-terminated.
+ * @param count The number of strings.
+ * @param dest Buffer for all of the sort keys; can be NULL if destCapacity==0.
+ * @param destCapacity The size of the dest buffer.
+ * @param offsets Array of count+1 elements, receives the start offsets of the keys
+ *                and the total length.
+ * @param numThreads The maximum number of threads to use, including the calling one.
+ *                   1 (or less) processes the whole batch on the calling thread.
+ * @param status ICU error code.
+ * @return The total length of all of the sort keys.
+ * @see ucol_getSortKey
+ * @see ucol_getSortKeysUTF8
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const sources[], const int32_t sourceLengths[], int32_t count,
+                 uint8_t *dest, int32_t destCapacity, int32_t offsets[],
+                 int32_t numThreads, UErrorCode *status);
+
+/**
+ * Gets the sort keys for an array of UTF-8 strings.
+ * Same as ucol_getSortKeys() except that the strings are in UTF-8.
+ * The keys are the same as for the equivalent UTF-16 strings.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count pointers to the UTF-8 strings.
+ *                A pointer can be NULL if the corresponding length is 0.
+ * @param sourceLengths Array of count string lengths; a length can be -1 if
+ *                      the string is NUL-terminated. If sourceLengths is NULL,
+ *                      then all of the strings must be NUL-terminated.
+ * @param count The number of strings.
+ * @param dest Buffer for all of the sort keys; can be NULL if destCapacity==0.
+ * @param destCapacity The size of the dest buffer.
+ * @param offsets Array of count+1 elements, receives the start offsets of the keys
+ *                and the total length.
+ * @param numThreads The maximum number of threads to use, including the calling one.
+ *                   1 (or less) processes the whole batch on the calling thread.
+ * @param status ICU error code.
+ * @return The total length of all of the sort keys.
+ * @see ucol_getSortKeys
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const sources[], const int32_t sourceLengths[], int32_t count,
+                     uint8_t *dest, int32_t destCapacity, int32_t offsets[],
+                     int32_t numThreads, UErrorCode *status);
+
+/**
+ * Sorts an array of strings according to the collator.
+ * The strings themselves are not modified. Instead, indexes[i] is set to the index
+ * in sources of the string that sorts at position i.
+ * Strings that compare equal keep their relative input order (the sort is stable).
+ *
+ * This is much faster than sorting with ucol_strcoll() for large arrays:
+ * A short prefix of each sort key is computed once, the prefixes are sorted,
+ * and the strings are compared only when their prefixes are equal.
+ * Optionally, the work is split across several threads and the sorted parts
+ * are merged. The result does not depend on the number of threads.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count pointers to the strings.
+ *                A pointer can be NULL if the corresponding length is 0.
+ * @param sourceLengths Array of count string lengths; a length can be -1 if
+ *                      the string is NUL-terminated. If sourceLengths is NULL,
+ *                      then all of the strings must be NUL-terminated.
+ * @param count The number of strings.
+ * @param indexes Array of count elements, receives the sorted order.
+ * @param numThreads The maximum number of threads to use, including the calling one.
+ *                   1 (or less) sorts the whole array on the calling thread.
+ * @param status ICU error code.
+ * @see ucol_strcoll
+ * @see ucol_sortStringsUTF8
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const sources[], const int32_t sourceLengths[], int32_t count,
+                 int32_t indexes[], int32_t numThreads, UErrorCode *status);
+
+/**
+ * Sorts an array of UTF-8 strings according to the collator.
+ * Same as ucol_sortStrings() except that the strings are in UTF-8.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count pointers to the UTF-8 strings.
+ *                A pointer can be NULL if the corresponding length is 0.
+ * @param sourceLengths Array of count string lengths; a length can be -1 if
+ *                      the string is NUL-terminated. If sourceLengths is NULL,
+ *                      then all of the strings must be NUL-terminated.
+ * @param count The number of strings.
+ * @param indexes Array of count elements, receives the sorted order.
+ * @param numThreads The maximum number of threads to use, including the calling one.
+ *                   1 (or less) sorts the whole array on the calling thread.
+ * @param status ICU error code.
+ * @see ucol_strcollUTF8
+ * @see ucol_sortStrings
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucol_sortStringsUTF8(const UCollator *coll,
+                     const char *const sources[], const int32_t sourceLengths[], int32_t count,
+                     int32_t indexes[], int32_t numThreads, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /** enum that is taken by ucol_getBound API 
  * See below for explanation                
  * do not change the values assigned to the 
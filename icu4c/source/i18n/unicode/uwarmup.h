@@ -0,0 +1,133 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  uwarmup.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*/
+
+#ifndef UWARMUP_H
+#define UWARMUP_H
+
+#include "unicode/utypes.h"
+
+/**
+ * \file
+ * \brief C API: Load and cache ICU data ahead of time.
+ *
+ * The first Collator, NumberFormat or BreakIterator for a locale
+ * is expensive: ICU data pages are faulted in from the data file or library,
+ * and tries and other structures are built lazily and cached.
+ * u_warmup() does that work ahead of time, optionally on a background thread,
+ * so that the first "real" instance in a server process is as fast as later ones.
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Bit set values for the services that u_warmup() loads.
+ * @draft ICU 64
+ */
+typedef enum UWarmupService {
+    /** Normalizer2 NFC and NFKC data. @draft ICU 64 */
+    UWARMUP_NORMALIZER = 1,
+    /** The root collator and the collation tailoring for each locale. @draft ICU 64 */
+    UWARMUP_COLLATOR = 2,
+    /** Decimal number format symbols and patterns for each locale. @draft ICU 64 */
+    UWARMUP_NUMBER_FORMAT = 4,
+    /** Character, word, line and sentence break rules for each locale. @draft ICU 64 */
+    UWARMUP_BREAK_ITERATOR = 8,
+    /** All of the above. @draft ICU 64 */
+    UWARMUP_ALL_SERVICES = 0xf
+} UWarmupService;
+
+/**
+ * Bit set values for u_warmup() options.
+ * @draft ICU 64
+ */
+typedef enum UWarmupOption {
+    /**
+     * Run the warmup on a new thread and return right away.
+     * Use u_waitForWarmup() to wait for it and to get its results.
+     * If no thread can be started, then u_warmup() runs the warmup
+     * on the calling thread before it returns.
+     * @draft ICU 64
+     */
+    UWARMUP_IN_BACKGROUND = 1,
+    /**
+     * Before anything else, advise the operating system that all of the
+     * common ICU data will be needed (madvise(MADV_WILLNEED) where supported),
+     * so that it is read ahead rather than faulted in page by page.
+     * @draft ICU 64
+     */
+    UWARMUP_ADVISE_WILLNEED = 2
+} UWarmupOption;
+
+/**
+ * Time spent in each phase of the most recent u_warmup(), in milliseconds.
+ * Phases that were not requested, or that are not available
+ * in this build of ICU, have a time of 0.
+ * @draft ICU 64
+ */
+typedef struct UWarmupTimings {
+    /** u_init() and UWARMUP_ADVISE_WILLNEED. @draft ICU 64 */
+    double dataMillis;
+    /** UWARMUP_NORMALIZER. @draft ICU 64 */
+    double normalizerMillis;
+    /** UWARMUP_COLLATOR. @draft ICU 64 */
+    double collatorMillis;
+    /** UWARMUP_NUMBER_FORMAT. @draft ICU 64 */
+    double numberFormatMillis;
+    /** UWARMUP_BREAK_ITERATOR. @draft ICU 64 */
+    double breakIteratorMillis;
+    /** The whole warmup, from start to finish. @draft ICU 64 */
+    double totalMillis;
+    /** Number of bytes for which UWARMUP_ADVISE_WILLNEED was given, 0 if none. @draft ICU 64 */
+    int32_t advisedBytes;
+} UWarmupTimings;
+
+/**
+ * Loads, decodes and caches the ICU data for the given services and locales,
+ * so that later instances are created from cached data.
+ *
+ * If a previous background warmup is still running, then this function
+ * first waits for it to finish.
+ *
+ * Errors for individual locales do not stop the warmup;
+ * the first one is reported by u_waitForWarmup().
+ *
+ * @param locales array of locale IDs; if NULL, then the default locale is used
+ * @param localeCount number of locale IDs; ignored if locales is NULL
+ * @param services bit set of UWarmupService values
+ * @param options bit set of UWarmupOption values
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ *                   Reports only errors in starting the warmup;
+ *                   use u_waitForWarmup() for the results of the work itself.
+ * @see u_waitForWarmup
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+u_warmup(const char *const locales[], int32_t localeCount,
+         uint32_t services, uint32_t options,
+         UErrorCode *pErrorCode);
+
+/**
+ * Waits for a background warmup to finish, if one is running,
+ * and returns the results of the most recent u_warmup().
+ *
+ * @param timings if not NULL, receives the time spent in each phase
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ *                   Set to the first error that the warmup encountered.
+ * @see u_warmup
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+u_waitForWarmup(UWarmupTimings *timings, UErrorCode *pErrorCode);
+
+#endif  /* U_HIDE_DRAFT_API */
+
+#endif  /* UWARMUP_H */
@@ -99,6 +99,12 @@ class U_I18N_API FCDUTF16CollationIterator : public UTF16CollationIterator {
 
     virtual void resetToOffset(int32_t newOffset);
 
+    void setText(const UChar *s, const UChar *lim) {
+        rawStart = s;
+        rawLimit = lim;
+        resetToOffset(0);
+    }
+
     virtual int32_t getOffset() const;
 
     virtual UChar32 nextCodePoint(UErrorCode &errorCode);
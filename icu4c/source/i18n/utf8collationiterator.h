@@ -42,6 +42,13 @@ class U_I18N_API UTF8CollationIterator : public CollationIterator {
 
     virtual void resetToOffset(int32_t newOffset);
 
+    void setText(const uint8_t *s, int32_t len) {
+        reset();
+        u8 = s;
+        pos = 0;
+        length = len;
+    }
+
     virtual int32_t getOffset() const;
 
     virtual UChar32 nextCodePoint(UErrorCode &errorCode);
@@ -89,6 +96,12 @@ class U_I18N_API FCDUTF8CollationIterator : public UTF8CollationIterator {
 
     virtual void resetToOffset(int32_t newOffset);
 
+    void setText(const uint8_t *s, int32_t len) {
+        UTF8CollationIterator::setText(s, len);
+        state = CHECK_FWD;
+        start = 0;
+    }
+
     virtual int32_t getOffset() const;
 
     virtual UChar32 nextCodePoint(UErrorCode &errorCode);
@@ -0,0 +1,268 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  uwarmup.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Loads and caches ICU data ahead of time, see uwarmup.h.
+*/
+
+#include "unicode/utypes.h"
+
+#include <chrono>
+#include <exception>
+#include <thread>
+
+#include "unicode/brkiter.h"
+#include "unicode/coll.h"
+#include "unicode/locid.h"
+#include "unicode/normalizer2.h"
+#include "unicode/numfmt.h"
+#include "unicode/uclean.h"
+#include "unicode/uscript.h"
+#include "unicode/uwarmup.h"
+#include "cmemory.h"
+#include "mutex.h"
+#include "ucln_in.h"
+#include "udatamem.h"
+#include "umutex.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/** One call to u_warmup(): the request, and then its results. */
+class Warmup : public UMemory {
+public:
+    Warmup(uint32_t services, uint32_t options) :
+            localeCount(0), services(services), options(options), errorCode(U_ZERO_ERROR) {
+        uprv_memset(&timings, 0, sizeof(timings));
+    }
+
+    void run();
+
+    LocalArray<Locale> locales;
+    int32_t localeCount;
+    uint32_t services;
+    uint32_t options;
+
+    UWarmupTimings timings;
+    UErrorCode errorCode;
+
+private:
+    void setError(UErrorCode ec) {
+        if (U_FAILURE(ec) && U_SUCCESS(errorCode)) {
+            errorCode = ec;
+        }
+    }
+    void warmUpBreakIterators(const Locale &locale);
+};
+
+typedef std::chrono::steady_clock Clock;
+
+/** Returns the milliseconds since start, and resets start to now. */
+double millisSince(Clock::time_point &start) {
+    Clock::time_point now = Clock::now();
+    double millis = std::chrono::duration<double, std::milli>(now - start).count();
+    start = now;
+    return millis;
+}
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+/**
+ * Runs each type of break iterator over sample text in the scripts of the locale,
+ * which also loads the dictionary break engines that those scripts need.
+ */
+void Warmup::warmUpBreakIterators(const Locale &locale) {
+    UnicodeString text;
+    UScriptCode scripts[8];
+    UErrorCode ec = U_ZERO_ERROR;
+    int32_t scriptCount = uscript_getCode(locale.getName(), scripts, UPRV_LENGTHOF(scripts), &ec);
+    for (int32_t i = 0; U_SUCCESS(ec) && i < scriptCount; ++i) {
+        UChar sample[8];
+        int32_t length = uscript_getSampleString(scripts[i], sample, UPRV_LENGTHOF(sample), &ec);
+        text.append(sample, length).append((UChar)0x20);
+    }
+    for (int32_t type = 0; type < 4; ++type) {
+        ec = U_ZERO_ERROR;
+        LocalPointer<BreakIterator> bi;
+        switch (type) {
+        case 0: bi.adoptInstead(BreakIterator::createCharacterInstance(locale, ec)); break;
+        case 1: bi.adoptInstead(BreakIterator::createWordInstance(locale, ec)); break;
+        case 2: bi.adoptInstead(BreakIterator::createLineInstance(locale, ec)); break;
+        default: bi.adoptInstead(BreakIterator::createSentenceInstance(locale, ec)); break;
+        }
+        if (U_FAILURE(ec)) {
+            setError(ec);
+            continue;
+        }
+        bi->setText(text);
+        while (bi->next() != BreakIterator::DONE) {}
+    }
+}
+
+#endif
+
+void Warmup::run() {
+    Clock::time_point start = Clock::now();
+    Clock::time_point phaseStart = start;
+
+    u_init(&errorCode);
+    if ((options & UWARMUP_ADVISE_WILLNEED) != 0) {
+        timings.advisedBytes = udata_adviseWillNeed(&errorCode);
+    }
+    timings.dataMillis = millisSince(phaseStart);
+
+#if !UCONFIG_NO_NORMALIZATION
+    if ((services & UWARMUP_NORMALIZER) != 0) {
+        UErrorCode ec = U_ZERO_ERROR;
+        Normalizer2::getNFCInstance(ec);
+        Normalizer2::getNFKCInstance(ec);
+        setError(ec);
+        timings.normalizerMillis = millisSince(phaseStart);
+    }
+#endif
+
+#if !UCONFIG_NO_COLLATION
+    if ((services & UWARMUP_COLLATOR) != 0) {
+        // The collation tailorings are kept in the UnifiedCache.
+        for (int32_t i = 0; i < localeCount; ++i) {
+            UErrorCode ec = U_ZERO_ERROR;
+            delete Collator::createInstance(locales[i], ec);
+            setError(ec);
+        }
+        timings.collatorMillis = millisSince(phaseStart);
+    }
+#endif
+
+#if !UCONFIG_NO_FORMATTING
+    if ((services & UWARMUP_NUMBER_FORMAT) != 0) {
+        // Decimal formats are kept in the UnifiedCache, and their
+        // resource bundles in the resource bundle cache.
+        for (int32_t i = 0; i < localeCount; ++i) {
+            UErrorCode ec = U_ZERO_ERROR;
+            LocalPointer<NumberFormat> nf(NumberFormat::createInstance(locales[i], ec));
+            if (U_SUCCESS(ec)) {
+                UnicodeString s;
+                nf->format(-1234.5, s);
+            }
+            setError(ec);
+        }
+        timings.numberFormatMillis = millisSince(phaseStart);
+    }
+#endif
+
+#if !UCONFIG_NO_BREAK_ITERATION
+    if ((services & UWARMUP_BREAK_ITERATOR) != 0) {
+        for (int32_t i = 0; i < localeCount; ++i) {
+            warmUpBreakIterators(locales[i]);
+        }
+        timings.breakIteratorMillis = millisSince(phaseStart);
+    }
+#endif
+
+    timings.totalMillis = millisSince(start);
+}
+
+// The background thread and the results of the most recent warmup.
+UMutex gWarmupMutex = U_MUTEX_INITIALIZER;
+std::thread *gWarmupThread = NULL;
+Warmup *gLastWarmup = NULL;
+
+/** Joins the background thread, if any. Must be called with gWarmupMutex held. */
+void joinWarmupThread() {
+    if (gWarmupThread != NULL) {
+        gWarmupThread->join();
+        delete gWarmupThread;
+        gWarmupThread = NULL;
+    }
+}
+
+}  // namespace
+
+U_CDECL_BEGIN
+static UBool U_CALLCONV uwarmup_cleanup() {
+    Mutex lock(&gWarmupMutex);
+    joinWarmupThread();
+    delete gLastWarmup;
+    gLastWarmup = NULL;
+    return TRUE;
+}
+U_CDECL_END
+
+U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CAPI void U_EXPORT2
+u_warmup(const char *const locales[], int32_t localeCount,
+         uint32_t services, uint32_t options,
+         UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if (locales != NULL && localeCount < 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    LocalPointer<Warmup> warmup(new Warmup(services, options), *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    // Copy the locales so that the caller's array need not outlive a background warmup.
+    warmup->localeCount = locales != NULL ? localeCount : 1;
+    if (warmup->localeCount > 0) {
+        warmup->locales.adoptInsteadAndCheckErrorCode(
+            new Locale[warmup->localeCount], *pErrorCode);
+        if (U_FAILURE(*pErrorCode)) {
+            return;
+        }
+        for (int32_t i = 0; locales != NULL && i < localeCount; ++i) {
+            warmup->locales[i] = Locale(locales[i]);
+            if (warmup->locales[i].isBogus()) {
+                *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+        }
+    }
+    ucln_i18n_registerCleanup(UCLN_I18N_WARMUP, uwarmup_cleanup);
+
+    Mutex lock(&gWarmupMutex);
+    joinWarmupThread();
+    if ((options & UWARMUP_IN_BACKGROUND) != 0) {
+        try {
+            gWarmupThread = new std::thread(&Warmup::run, warmup.getAlias());
+        } catch (const std::exception &) {
+            // std::system_error if no thread can be started, or std::bad_alloc.
+            // Do not let either escape from this C API; warm up on this thread instead.
+        }
+    }
+    if (gWarmupThread == NULL) {
+        warmup->run();
+    }
+    delete gLastWarmup;
+    gLastWarmup = warmup.orphan();
+}
+
+U_CAPI void U_EXPORT2
+u_waitForWarmup(UWarmupTimings *timings, UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    Mutex lock(&gWarmupMutex);
+    joinWarmupThread();
+    if (timings != NULL) {
+        if (gLastWarmup != NULL) {
+            *timings = gLastWarmup->timings;
+        } else {
+            uprv_memset(timings, 0, sizeof(*timings));
+        }
+    }
+    if (gLastWarmup != NULL && U_FAILURE(gLastWarmup->errorCode)) {
+        *pErrorCode = gLastWarmup->errorCode;
+    }
+}
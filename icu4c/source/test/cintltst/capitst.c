@@ -39,6 +39,8 @@ static void TestAttribute(void);
 static void TestDefault(void);
 static void TestDefaultKeyword(void);
 static void TestBengaliSortKey(void);
+static void TestGetSortKeys(void);
+static void TestSortStrings(void);
 
 
 static char* U_EXPORT2 ucol_sortKeyToString(const UCollator *coll, const uint8_t *sortkey, char *buffer, uint32_t len) {
@@ -89,6 +91,8 @@ void addCollAPITest(TestNode** root)
     addTest(root, &TestBengaliSortKey, "tscoll/capitst/TestBengaliSortKey");
     addTest(root, &TestGetKeywordValuesForLocale, "tscoll/capitst/TestGetKeywordValuesForLocale");
     addTest(root, &TestStrcollNull, "tscoll/capitst/TestStrcollNull");
+    addTest(root, &TestGetSortKeys, "tscoll/capitst/TestGetSortKeys");
+    addTest(root, &TestSortStrings, "tscoll/capitst/TestSortStrings");
 }
 
 void TestGetSetAttr(void) {
@@ -2560,4 +2564,245 @@ static void TestStrcollNull(void) {
     ucol_close(coll);
 }
 
+
+/* Compares each batch key with the one from ucol_getSortKey(). */
+static void checkSortKeys(UCollator *coll, const char *name,
+                          const UChar *const strings[], const int32_t lengths[], int32_t count,
+                          const uint8_t *keys, const int32_t offsets[]) {
+    static const UChar empty[1] = { 0 };
+    uint8_t key[512];
+    int32_t i;
+    for (i = 0; i < count; ++i) {
+        /* ucol_getSortKey() also accepts NULL/0 but not for the identical level. */
+        const UChar *string = strings[i] != NULL ? strings[i] : empty;
+        int32_t length = ucol_getSortKey(coll, string, lengths[i], key, UPRV_LENGTHOF(key));
+        if (length != offsets[i + 1] - offsets[i] ||
+                uprv_memcmp(key, keys + offsets[i], length) != 0) {
+            log_err("%s: key %d differs from ucol_getSortKey()\n", name, (int)i);
+            return;
+        }
+    }
+}
+
+static void TestGetSortKeys(void) {
+    static const char *const samples[] = {
+        "abc", "ABC", "a\\u0301\\u0323b", "\\u00e0\\u0316", "co-op", "coop",
+        "\\u5c71\\u5ddd", "\\ud83d\\ude00x", "file10", "file9", "", "\\u00c5ngstr\\u00f6m"
+    };
+    enum { COUNT = 300 };
+    static const UColAttributeValue strengths[] = { UCOL_TERTIARY, UCOL_IDENTICAL };
+    UChar buffer16[COUNT][32];
+    char buffer8[COUNT][64];
+    const UChar *strings[COUNT];
+    const char *strings8[COUNT];
+    int32_t lengths[COUNT], lengths8[COUNT];
+    int32_t offsets[COUNT + 1], offsets2[COUNT + 1];
+    uint8_t *keys, *keys2;
+    int32_t capacity = 100000;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll;
+    int32_t i, s, length, length2;
+
+    for (i = 0; i < COUNT; ++i) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        lengths[i] = u_unescape(samples[i % UPRV_LENGTHOF(samples)], buffer16[i], 32);
+        strings[i] = buffer16[i];
+        u_strToUTF8(buffer8[i], 64, &lengths8[i], strings[i], lengths[i], &errorCode);
+        strings8[i] = buffer8[i];
+        if ((i % 7) == 0) {
+            /* Some NUL-terminated strings. */
+            lengths[i] = lengths8[i] = -1;
+        }
+    }
+    /* A NULL string with length 0 is the empty string. */
+    strings[5] = NULL;
+    lengths[5] = 0;
+    strings8[5] = NULL;
+    lengths8[5] = 0;
+
+    coll = ucol_open("de", &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(de) failed: %s\n", u_errorName(status));
+        return;
+    }
+    keys = (uint8_t *)malloc(capacity);
+    keys2 = (uint8_t *)malloc(capacity);
+    for (s = 0; s < UPRV_LENGTHOF(strengths); ++s) {
+        ucol_setStrength(coll, strengths[s]);
+        ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, s == 0 ? UCOL_ON : UCOL_OFF, &status);
+        ucol_setAttribute(coll, UCOL_NORMALIZATION_MODE, s == 0 ? UCOL_OFF : UCOL_ON, &status);
+
+        length = ucol_getSortKeys(coll, strings, lengths, COUNT, keys, capacity, offsets, 1, &status);
+        if (U_FAILURE(status) || length != offsets[COUNT]) {
+            log_err("ucol_getSortKeys() failed: %s\n", u_errorName(status));
+            break;
+        }
+        checkSortKeys(coll, "ucol_getSortKeys()", strings, lengths, COUNT, keys, offsets);
+
+        /* Same keys with several threads. */
+        length2 = ucol_getSortKeys(coll, strings, lengths, COUNT, keys2, capacity, offsets2, 4, &status);
+        if (U_FAILURE(status) || length2 != length ||
+                uprv_memcmp(offsets, offsets2, sizeof(offsets)) != 0 ||
+                uprv_memcmp(keys, keys2, length) != 0) {
+            log_err("ucol_getSortKeys(4 threads) differs from one thread: %s\n", u_errorName(status));
+        }
+
+        /* Same keys from UTF-8. */
+        length2 = ucol_getSortKeysUTF8(coll, strings8, lengths8, COUNT, keys2, capacity, offsets2, 3, &status);
+        if (U_FAILURE(status) || length2 != length ||
+                uprv_memcmp(offsets, offsets2, sizeof(offsets)) != 0 ||
+                uprv_memcmp(keys, keys2, length) != 0) {
+            log_err("ucol_getSortKeysUTF8() differs from UTF-16: %s\n", u_errorName(status));
+        }
+
+        /* Preflighting, and a buffer that is too short. */
+        length2 = ucol_getSortKeys(coll, strings, lengths, COUNT, NULL, 0, offsets2, 4, &status);
+        if (status != U_BUFFER_OVERFLOW_ERROR || length2 != length ||
+                uprv_memcmp(offsets, offsets2, sizeof(offsets)) != 0) {
+            log_err("ucol_getSortKeys(preflighting) failed: %s\n", u_errorName(status));
+        }
+        status = U_ZERO_ERROR;
+        length2 = ucol_getSortKeysUTF8(coll, strings8, lengths8, COUNT, keys2, length - 1, offsets2, 2, &status);
+        if (status != U_BUFFER_OVERFLOW_ERROR || length2 != length ||
+                uprv_memcmp(offsets, offsets2, sizeof(offsets)) != 0) {
+            log_err("ucol_getSortKeysUTF8(short buffer) failed: %s\n", u_errorName(status));
+        }
+        status = U_ZERO_ERROR;
+    }
+
+    /* Argument errors. */
+    ucol_getSortKeys(coll, strings, NULL, COUNT, keys, capacity, offsets, 1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_getSortKeys(NULL string with NULL lengths) did not fail\n");
+    }
+    status = U_ZERO_ERROR;
+    ucol_getSortKeys(coll, strings, lengths, COUNT, keys, capacity, NULL, 1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_getSortKeys(NULL offsets) did not fail\n");
+    }
+
+    free(keys);
+    free(keys2);
+    ucol_close(coll);
+}
+
+/* Checks that indexes is a permutation that sorts the strings stably. */
+static void checkSortedStrings(const UCollator *coll, const char *name,
+                               const UChar *const strings[], const int32_t lengths[], int32_t count,
+                               const int32_t indexes[]) {
+    char *seen = (char *)calloc(count, 1);
+    int32_t i;
+    for (i = 0; i < count; ++i) {
+        int32_t index = indexes[i];
+        if (index < 0 || index >= count || seen[index]) {
+            log_err("%s: indexes[%d]=%d is out of range or a duplicate\n", name, (int)i, (int)index);
+            break;
+        }
+        seen[index] = 1;
+        if (i > 0) {
+            int32_t prev = indexes[i - 1];
+            UCollationResult result = ucol_strcoll(coll, strings[prev], lengths[prev],
+                                                   strings[index], lengths[index]);
+            if (result == UCOL_GREATER || (result == UCOL_EQUAL && prev > index)) {
+                log_err("%s: strings %d and %d are out of order\n", name, (int)prev, (int)index);
+                break;
+            }
+        }
+    }
+    free(seen);
+}
+
+static void TestSortStrings(void) {
+    /* Pieces are concatenated pseudo-randomly. The long ones make for equal sort key prefixes. */
+    static const char *const pieces[] = {
+        "abc", "ABC", "a\\u0301\\u0323b", "\\u00e0\\u0316", "co-op", "coop", " ",
+        "\\u5c71\\u5ddd", "\\ud83d\\ude00x", "file10", "file9", "", "\\u00c5ngstr\\u00f6m",
+        "\\u0436\\u0451\\u043b\\u0442\\u044b\\u0439", "interoperability", "Interoperability"
+    };
+    enum { COUNT = 5000, CAPACITY = 80 };
+    static const UColAttributeValue strengths[] = { UCOL_TERTIARY, UCOL_QUATERNARY, UCOL_IDENTICAL };
+    UChar *buffer16 = (UChar *)malloc(COUNT * CAPACITY * U_SIZEOF_UCHAR);
+    char *buffer8 = (char *)malloc(COUNT * CAPACITY * 3);
+    const UChar **strings = (const UChar **)malloc(COUNT * sizeof(const UChar *));
+    const char **strings8 = (const char **)malloc(COUNT * sizeof(const char *));
+    int32_t *lengths = (int32_t *)malloc(COUNT * sizeof(int32_t));
+    int32_t *lengths8 = (int32_t *)malloc(COUNT * sizeof(int32_t));
+    int32_t *indexes = (int32_t *)malloc(COUNT * sizeof(int32_t));
+    int32_t *indexes2 = (int32_t *)malloc(COUNT * sizeof(int32_t));
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll;
+    uint32_t random = 12345;
+    int32_t i, j, s;
+
+    for (i = 0; i < COUNT; ++i) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UChar *s16 = buffer16 + i * CAPACITY;
+        int32_t length = 0;
+        for (j = 0; j < 3; ++j) {
+            random = random * 1103515245 + 12345;
+            length += u_unescape(pieces[(random >> 16) % UPRV_LENGTHOF(pieces)],
+                                 s16 + length, CAPACITY - length);
+        }
+        strings[i] = s16;
+        lengths[i] = length;
+        u_strToUTF8(buffer8 + i * CAPACITY * 3, CAPACITY * 3, &lengths8[i], s16, length, &errorCode);
+        strings8[i] = buffer8 + i * CAPACITY * 3;
+        if ((i % 7) == 0) {
+            /* Some NUL-terminated strings. */
+            lengths[i] = lengths8[i] = -1;
+        }
+    }
+
+    coll = ucol_open("de", &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(de) failed: %s\n", u_errorName(status));
+    }
+    for (s = 0; U_SUCCESS(status) && s < UPRV_LENGTHOF(strengths); ++s) {
+        ucol_setStrength(coll, strengths[s]);
+        ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, s == 0 ? UCOL_ON : UCOL_OFF, &status);
+        ucol_setAttribute(coll, UCOL_ALTERNATE_HANDLING, s == 1 ? UCOL_SHIFTED : UCOL_NON_IGNORABLE, &status);
+
+        ucol_sortStrings(coll, strings, lengths, COUNT, indexes, 1, &status);
+        if (U_FAILURE(status)) {
+            log_err("ucol_sortStrings() failed: %s\n", u_errorName(status));
+            break;
+        }
+        checkSortedStrings(coll, "ucol_sortStrings()", strings, lengths, COUNT, indexes);
+
+        /* Same order with several threads. */
+        ucol_sortStrings(coll, strings, lengths, COUNT, indexes2, 4, &status);
+        if (U_FAILURE(status) || uprv_memcmp(indexes, indexes2, COUNT * sizeof(int32_t)) != 0) {
+            log_err("ucol_sortStrings(4 threads) differs from one thread: %s\n", u_errorName(status));
+        }
+
+        /* Same order from UTF-8, with an odd number of threads. */
+        ucol_sortStringsUTF8(coll, strings8, lengths8, COUNT, indexes2, 3, &status);
+        if (U_FAILURE(status) || uprv_memcmp(indexes, indexes2, COUNT * sizeof(int32_t)) != 0) {
+            log_err("ucol_sortStringsUTF8() differs from UTF-16: %s\n", u_errorName(status));
+        }
+    }
+
+    /* Argument errors. */
+    strings[5] = NULL;
+    ucol_sortStrings(coll, strings, NULL, COUNT, indexes, 1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_sortStrings(NULL string with NULL lengths) did not fail\n");
+    }
+    status = U_ZERO_ERROR;
+    ucol_sortStrings(coll, strings, lengths, COUNT, NULL, 1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_sortStrings(NULL indexes) did not fail\n");
+    }
+
+    ucol_close(coll);
+    free(buffer16);
+    free(buffer8);
+    free((void *)strings);
+    free((void *)strings8);
+    free(lengths);
+    free(lengths8);
+    free(indexes);
+    free(indexes2);
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -253,6 +253,7 @@ void addLocaleTest(TestNode** root)
     TESTCASE(TestLikelySubtags);
     TESTCASE(TestToLanguageTag);
     TESTCASE(TestBug20132);
+    TESTCASE(TestLocaleIDCache);
     TESTCASE(TestForLanguageTag);
     TESTCASE(TestInvalidLanguageTag);
     TESTCASE(TestLangAndRegionCanonicalize);
@@ -6064,6 +6065,144 @@ static void TestBug20132(void) {
     }
 }
 
+typedef int32_t U_EXPORT2 LikelySubtagsFn(const char *, char *, int32_t, UErrorCode *);
+
+static int32_t toLanguageTagLax(const char *localeID, char *langtag, int32_t capacity,
+                                UErrorCode *status) {
+    return uloc_toLanguageTag(localeID, langtag, capacity, FALSE, status);
+}
+
+static int32_t toLanguageTagStrict(const char *localeID, char *langtag, int32_t capacity,
+                                   UErrorCode *status) {
+    return uloc_toLanguageTag(localeID, langtag, capacity, TRUE, status);
+}
+
+static void checkCacheCounts(ULocCacheType type, const char *name,
+                             int64_t expectedHits, int64_t expectedMisses) {
+    int64_t hits = -1, misses = -1;
+    uloc_getCacheCounts(type, &hits, &misses);
+    if (hits != expectedHits || misses != expectedMisses) {
+        log_err("%s cache: %d hits %d misses, expected %d hits %d misses\n", name,
+                (int)hits, (int)misses, (int)expectedHits, (int)expectedMisses);
+    }
+}
+
+static void TestLocaleIDCache(void) {
+    static const char* const ids[] = {
+        "de", "sr_ME", "zh_Hant", "und_AQ", "en_US_POSIX", "und",
+        "de@collation=phonebook", "en@x=x-y-z;a=a-b-c", "123", "th_TH_TH",
+        "es__BADVARIANT_GOODVAR", "sr-Latn"
+    };
+    static const struct {
+        LikelySubtagsFn *fn;
+        ULocCacheType type;
+        const char *name;
+    } functions[] = {
+        { uloc_addLikelySubtags, ULOC_CACHE_ADD_LIKELY_SUBTAGS, "addLikelySubtags" },
+        { toLanguageTagLax, ULOC_CACHE_TO_LANGUAGE_TAG, "toLanguageTag" },
+        { toLanguageTagStrict, ULOC_CACHE_TO_LANGUAGE_TAG, "toLanguageTag(strict)" },
+        /* last because it also calls uloc_addLikelySubtags() */
+        { uloc_minimizeSubtags, ULOC_CACHE_MINIMIZE_SUBTAGS, "minimizeSubtags" }
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    char buffer[ULOC_FULLNAME_CAPACITY];
+    int32_t f, i, length;
+    int64_t hits = 0, misses = 0;
+
+    uloc_setCacheCapacity(-1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("uloc_setCacheCapacity(-1) did not fail: %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    uloc_setCacheCapacity(UPRV_LENGTHOF(ids), &status);
+    if (U_FAILURE(status)) {
+        log_err("uloc_setCacheCapacity() failed: %s\n", u_errorName(status));
+        return;
+    }
+
+    /*
+     * A cached result must look exactly like a computed one.
+     * For the likely subtags functions, a buffer without room
+     * for the NUL terminator is always a miss.
+     */
+    for (f = 0; f < UPRV_LENGTHOF(functions); ++f) {
+        if (f != 2) {
+            hits = misses = 0;
+        }
+        for (i = 0; i < UPRV_LENGTHOF(ids); ++i) {
+            char first[ULOC_FULLNAME_CAPACITY];
+            UErrorCode firstStatus = U_ZERO_ERROR;
+            int32_t firstLength = functions[f].fn(ids[i], first, UPRV_LENGTHOF(first), &firstStatus);
+
+            status = U_ZERO_ERROR;
+            length = functions[f].fn(ids[i], buffer, UPRV_LENGTHOF(buffer), &status);
+            if (length != firstLength || status != firstStatus ||
+                    (U_SUCCESS(status) && uprv_strcmp(buffer, first) != 0)) {
+                log_err("%s(%s) = \"%s\" %d %s, then \"%s\" %d %s\n",
+                        functions[f].name, ids[i], first, firstLength, u_errorName(firstStatus),
+                        buffer, length, u_errorName(status));
+            }
+            ++misses;
+            if (U_SUCCESS(firstStatus)) {
+                ++hits;
+                if (firstLength > 0) {
+                    uprv_memset(buffer, '!', sizeof(buffer));
+                    status = U_ZERO_ERROR;
+                    length = functions[f].fn(ids[i], buffer, firstLength, &status);
+                    if (length != firstLength || status != U_STRING_NOT_TERMINATED_WARNING ||
+                            uprv_strncmp(buffer, first, firstLength) != 0 || buffer[firstLength] != '!') {
+                        log_err("%s(%s) into a buffer of length %d = %d %s\n",
+                                functions[f].name, ids[i], firstLength, length, u_errorName(status));
+                    }
+                    if (functions[f].type == ULOC_CACHE_TO_LANGUAGE_TAG) {
+                        ++hits;
+                    } else {
+                        ++misses;
+                    }
+                }
+            } else {
+                ++misses;
+            }
+        }
+        checkCacheCounts(functions[f].type, functions[f].name, hits, misses);
+    }
+
+    /* The least recently used entry is evicted. */
+    status = U_ZERO_ERROR;
+    uloc_setCacheCapacity(2, &status);
+    uloc_addLikelySubtags("ja", buffer, UPRV_LENGTHOF(buffer), &status);  /* miss */
+    uloc_addLikelySubtags("de", buffer, UPRV_LENGTHOF(buffer), &status);  /* miss */
+    uloc_addLikelySubtags("ja", buffer, UPRV_LENGTHOF(buffer), &status);  /* hit */
+    uloc_addLikelySubtags("sr", buffer, UPRV_LENGTHOF(buffer), &status);  /* miss, evicts de */
+    uloc_addLikelySubtags("de", buffer, UPRV_LENGTHOF(buffer), &status);  /* miss, evicts ja */
+    uloc_addLikelySubtags("sr", buffer, UPRV_LENGTHOF(buffer), &status);  /* hit */
+    checkCacheCounts(ULOC_CACHE_ADD_LIKELY_SUBTAGS, "addLikelySubtags with capacity 2", 2, 4);
+
+    /* Output into the input buffer. */
+    uprv_strcpy(buffer, "sr");
+    status = U_ZERO_ERROR;
+    uloc_addLikelySubtags(buffer, buffer, UPRV_LENGTHOF(buffer), &status);
+    uprv_strcpy(buffer, "sr");
+    uloc_addLikelySubtags(buffer, buffer, UPRV_LENGTHOF(buffer), &status);
+    if (U_FAILURE(status) || uprv_strcmp(buffer, "sr_Cyrl_RS") != 0) {
+        log_data_err("uloc_addLikelySubtags(sr) in place = \"%s\" %s\n", buffer, u_errorName(status));
+    }
+
+    /* Capacity 0 turns the caches off. */
+    uloc_setCacheCapacity(0, &status);
+    checkCacheCounts(ULOC_CACHE_MINIMIZE_SUBTAGS, "minimizeSubtags after reset", 0, 0);
+    uloc_addLikelySubtags("de", buffer, UPRV_LENGTHOF(buffer), &status);
+    uloc_addLikelySubtags("de", buffer, UPRV_LENGTHOF(buffer), &status);
+    uloc_toLanguageTag("de", buffer, UPRV_LENGTHOF(buffer), FALSE, &status);
+    checkCacheCounts(ULOC_CACHE_ADD_LIKELY_SUBTAGS, "addLikelySubtags turned off", 0, 0);
+    checkCacheCounts(ULOC_CACHE_TO_LANGUAGE_TAG, "toLanguageTag turned off", 0, 0);
+    if (U_FAILURE(status) || uprv_strcmp(buffer, "de") != 0) {
+        log_err("uloc_toLanguageTag(de) without the cache = \"%s\" %s\n", buffer, u_errorName(status));
+    }
+
+    uloc_setCacheCapacity(128, &status);
+}
+
 #define FULL_LENGTH -1
 static const struct {
     const char  *bcpID;
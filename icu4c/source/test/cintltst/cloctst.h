@@ -127,6 +127,7 @@ static void TestForLanguageTag(void);
 static void TestInvalidLanguageTag(void);
 static void TestToLanguageTag(void);
 static void TestBug20132(void);
+static void TestLocaleIDCache(void);
 static void TestLangAndRegionCanonicalize(void);
 
 static void TestToUnicodeLocaleKey(void);
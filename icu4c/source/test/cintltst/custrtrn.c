@@ -38,6 +38,7 @@ static void Test_strFromUTF32_surrogates(void);
 static void Test_UChar_UTF8_API(void);
 static void Test_FromUTF8(void);
 static void Test_FromUTF8Lenient(void);
+static void Test_UTF8_ASCIIRuns(void);
 static void Test_UChar_WCHART_API(void);
 static void Test_widestrs(void);
 static void Test_WCHART_LongString(void);
@@ -55,6 +56,7 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_UChar_UTF8_API, "custrtrn/Test_UChar_UTF8_API");
    addTest(root, &Test_FromUTF8, "custrtrn/Test_FromUTF8");
    addTest(root, &Test_FromUTF8Lenient, "custrtrn/Test_FromUTF8Lenient");
+   addTest(root, &Test_UTF8_ASCIIRuns, "custrtrn/Test_UTF8_ASCIIRuns");
    addTest(root, &Test_UChar_WCHART_API,  "custrtrn/Test_UChar_WCHART_API");
    addTest(root, &Test_widestrs,  "custrtrn/Test_widestrs");
 #if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
@@ -928,6 +930,99 @@ Test_FromUTF8(void) {
     }
 }
 
+/*
+ * Long ASCII runs are converted in bulk.
+ * Put one ill-formed sequence and one non-ASCII character at every position of
+ * such a run and check that substitutions and all other output stay the same.
+ */
+static void
+Test_UTF8_ASCIIRuns(void) {
+    char src8[100];
+    UChar src16[100];
+    char dest8[120];
+    UChar dest16[120];
+    int32_t pos, i, length, destLength, numSubstitutions;
+    UErrorCode errorCode;
+
+    for(pos=0; pos<60; ++pos) {
+        /* UTF-8 -> UTF-16: 0xff at pos, U+00E9 at pos+20 */
+        length=0;
+        for(i=0; i<80; ++i) {
+            if(i==pos) {
+                src8[length++]=(char)0xff;
+            } else if(i==pos+20) {
+                src8[length++]=(char)0xc3;
+                src8[length++]=(char)0xa9;
+            } else {
+                src8[length++]=(char)(0x20+i);
+            }
+        }
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8WithSub(dest16, UPRV_LENGTHOF(dest16), &destLength, src8, length,
+                             0xfffd, &numSubstitutions, &errorCode);
+        if(U_FAILURE(errorCode) || destLength!=80 || numSubstitutions!=1) {
+            log_err("u_strFromUTF8WithSub(ASCII run, pos=%d) failed: destLength=%d subs=%d - %s\n",
+                    (int)pos, (int)destLength, (int)numSubstitutions, u_errorName(errorCode));
+            continue;
+        }
+        for(i=0; i<80; ++i) {
+            UChar expected= i==pos ? 0xfffd : i==pos+20 ? 0xe9 : (UChar)(0x20+i);
+            if(dest16[i]!=expected) {
+                log_err("u_strFromUTF8WithSub(ASCII run, pos=%d) dest[%d]=U+%04x!=U+%04x\n",
+                        (int)pos, (int)i, dest16[i], expected);
+                break;
+            }
+        }
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8WithSub(NULL, 0, &destLength, src8, length, 0xfffd, &numSubstitutions, &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || destLength!=80 || numSubstitutions!=1) {
+            log_err("u_strFromUTF8WithSub(ASCII run preflight, pos=%d) failed: destLength=%d - %s\n",
+                    (int)pos, (int)destLength, u_errorName(errorCode));
+        }
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8(dest16, UPRV_LENGTHOF(dest16), &destLength, src8, length, &errorCode);
+        if(errorCode!=U_INVALID_CHAR_FOUND) {
+            log_err("u_strFromUTF8(ASCII run, pos=%d) did not detect the ill-formed byte - %s\n",
+                    (int)pos, u_errorName(errorCode));
+        }
+
+        /* UTF-16 -> UTF-8: unpaired surrogate at pos, U+00E9 at pos+20 */
+        for(i=0; i<80; ++i) {
+            src16[i]= i==pos ? 0xdc00 : i==pos+20 ? 0xe9 : (UChar)(0x20+i);
+        }
+        errorCode=U_ZERO_ERROR;
+        u_strToUTF8WithSub(dest8, UPRV_LENGTHOF(dest8), &destLength, src16, 80,
+                           0xfffd, &numSubstitutions, &errorCode);
+        if(U_FAILURE(errorCode) || destLength!=83 || numSubstitutions!=1) {
+            log_err("u_strToUTF8WithSub(ASCII run, pos=%d) failed: destLength=%d subs=%d - %s\n",
+                    (int)pos, (int)destLength, (int)numSubstitutions, u_errorName(errorCode));
+            continue;
+        }
+        length=0;
+        for(i=0; i<80; ++i) {
+            if(i==pos) {
+                src8[length++]=(char)0xef;
+                src8[length++]=(char)0xbf;
+                src8[length++]=(char)0xbd;
+            } else if(i==pos+20) {
+                src8[length++]=(char)0xc3;
+                src8[length++]=(char)0xa9;
+            } else {
+                src8[length++]=(char)(0x20+i);
+            }
+        }
+        if(0!=memcmp(dest8, src8, length)) {
+            log_err("u_strToUTF8WithSub(ASCII run, pos=%d) wrong output\n", (int)pos);
+        }
+        errorCode=U_ZERO_ERROR;
+        u_strToUTF8WithSub(NULL, 0, &destLength, src16, 80, 0xfffd, &numSubstitutions, &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || destLength!=83 || numSubstitutions!=1) {
+            log_err("u_strToUTF8WithSub(ASCII run preflight, pos=%d) failed: destLength=%d - %s\n",
+                    (int)pos, (int)destLength, u_errorName(errorCode));
+        }
+    }
+}
+
 /* test u_strFromUTF8Lenient() */
 static void
 Test_FromUTF8Lenient(void) {
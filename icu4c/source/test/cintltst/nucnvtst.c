@@ -56,6 +56,7 @@ static void TestLATIN1(void);
 static void TestSBCS(void);
 static void TestDBCS(void);
 static void TestMBCS(void);
+static void TestASCIIRuns(void);
 #if !UCONFIG_NO_LEGACY_CONVERSION && !UCONFIG_NO_FILE_IO
 static void TestICCRunout(void);
 #endif
@@ -282,6 +283,7 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestICCRunout, "tsconv/nucnvtst/TestICCRunout");
 #endif
    addTest(root, &TestMBCS, "tsconv/nucnvtst/TestMBCS");
+   addTest(root, &TestASCIIRuns, "tsconv/nucnvtst/TestASCIIRuns");
 
 #ifdef U_ENABLE_GENERIC_ISO_2022
    addTest(root, &TestISO_2022, "tsconv/nucnvtst/TestISO_2022");
@@ -2528,6 +2530,100 @@ TestLATIN1() {
     ucnv_close(cnv);
 }
 
+/*
+ * SBCS and MBCS converters whose tables map all of ASCII to itself
+ * convert runs of ASCII in bulk.
+ * Put one non-ASCII character at every position of such a run and
+ * check the output and offsets in both directions.
+ */
+static void
+TestASCIIRuns() {
+    static const struct {
+        const char *name;
+        UChar c;
+    } cases[]={
+        { "windows-1252", 0xe9 },
+        { "ISO-8859-7", 0x3b1 },
+        { "Shift_JIS", 0x65e5 },
+        { "EUC-JP", 0x65e5 }
+    };
+    UChar src[80], dest[100];
+    char bytes[200], cBytes[8];
+    int32_t offsets[200];
+    int32_t i, j, pos, cLength, length, expectedOffset;
+
+    for(i=0; i<UPRV_LENGTHOF(cases); ++i) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(cases[i].name, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open %s converter - %s\n", cases[i].name, u_errorName(errorCode));
+            continue;
+        }
+        cLength=ucnv_fromUChars(cnv, cBytes, (int32_t)sizeof(cBytes), &cases[i].c, 1, &errorCode);
+        if(U_FAILURE(errorCode) || cLength<1) {
+            log_err("%s: unable to convert U+%04x - %s\n", cases[i].name, cases[i].c, u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+        for(pos=0; pos<UPRV_LENGTHOF(src); ++pos) {
+            const UChar *pSrc;
+            const char *pBytes;
+            char *pTarget;
+            UChar *pDest;
+
+            for(j=0; j<UPRV_LENGTHOF(src); ++j) {
+                src[j]= j==pos ? cases[i].c : (UChar)(0x20+j);
+            }
+
+            /* fromUnicode with offsets */
+            ucnv_resetFromUnicode(cnv);
+            pSrc=src;
+            pTarget=bytes;
+            ucnv_fromUnicode(cnv, &pTarget, bytes+sizeof(bytes), &pSrc, src+UPRV_LENGTHOF(src),
+                             offsets, TRUE, &errorCode);
+            length=(int32_t)(pTarget-bytes);
+            if(U_FAILURE(errorCode) || length!=UPRV_LENGTHOF(src)-1+cLength) {
+                log_err("%s: fromUnicode(pos=%d) failed: length=%d - %s\n",
+                        cases[i].name, (int)pos, (int)length, u_errorName(errorCode));
+                break;
+            }
+            for(j=0; j<length; ++j) {
+                expectedOffset= j<pos ? j : j<pos+cLength ? pos : j-cLength+1;
+                if( offsets[j]!=expectedOffset ||
+                    (j>=pos && j<pos+cLength ? bytes[j]!=cBytes[j-pos] : (uint8_t)bytes[j]!=src[expectedOffset])
+                ) {
+                    log_err("%s: fromUnicode(pos=%d) wrong byte or offset at %d\n",
+                            cases[i].name, (int)pos, (int)j);
+                    break;
+                }
+            }
+
+            /* toUnicode with offsets */
+            ucnv_resetToUnicode(cnv);
+            pBytes=bytes;
+            pDest=dest;
+            ucnv_toUnicode(cnv, &pDest, dest+UPRV_LENGTHOF(dest), &pBytes, bytes+length,
+                           offsets, TRUE, &errorCode);
+            if( U_FAILURE(errorCode) || (pDest-dest)!=UPRV_LENGTHOF(src) ||
+                0!=u_memcmp(src, dest, UPRV_LENGTHOF(src))
+            ) {
+                log_err("%s: toUnicode(pos=%d) failed - %s\n",
+                        cases[i].name, (int)pos, u_errorName(errorCode));
+                break;
+            }
+            for(j=0; j<UPRV_LENGTHOF(src); ++j) {
+                expectedOffset= j<=pos ? j : j+cLength-1;
+                if(offsets[j]!=expectedOffset) {
+                    log_err("%s: toUnicode(pos=%d) offsets[%d]=%d!=%d\n",
+                            cases[i].name, (int)pos, (int)j, (int)offsets[j], (int)expectedOffset);
+                    break;
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+
 static void
 TestSBCS() {
     /* test input */
@@ -24,6 +24,7 @@
 #include "unicode/ures.h"
 #include "unicode/ustring.h"
 #include "unicode/uclean.h"
+#include "unicode/uwarmup.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "filestrm.h"
@@ -73,9 +74,13 @@ static void TestICUDataName(void);
 static void PointerTableOfContents(void);
 static void SetBadCommonData(void);
 static void TestUDataFileAccess(void);
+static void TestWarmup(void);
 #if !UCONFIG_NO_FORMATTING && !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
 static void TestTZDataDir(void); 
 #endif
+#if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
+static void TestUDataPinPackage(void);
+#endif
 
 void addUDataTest(TestNode** root);
 
@@ -97,9 +102,13 @@ addUDataTest(TestNode** root)
     addTest(root, &PointerTableOfContents, "udatatst/PointerTableOfContents" );
     addTest(root, &SetBadCommonData, "udatatst/SetBadCommonData" );
     addTest(root, &TestUDataFileAccess, "udatatst/TestUDataFileAccess" );
+    addTest(root, &TestWarmup, "udatatst/TestWarmup" );
 #if !UCONFIG_NO_FORMATTING && !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestTZDataDir, "udatatst/TestTZDataDir" );
 #endif
+#if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
+    addTest(root, &TestUDataPinPackage, "udatatst/TestUDataPinPackage" );
+#endif
 }
 
 #if 0
@@ -1868,3 +1877,140 @@ static void TestTZDataDir(void) {
     }
 #endif
 }
+
+#if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
+static void TestUDataPinPackage(void) {
+    UErrorCode status = U_ZERO_ERROR;
+    const char *testPath = loadTestData(&status);
+    char *path;
+    UDataMemory *item;
+    UResourceBundle *rb;
+
+    if (U_FAILURE(status)) {
+        log_data_err("Could not load testdata.dat - %s\n", u_errorName(status));
+        return;
+    }
+    path = (char *)malloc(strlen(testPath) + 10);
+
+    /* Bad arguments and paths. */
+    udata_pinPackage(NULL, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("udata_pinPackage(NULL) should fail, got %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    strcat(strcpy(path, testPath), "_nonexistent");
+    udata_pinPackage(path, &status);
+    if (status != U_FILE_ACCESS_ERROR) {
+        log_err("udata_pinPackage(%s) should fail, got %s\n", path, u_errorName(status));
+    }
+
+    /* The test data common data file. */
+    ctest_resetICU();
+    status = U_ZERO_ERROR;
+    strcat(strcpy(path, testPath), ".dat");
+    udata_pinPackage(path, &status);
+    if (U_FAILURE(status)) {
+        log_err("udata_pinPackage(%s) failed - %s\n", path, u_errorName(status));
+    } else {
+        rb = ures_open(testPath, "te_IN", &status);
+        if (status != U_ZERO_ERROR) {
+            log_err("ures_open(te_IN) from the pinned testdata.dat - %s\n", u_errorName(status));
+        }
+        ures_close(rb);
+        status = U_ZERO_ERROR;
+        item = udata_open(testPath, "res", "xx_NotThere", &status);
+        if (U_SUCCESS(status)) {
+            log_err("udata_open(xx_NotThere) from the pinned testdata.dat should fail\n");
+        }
+        udata_close(item);
+        status = U_ZERO_ERROR;
+        udata_pinPackage(path, &status);
+        if (status != U_USING_DEFAULT_WARNING) {
+            log_err("pinning testdata.dat again should set U_USING_DEFAULT_WARNING, got %s\n",
+                    u_errorName(status));
+        }
+    }
+
+    /* The directory of individual test data files. */
+    ctest_resetICU();
+    status = U_ZERO_ERROR;
+    udata_pinPackage(testPath, &status);
+    if (U_FAILURE(status)) {
+        log_err("udata_pinPackage(%s) failed - %s\n", testPath, u_errorName(status));
+    } else {
+        item = udata_open(testPath, "typ", "nam", &status);
+        if (U_FAILURE(status)) {
+            log_err("udata_open(nam.typ) from the pinned directory - %s\n", u_errorName(status));
+        }
+        udata_close(item);
+        strcpy(path, testPath);
+        strcat(path, U_FILE_SEP_STRING);
+        rb = ures_openDirect(path, "zoneinfo64", &status);
+        if (U_FAILURE(status)) {
+            log_err("ures_openDirect(zoneinfo64) from the pinned directory - %s\n",
+                    u_errorName(status));
+        }
+        ures_close(rb);
+        /* Only in testdata.dat: There is no fallback from a pinned directory. */
+        status = U_ZERO_ERROR;
+        item = udata_open(testPath, "res", "te_IN", &status);
+        if (U_SUCCESS(status)) {
+            log_err("udata_open(te_IN) from the pinned directory should fail\n");
+        }
+        udata_close(item);
+    }
+
+    ctest_resetICU();
+    free(path);
+}
+#endif
+
+static void TestWarmup(void) {
+    static const char *const locales[] = { "de_AT", "ja", "th" };
+    UWarmupTimings timings;
+    UErrorCode status = U_ZERO_ERROR;
+
+    u_warmup(locales, UPRV_LENGTHOF(locales), UWARMUP_ALL_SERVICES, UWARMUP_ADVISE_WILLNEED, &status);
+    u_waitForWarmup(&timings, &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "u_warmup(de_AT, ja, th) failed - %s\n", u_errorName(status));
+    } else if (timings.totalMillis <
+                timings.dataMillis + timings.normalizerMillis + timings.collatorMillis +
+                timings.numberFormatMillis + timings.breakIteratorMillis - 0.01 ||
+            timings.advisedBytes < 0) {
+        log_err("u_warmup() timings are inconsistent: total %g ms, advised %d bytes\n",
+                timings.totalMillis, (int)timings.advisedBytes);
+    }
+
+    /* Background warmup of the default locale, only the collator. */
+    status = U_ZERO_ERROR;
+    u_warmup(NULL, 0, UWARMUP_COLLATOR, UWARMUP_IN_BACKGROUND, &status);
+    if (U_FAILURE(status)) {
+        log_err("u_warmup(default locale, in background) failed to start - %s\n", u_errorName(status));
+    }
+    u_waitForWarmup(&timings, &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "u_warmup(default locale, in background) failed - %s\n",
+                       u_errorName(status));
+    } else if (timings.normalizerMillis != 0 || timings.numberFormatMillis != 0 ||
+            timings.breakIteratorMillis != 0 || timings.advisedBytes != 0) {
+        log_err("u_warmup(UWARMUP_COLLATOR) reported time for other services\n");
+    }
+    /* Waiting again returns the same results right away. */
+    u_waitForWarmup(NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "u_waitForWarmup() again - %s\n", u_errorName(status));
+    }
+
+    status = U_ZERO_ERROR;
+    u_warmup(locales, -1, UWARMUP_ALL_SERVICES, 0, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_warmup(localeCount=-1) should fail with U_ILLEGAL_ARGUMENT_ERROR, got %s\n",
+                u_errorName(status));
+    }
+
+    /* u_cleanup() must wait for a background warmup. */
+    status = U_ZERO_ERROR;
+    u_warmup(locales, UPRV_LENGTHOF(locales), UWARMUP_ALL_SERVICES, UWARMUP_IN_BACKGROUND, &status);
+    ctest_resetICU();
+}
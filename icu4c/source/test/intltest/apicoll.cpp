@@ -2517,6 +2517,56 @@ void CollationAPITest::TestGapTooSmall() {
     }
 }
 
+void CollationAPITest::TestSortStrings() {
+    IcuTestErrorCode errorCode(*this, "TestSortStrings");
+    LocalPointer<Collator> coll(Collator::createInstance("ru", errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(ru)")) {
+        return;
+    }
+    // Enough strings for several threads, with many duplicates and long common prefixes.
+    static const char16_t *const pieces[] = {
+        u"жёлтый", u"Жёлтый", u"желтый", u"abc", u"ABC", u"-", u"",
+        u"достопримечательность", u"file10", u"file9"
+    };
+    const int32_t count = 5000;
+    LocalArray<UnicodeString> strings(new UnicodeString[count]);
+    LocalArray<std::string> utf8(new std::string[count]);
+    LocalArray<StringPiece> pieces8(new StringPiece[count]);
+    uint32_t random = 4321;
+    for(int32_t i = 0; i < count; ++i) {
+        for(int32_t j = 0; j < 3; ++j) {
+            random = random * 1103515245 + 12345;
+            strings[i].append(pieces[(random >> 16) % UPRV_LENGTHOF(pieces)]);
+        }
+        strings[i].toUTF8String(utf8[i]);
+        pieces8[i] = utf8[i];
+    }
+
+    coll->setAttribute(UCOL_NUMERIC_COLLATION, UCOL_ON, errorCode);
+    coll->sortStrings(strings.getAlias(), count, 4, errorCode);
+    if(errorCode.errIfFailureAndReset("Collator::sortStrings()")) {
+        return;
+    }
+    for(int32_t i = 1; i < count; ++i) {
+        if(coll->compare(strings[i - 1], strings[i], errorCode) > 0) {
+            errln("Collator::sortStrings(): strings %d and %d are out of order", (int)(i - 1), (int)i);
+            break;
+        }
+    }
+
+    // The UTF-8 strings sort the same way.
+    coll->sortStrings(pieces8.getAlias(), count, 1, errorCode);
+    if(errorCode.errIfFailureAndReset("Collator::sortStrings(UTF-8)")) {
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        if(UnicodeString::fromUTF8(pieces8[i]) != strings[i]) {
+            errln("Collator::sortStrings(UTF-8) differs from UTF-16 at %d", (int)i);
+            break;
+        }
+    }
+}
+
  void CollationAPITest::dump(UnicodeString msg, RuleBasedCollator* c, UErrorCode& status) {
     const char* bigone = "One";
     const char* littleone = "one";
@@ -2560,6 +2610,7 @@ void CollationAPITest::runIndexedTest( int32_t index, UBool exec, const char* &n
     TESTCASE_AUTO(TestIterNumeric);
     TESTCASE_AUTO(TestBadKeywords);
     TESTCASE_AUTO(TestGapTooSmall);
+    TESTCASE_AUTO(TestSortStrings);
     TESTCASE_AUTO_END;
 }
 
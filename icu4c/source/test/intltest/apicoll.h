@@ -174,6 +174,7 @@ class CollationAPITest: public IntlTestCollator {
     void TestIterNumeric();
     void TestBadKeywords();
     void TestGapTooSmall();
+    void TestSortStrings();
 
 private:
     // If this is too small for the test data, just increase it.
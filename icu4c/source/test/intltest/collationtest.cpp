@@ -107,7 +107,7 @@ class CollationTest : public IntlTest {
 
     UBool needsNormalization(const UnicodeString &s, UErrorCode &errorCode) const;
 
-    UBool getSortKeyParts(const UChar *s, int32_t length,
+    UBool getSortKeyParts(UCharIterator &iter,
                           CharString &dest, int32_t partSize,
                           IcuTestErrorCode &errorCode);
     UBool getCollationKey(const char *norm, const UnicodeString &line,
@@ -1323,14 +1323,12 @@ UBool CollationTest::needsNormalization(const UnicodeString &s, UErrorCode &erro
     return FALSE;
 }
 
-UBool CollationTest::getSortKeyParts(const UChar *s, int32_t length,
+UBool CollationTest::getSortKeyParts(UCharIterator &iter,
                                      CharString &dest, int32_t partSize,
                                      IcuTestErrorCode &errorCode) {
     if(errorCode.isFailure()) { return FALSE; }
     uint8_t part[32];
     U_ASSERT(partSize <= UPRV_LENGTHOF(part));
-    UCharIterator iter;
-    uiter_setString(&iter, s, length);
     uint32_t state[2] = { 0, 0 };
     for(;;) {
         int32_t partLength = coll->internalNextSortKeyPart(&iter, state, part, partSize, errorCode);
@@ -1405,7 +1403,9 @@ UBool CollationTest::getCollationKey(const char *norm, const UnicodeString &line
     for(int32_t psi = 0; psi < UPRV_LENGTHOF(partSizes); ++psi) {
         int32_t partSize = partSizes[psi];
         CharString parts;
-        if(!getSortKeyParts(s, length, parts, 32, errorCode)) {
+        UCharIterator iter;
+        uiter_setString(&iter, s, length);
+        if(!getSortKeyParts(iter, parts, 32, errorCode)) {
             infoln(fileTestName);
             errln("Collator(%s).internalNextSortKeyPart(%d) failed: %s",
                   norm, (int)partSize, errorCode.errorName());
@@ -1422,6 +1422,71 @@ UBool CollationTest::getCollationKey(const char *norm, const UnicodeString &line
             return FALSE;
         }
     }
+
+    // Check that the UTF-8 code paths make the same key.
+    // Strings with unpaired surrogates have no UTF-8 equivalent.
+    UnicodeString s16(length < 0, s, length);
+    for(int32_t i = 0; i < s16.length(); ++i) {
+        if(U16_IS_SURROGATE(s16[i]) &&
+                !(U16_IS_LEAD(s16[i]) && (i + 1) < s16.length() && U16_IS_TRAIL(s16[i + 1]))) {
+            return TRUE;
+        }
+        if(U16_IS_LEAD(s16[i])) { ++i; }
+    }
+    std::string s8;
+    s16.toUTF8String(s8);
+    CharString key8;
+    {
+        char buffer[200];
+        int32_t key8Length = ucol_getSortKeyUTF8(coll->toUCollator(), s8.data(), (int32_t)s8.length(),
+                                                 reinterpret_cast<uint8_t *>(buffer),
+                                                 UPRV_LENGTHOF(buffer), errorCode);
+        if(errorCode.get() == U_BUFFER_OVERFLOW_ERROR) {
+            errorCode.reset();
+            char *dest = key8.getAppendBuffer(key8Length, key8Length, key8Length, errorCode);
+            ucol_getSortKeyUTF8(coll->toUCollator(), s8.data(), (int32_t)s8.length(),
+                                reinterpret_cast<uint8_t *>(dest), key8Length, errorCode);
+            key8.append(dest, key8Length, errorCode);
+        } else {
+            key8.append(buffer, key8Length, errorCode);
+        }
+    }
+    if(errorCode.isFailure()) {
+        infoln(fileTestName);
+        errln("ucol_getSortKeyUTF8(%s) failed: %s", norm, errorCode.errorName());
+        infoln(line);
+        return FALSE;
+    }
+    if(keyLength != key8.length() || uprv_memcmp(keyBytes, key8.data(), keyLength) != 0) {
+        infoln(fileTestName);
+        errln("Collator(%s).getCollationKey() != ucol_getSortKeyUTF8()", norm);
+        infoln(line);
+        infoln(printCollationKey(key));
+        infoln(printSortKey(reinterpret_cast<uint8_t *>(key8.data()), key8.length()));
+        return FALSE;
+    }
+    for(int32_t psi = 0; psi < UPRV_LENGTHOF(partSizes); ++psi) {
+        int32_t partSize = partSizes[psi];
+        CharString parts;
+        UCharIterator iter;
+        uiter_setUTF8(&iter, s8.data(), (int32_t)s8.length());
+        if(!getSortKeyParts(iter, parts, partSize, errorCode)) {
+            infoln(fileTestName);
+            errln("Collator(%s).internalNextSortKeyPart(UTF-8, %d) failed: %s",
+                  norm, (int)partSize, errorCode.errorName());
+            infoln(line);
+            return FALSE;
+        }
+        if(keyLength != parts.length() || uprv_memcmp(keyBytes, parts.data(), keyLength) != 0) {
+            infoln(fileTestName);
+            errln("Collator(%s).getCollationKey() != internalNextSortKeyPart(UTF-8, %d)",
+                  norm, (int)partSize);
+            infoln(line);
+            infoln(printCollationKey(key));
+            infoln(printSortKey(reinterpret_cast<uint8_t *>(parts.data()), parts.length()));
+            return FALSE;
+        }
+    }
     return TRUE;
 }
 
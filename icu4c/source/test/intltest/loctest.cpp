@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "loctest.h"
+#include "unicode/localematcher.h"
 #include "unicode/localpointer.h"
 #include "unicode/decimfmt.h"
 #include "unicode/ucurr.h"
@@ -249,6 +250,8 @@ void LocaleTest::runIndexedTest( int32_t index, UBool exec, const char* &name, c
     TESTCASE_AUTO(TestBug13277);
     TESTCASE_AUTO(TestBug13554);
     TESTCASE_AUTO(TestForLanguageTag);
+    TESTCASE_AUTO(TestForSimpleLanguageTag);
+    TESTCASE_AUTO(TestLocaleMatcher);
     TESTCASE_AUTO(TestToLanguageTag);
     TESTCASE_AUTO(TestMoveAssign);
     TESTCASE_AUTO(TestMoveCtor);
@@ -2996,6 +2999,77 @@ void LocaleTest::TestForLanguageTag() {
             loc_gb.getName(), result_no_nul.getName());
 }
 
+void LocaleTest::TestForSimpleLanguageTag() {
+    IcuTestErrorCode status(*this, "TestForSimpleLanguageTag()");
+
+    // Tags of the form language-script-region take a shortcut that must give
+    // the same results as the full parser. Some look simple but are mapped.
+    static const struct {
+        const char *tag;
+        const char *localeID;  // uloc_forLanguageTag()
+        const char *name;  // Locale::getName()
+    } cases[] = {
+        { "en-US", "en_US", "en_US" },
+        { "EN-us", "en_US", "en_US" },
+        { "zh-hant-tw", "zh_Hant_TW", "zh_Hant_TW" },
+        { "sr-LATN", "sr_Latn", "sr_Latn" },
+        { "es-419", "es_419", "es_419" },
+        { "und", "", "" },
+        { "UND-Latn", "_Latn", "_Latn" },
+        { "und-419", "_419", "_419" },
+        { "deu-CH", "deu_CH", "de_CH" },
+        { "abcdefgh-Latn-AQ", "abcdefgh_Latn_AQ", "abcdefgh_Latn_AQ" },
+        { "sgn-BR", "bzs", "bzs" },
+        { "sgn-be-fr", "sfb", "sfb" },
+        { "no-bok", "nb", "nb" },
+        { "zh-yue", "yue", "yue" },
+        { "zh-yue-HK", "yue_HK", "yue_HK" },
+        { "en-GB-oed", "en_GB_OXENDICT", "en_GB_OXENDICT" },
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        const char *tag = cases[i].tag;
+        char localeID[ULOC_FULLNAME_CAPACITY];
+        int32_t parsedLength = -1;
+        int32_t length = uloc_forLanguageTag(tag, localeID, UPRV_LENGTHOF(localeID),
+                                             &parsedLength, status);
+        status.errIfFailureAndReset("uloc_forLanguageTag(\"%s\")", tag);
+        assertEquals(tag, cases[i].localeID, localeID);
+        assertEquals(tag, (int32_t)uprv_strlen(cases[i].localeID), length);
+        assertEquals(tag, (int32_t)uprv_strlen(tag), parsedLength);
+
+        Locale result = Locale::forLanguageTag(tag, status);
+        status.errIfFailureAndReset("Locale::forLanguageTag(\"%s\")", tag);
+        Locale expected(cases[i].name);
+        assertEquals(tag, expected.getName(), result.getName());
+        assertEquals(tag, expected.getBaseName(), result.getBaseName());
+        assertEquals(tag, expected.getLanguage(), result.getLanguage());
+        assertEquals(tag, expected.getScript(), result.getScript());
+        assertEquals(tag, expected.getCountry(), result.getCountry());
+        assertEquals(tag, expected.getVariant(), result.getVariant());
+        assertTrue(tag, result == expected);
+    }
+
+    // Trailing separators are not parsed.
+    char localeID[ULOC_FULLNAME_CAPACITY];
+    int32_t parsedLength = -1;
+    uloc_forLanguageTag("en-Latn-", localeID, UPRV_LENGTHOF(localeID), &parsedLength, status);
+    status.errIfFailureAndReset("uloc_forLanguageTag(\"en-Latn-\")");
+    assertEquals("en-Latn-", "en_Latn", localeID);
+    assertEquals("en-Latn-", 7, parsedLength);
+    Locale result = Locale::forLanguageTag("en-Latn-", status);
+    assertEquals("en-Latn-", U_ILLEGAL_ARGUMENT_ERROR, status.reset());
+    assertTrue("en-Latn-", result.isBogus());
+
+    // The shortcut Locale is a normal one.
+    result = Locale::forLanguageTag("de-DE", status);
+    result.setKeywordValue("collation", "phonebook", status);
+    status.errIfFailureAndReset("de-DE@collation=phonebook");
+    assertEquals("de-DE + keyword", "de_DE@collation=phonebook", result.getName());
+    assertEquals("de-DE + keyword", "de_DE", result.getBaseName());
+    Locale copy(result);
+    assertEquals("copy", "de_DE", copy.getBaseName());
+}
+
 void LocaleTest::TestToLanguageTag() {
     IcuTestErrorCode status(*this, "TestToLanguageTag()");
 
@@ -3154,3 +3228,99 @@ void LocaleTest::TestBug13417VeryLongLanguageTag() {
     status.errIfFailureAndReset("\"%s\"", l.getName());
     assertEquals("equals", tag, result.c_str());
 }
+
+void LocaleTest::TestLocaleMatcher() {
+    IcuTestErrorCode status(*this, "TestLocaleMatcher()");
+
+    static const char *const supportedIDs[] = {
+        "fr", "en_GB", "en", "de", "zh_TW", "zh", "es_419", "es", "nb", "sr_Latn", "pt_PT", "pt"
+    };
+    Locale supported[UPRV_LENGTHOF(supportedIDs)];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(supportedIDs); ++i) {
+        supported[i] = Locale(supportedIDs[i]);
+    }
+    LocaleMatcher matcher(supported, UPRV_LENGTHOF(supported), status);
+    if (status.errIfFailureAndReset("LocaleMatcher()")) {
+        return;
+    }
+    assertEquals("threshold", 50, matcher.getThreshold());
+
+    static const struct {
+        const char *desired;
+        const char *expected;
+    } cases[] = {
+        { "en_US", "en" },
+        { "und", "en" },  // maximizes to en_Latn_US
+        { "en_AU", "en_GB" },
+        { "en_Latn_IN", "en_GB" },
+        { "de_CH", "de" },
+        { "gsw", "de" },  // oneway rule to German
+        { "zh_CN", "zh" },
+        { "zh_Hant", "zh_TW" },
+        { "zh_HK", "zh_TW" },
+        { "es_MX", "es_419" },  // $americas, including the grouping 419
+        { "es_ES", "es" },
+        { "no", "nb" },
+        { "da", "nb" },
+        { "sr", "sr_Latn" },  // sr_Cyrl
+        { "pt_BR", "pt" },
+        { "pt_AO", "pt_PT" },
+        { "fr_CA", "fr" },
+        { "ja", "fr" },  // no match: first supported locale
+        { "ru", "fr" },
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        const Locale *best = matcher.getBestMatch(Locale(cases[i].desired), status);
+        if (status.errIfFailureAndReset("getBestMatch(%s)", cases[i].desired)) {
+            continue;
+        }
+        assertEquals(cases[i].desired, cases[i].expected, best->getName());
+    }
+
+    // Distances are sums of the language, script and region rule distances.
+    assertEquals("en-US/en", 0, matcher.getDistance(Locale("en_US"), Locale("en"), status));
+    assertEquals("en-AU/en-GB", 3, matcher.getDistance(Locale("en_AU"), Locale("en_GB"), status));
+    assertEquals("en-AU/en-US", 5, matcher.getDistance(Locale("en_AU"), Locale("en_US"), status));
+    assertEquals("no/nb", 1, matcher.getDistance(Locale("no"), Locale("nb"), status));
+    assertEquals("zh-CN/zh-TW", 19, matcher.getDistance(Locale("zh_CN"), Locale("zh_TW"), status));
+    assertEquals("zh-TW/zh-CN", 23, matcher.getDistance(Locale("zh_TW"), Locale("zh_CN"), status));
+    assertTrue("ja/en", matcher.getDistance(Locale("ja"), Locale("en"), status) >= 50);
+    // Oneway: German speakers do not necessarily understand Swiss German.
+    assertTrue("de/gsw", matcher.getDistance(Locale("de"), Locale("gsw"), status) >= 50);
+    status.errIfFailureAndReset("getDistance()");
+
+    // An earlier desired locale wins unless a later one is much closer.
+    Locale desired[] = { Locale("ja"), Locale("en_AU"), Locale("en_US") };
+    const Locale *best = matcher.getBestMatch(desired, UPRV_LENGTHOF(desired), status);
+    status.errIfFailureAndReset("getBestMatch(ja, en-AU, en-US)");
+    assertEquals("ja, en-AU, en-US", "en_GB", best->getName());
+
+    static const struct {
+        const char *list;
+        const char *expected;
+    } lists[] = {
+        { "da, en-gb;q=0.8, en;q=0.7", "en_GB" },  // da-nb 12 vs. 0 + demotion 5
+        { "da, ja;q=0.8", "nb" },
+        { "ja,en-US;q=0.9,en;q=0.8", "en" },
+        { "de-CH,de;q=0.9,fr;q=0.8", "de" },
+        { "fr-CA;q=0.7, de ; q=1.0", "de" },
+        { "en;q=0, pt-BR", "pt" },
+        { "*;q=0.5, sr-Cyrl-RS", "sr_Latn" },
+        { "xx-invalid-tag-, zh-Hant-HK;q=0.1", "zh_TW" },
+        { "en-US;q=2, es-AR;x=y;q=0.5", "es_419" },
+        { "", "fr" },
+        { "ja;q=0.9", "fr" },
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(lists); ++i) {
+        best = matcher.getBestMatchForListString(lists[i].list, status);
+        if (status.errIfFailureAndReset("getBestMatchForListString(%s)", lists[i].list)) {
+            continue;
+        }
+        assertEquals(lists[i].list, lists[i].expected, best->getName());
+    }
+
+    LocaleMatcher empty(NULL, 0, status);
+    status.errIfFailureAndReset("LocaleMatcher(NULL, 0)");
+    assertTrue("no supported locales", empty.getBestMatch(Locale::getUS(), status) == NULL);
+    status.errIfFailureAndReset("empty.getBestMatch()");
+}
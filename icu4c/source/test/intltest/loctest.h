@@ -119,6 +119,8 @@ class LocaleTest: public IntlTest {
     void TestMinimizeSubtags();
 
     void TestForLanguageTag();
+    void TestForSimpleLanguageTag();
+    void TestLocaleMatcher();
     void TestToLanguageTag();
 
     void TestMoveAssign();
@@ -28,6 +28,8 @@
 #if !UCONFIG_NO_BREAK_ITERATION
 #include "unicode/filteredbrk.h"
 #include <stdio.h> // for sprintf
+#include <algorithm>
+#include <vector>
 #endif
 /**
  * API Test the RuleBasedBreakIterator class
@@ -1402,6 +1404,249 @@ void RBBIAPITest::TestFilteredBreakIteratorBuilder() {
 #endif
 }
 
+//
+//  TestNextBoundaries    nextBoundaries() must return the same boundaries and rule status
+//                        values as repeated next() and getRuleStatus(), including
+//                        dictionary boundaries, and leave the iterator in the same state.
+//
+void RBBIAPITest::TestNextBoundaries() {
+    UnicodeString text(u"Hello, world! \"Don't\" 3.14 and 42kg. "
+                       u"\u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22 "
+                       u"\u65E5\u672C\u8A9E\u306E\u30C6\u30AD\u30B9\u30C8\u3002 "
+                       u"e\u0301\U0001F1E6\U0001F1E8\U0001F44D\U0001F3FD. Next sentence? Yes.\n");
+    for (int32_t type = 0; type < 4; ++type) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<BreakIterator> bi;
+        switch (type) {
+        case 0: bi.adoptInstead(BreakIterator::createCharacterInstance(Locale::getEnglish(), status)); break;
+        case 1: bi.adoptInstead(BreakIterator::createWordInstance(Locale::getEnglish(), status)); break;
+        case 2: bi.adoptInstead(BreakIterator::createLineInstance(Locale::getEnglish(), status)); break;
+        default: bi.adoptInstead(BreakIterator::createSentenceInstance(Locale::getEnglish(), status)); break;
+        }
+        if (U_FAILURE(status)) {
+            dataerrln("%s:%d failed to create break iterator %d - %s", __FILE__, __LINE__, type, u_errorName(status));
+            return;
+        }
+        RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(bi.getAlias());
+        if (rbbi == nullptr) {
+            errln("%s:%d break iterator %d is not a RuleBasedBreakIterator", __FILE__, __LINE__, type);
+            continue;
+        }
+        rbbi->setText(text);
+        int32_t expected[200];
+        int32_t expectedStatus[200];
+        int32_t expectedCount = 0;
+        for (int32_t pos = rbbi->first(); (pos = rbbi->next()) != BreakIterator::DONE;) {
+            expectedStatus[expectedCount] = rbbi->getRuleStatus();
+            expected[expectedCount++] = pos;
+        }
+
+        static const int32_t capacities[] = { 1, 2, 5, 200 };
+        for (int32_t capacity : capacities) {
+            // Use a fresh iterator each time so that no boundaries are cached yet.
+            LocalPointer<RuleBasedBreakIterator> it(static_cast<RuleBasedBreakIterator *>(rbbi->clone()));
+            it->setText(text);
+            int32_t boundaries[200];
+            int32_t statuses[200];
+            int32_t count = 0;
+            int32_t n;
+            while ((n = it->nextBoundaries(boundaries + count,
+                                           capacity < 200 - count ? capacity : 200 - count,
+                                           statuses + count)) > 0) {
+                count += n;
+                assertEquals("current() after nextBoundaries()", boundaries[count - 1], it->current());
+            }
+            assertEquals("count", expectedCount, count);
+            for (int32_t i = 0; i < expectedCount && i < count; ++i) {
+                if (boundaries[i] != expected[i] || statuses[i] != expectedStatus[i]) {
+                    errln("%s:%d type %d capacity %d: boundary %d is %d/%d, expected %d/%d",
+                          __FILE__, __LINE__, type, capacity, i,
+                          boundaries[i], statuses[i], expected[i], expectedStatus[i]);
+                    break;
+                }
+            }
+            assertEquals("next() at the end", BreakIterator::DONE, it->next());
+        }
+
+        // Mix nextBoundaries() with the other functions.
+        rbbi->first();
+        int32_t boundaries[3];
+        for (int32_t i = 0; i + 4 <= expectedCount; i += 4) {
+            // One boundary with next(), three at once, then back and forth.
+            assertEquals("next()", expected[i], rbbi->next());
+            assertEquals("count", 3, rbbi->nextBoundaries(boundaries, 3, nullptr));
+            assertEquals("last boundary", expected[i + 3], boundaries[2]);
+            assertEquals("rule status", expectedStatus[i + 3], rbbi->getRuleStatus());
+            assertEquals("previous()", expected[i + 2], rbbi->previous());
+            assertEquals("next() after previous()", expected[i + 3], rbbi->next());
+        }
+        rbbi->last();
+        assertEquals("nextBoundaries() at the end", 0, rbbi->nextBoundaries(boundaries, 3, nullptr));
+        assertEquals("current() at the end", text.length(), rbbi->current());
+        rbbi->following(10);
+        assertEquals("nextBoundaries() after following()", 1, rbbi->nextBoundaries(boundaries, 1, nullptr));
+        rbbi->following(10);
+        assertEquals("next() after following()", boundaries[0], rbbi->next());
+    }
+}
+
+//
+//  TestSharedInstances   Break iterators from the factory functions are clones of a cached
+//                        prototype, and clones share the dictionary engines that the original
+//                        has looked up. Each must still iterate independently.
+//
+void RBBIAPITest::TestSharedInstances() {
+    UnicodeString text(u"Hello, world! "
+                       u"\u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22 "
+                       u"\u65E5\u672C\u8A9E\u306E\u30C6\u30AD\u30B9\u30C8\u3002 Bye.");
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> a(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    LocalPointer<BreakIterator> b(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d failed to create break iterators - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    assertTrue("separate objects", a.getAlias() != b.getAlias());
+    assertTrue("same behavior", *a == *b);
+    assertEquals("same valid locale",
+                 a->getLocale(ULOC_VALID_LOCALE, status).getName(),
+                 b->getLocale(ULOC_VALID_LOCALE, status).getName());
+    assertEquals("same actual locale",
+                 a->getLocale(ULOC_ACTUAL_LOCALE, status).getName(),
+                 b->getLocale(ULOC_ACTUAL_LOCALE, status).getName());
+
+    // Interleave iteration over different texts.
+    UnicodeString other(u"One two three.");
+    a->setText(text);
+    b->setText(other);
+    int32_t expected[100];
+    int32_t count = 0;
+    for (int32_t pos = a->first(); pos != BreakIterator::DONE && count < 100; pos = a->next()) {
+        expected[count++] = pos;
+        b->next();
+    }
+    assertTrue("found dictionary boundaries", count > 15);
+    assertEquals("other iterator at its end", other.length(), b->current());
+
+    // A clone of the warmed-up iterator, and a new instance, find the same boundaries.
+    LocalPointer<BreakIterator> c(a->clone());
+    LocalPointer<BreakIterator> d(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (!assertSuccess("createWordInstance", status) || !assertTrue("clone", c.isValid())) {
+        return;
+    }
+    c->setText(text);
+    d->setText(text);
+    a->setText(other);
+    int32_t i = 0;
+    for (int32_t pos = c->first(); pos != BreakIterator::DONE; pos = c->next(), ++i) {
+        if (i >= count || pos != expected[i] || d->current() != pos) {
+            errln("%s:%d boundary %d is %d (clone) and %d (new), expected %d",
+                  __FILE__, __LINE__, i, pos, d->current(), i < count ? expected[i] : -1);
+            break;
+        }
+        d->next();
+    }
+    assertEquals("boundary count", count, i);
+
+    // Locale keywords select different rules.
+    LocalPointer<BreakIterator> strict(BreakIterator::createLineInstance("ja@lb=strict", status));
+    LocalPointer<BreakIterator> loose(BreakIterator::createLineInstance("ja@lb=loose", status));
+    LocalPointer<BreakIterator> loose2(BreakIterator::createLineInstance("ja@lb=loose", status));
+    if (assertSuccess("createLineInstance", status)) {
+        assertTrue("lb=strict != lb=loose", *strict != *loose);
+        assertTrue("lb=loose == lb=loose", *loose == *loose2);
+    }
+}
+
+//
+//  TestDictionaryThreads   Long runs of Thai, Lao, Khmer and Myanmar text are divided up into words
+//                          on several threads with setDictionaryThreadCount(), with the same
+//                          boundaries as on one thread.
+//
+void RBBIAPITest::TestDictionaryThreads() {
+    static const char16_t *const words[][8] = {
+        {   // Thai, with PAIYANNOI and MAIYAMOK
+            u"\u0E23\u0E48\u0E27\u0E19", u"\u0E16\u0E35\u0E48", u"\u0E2A\u0E32\u0E23\u0E2D\u0E14",
+            u"\u0E02\u0E32\u0E27\u0E08\u0E35\u0E1A", u"\u0E41\u0E21\u0E49\u0E41\u0E15\u0E48",
+            u"\u0E04\u0E25\u0E2D\u0E01\u0E2F", u"\u0E1B\u0E23\u0E34\u0E1B\u0E32\u0E01",
+            u"\u0E08\u0E37\u0E14\u0E0A\u0E37\u0E14\u0E46"
+        },
+        {   // Lao
+            u"\u0EC0\u0E81\u0EB1\u0EC8\u0E87", u"\u0EC2\u0EA2\u0EAD\u0EB2\u0E9A", u"\u0E9B\u0EB2\u0EC3\u0EAA",
+            u"\u0E95\u0EB7\u0EC9", u"\u0EAE\u0EB2\u0E81\u0EB2", u"\u0EAB\u0EA5\u0EC8\u0EBD\u0EA1",
+            u"\u0E81\u0EB3\u0EC0\u0E99\u0EB5\u0E94", u"\u0E9C\u0EB9\u0EC9\u0E8A\u0EB2\u0E8D"
+        },
+        {   // Khmer
+            u"\u1780\u17D2\u179A\u1784\u17BD\u179A", u"\u178C\u17BB\u178A\u17B6\u1793\u17CB",
+            u"\u1780\u17D2\u178A\u17C2\u1784", u"\u1796\u17B8\u178E\u17B6", u"\u1785\u17D2\u1794\u17BC\u178F",
+            u"\u1785\u1785\u17B6\u1780", u"\u179B\u1793\u17CB", u"\u1787\u17C6\u1793\u17BD\u1794"
+        },
+        {   // Myanmar
+            u"\u1018\u1030\u1038\u1015\u1004\u103A", u"\u101D\u1000\u103A\u1014\u102C\u1038", u"\u100A\u102E\u1038",
+            u"\u1021\u101C\u103D\u1032\u101A\u1030", u"\u1011\u103D\u1000\u103A\u1005\u102C",
+            u"\u101B\u102F\u1010\u103A", u"\u1018\u103D\u1010\u103A", u"\u1006\u1031\u102C\u1037"
+        }
+    };
+    static const char16_t garbage[][3] = { u"\u0E01\u0E2D", u"\u0E81\u0EAD", u"\u1780\u17A2", u"\u1000\u1021" };
+
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<RuleBasedBreakIterator> bi(
+        (RuleBasedBreakIterator *)BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d failed to create the word break iterator - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    assertEquals("default thread count", 1, bi->getDictionaryThreadCount());
+    bi->setDictionaryThreadCount(0);
+    assertEquals("thread count is at least 1", 1, bi->getDictionaryThreadCount());
+
+    for (int32_t script = 0; script < UPRV_LENGTHOF(words); ++script) {
+        // One long run without spaces, with some non-words mixed in.
+        UnicodeString text;
+        uint32_t seed = 1;
+        while (text.length() < 40000) {
+            seed = seed * 1103515245 + 12345;
+            int32_t r = (int32_t)(seed >> 16) % 67;
+            if (r < 64) {
+                text.append(words[script][r % 8]);
+            } else {
+                text.append(garbage[script]);
+            }
+        }
+
+        bi->setDictionaryThreadCount(1);
+        bi->setText(text);
+        std::vector<int32_t> expected;
+        for (int32_t pos = bi->first(); pos != BreakIterator::DONE; pos = bi->next()) {
+            expected.push_back(pos);
+        }
+        assertTrue("dictionary boundaries", expected.size() > 5000);
+
+        for (int32_t numThreads : {2, 3, 7}) {
+            LocalPointer<RuleBasedBreakIterator> clone((RuleBasedBreakIterator *)bi->clone());
+            clone->setDictionaryThreadCount(numThreads);
+            assertEquals("clone thread count", numThreads, clone->getDictionaryThreadCount());
+            clone->setText(text);
+            size_t i = 0;
+            for (int32_t pos = clone->first(); pos != BreakIterator::DONE; pos = clone->next(), ++i) {
+                if (i >= expected.size() || pos != expected[i]) {
+                    errln("%s:%d script %d, %d threads: boundary %d is %d, expected %d",
+                          __FILE__, __LINE__, script, numThreads, (int)i, pos,
+                          i < expected.size() ? expected[i] : -1);
+                    break;
+                }
+            }
+            assertEquals("boundary count", (int32_t)expected.size(), (int32_t)i);
+
+            // Boundaries found backwards and from the middle are the same as well.
+            int32_t middle = text.length() / 2;
+            auto it = std::upper_bound(expected.begin(), expected.end(), middle);
+            assertEquals("following(middle)", *it, clone->following(middle));
+            assertEquals("preceding(middle)", *(it - 1), clone->preceding(middle));
+        }
+    }
+}
+
 //---------------------------------------------
 // runIndexedTest
 //---------------------------------------------
@@ -1429,6 +1674,9 @@ void RBBIAPITest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestGetBinaryRules);
 #endif
     TESTCASE_AUTO(TestRefreshInputText);
+    TESTCASE_AUTO(TestNextBoundaries);
+    TESTCASE_AUTO(TestSharedInstances);
+    TESTCASE_AUTO(TestDictionaryThreads);
 #if !UCONFIG_NO_BREAK_ITERATION
     TESTCASE_AUTO(TestFilteredBreakIteratorBuilder);
 #endif
@@ -90,6 +90,12 @@ class RBBIAPITest: public IntlTest {
 
     void TestRefreshInputText();
 
+    void TestNextBoundaries();
+
+    void TestSharedInstances();
+
+    void TestDictionaryThreads();
+
     /**
      *Internal subroutines
      **/
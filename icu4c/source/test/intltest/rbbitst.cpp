@@ -114,6 +114,8 @@ void RBBITest::runIndexedTest( int32_t index, UBool exec, const char* &name, cha
     TESTCASE_AUTO(TestBug13447);
     TESTCASE_AUTO(TestReverse);
     TESTCASE_AUTO(TestBug13692);
+    TESTCASE_AUTO(TestTable8Bits);
+    TESTCASE_AUTO(TestDirectTextAccess);
     TESTCASE_AUTO_END;
 }
 
@@ -4414,6 +4416,7 @@ void RBBITest::TestTableRedundancies() {
     RBBIDataWrapper *dw = bi->fData;
     const RBBIStateTable *fwtbl = dw->fForwardTable;
     int32_t numCharClasses = dw->fHeader->fCatCount;
+    bool in8Bits = fwtbl->fFlags & RBBI_8BITS_ROWS;
     // printf("Char Classes: %d     states: %d\n", numCharClasses, fwtbl->fNumStates);
 
     // Check for duplicate columns (character categories)
@@ -4422,8 +4425,12 @@ void RBBITest::TestTableRedundancies() {
     for (int32_t column = 0; column < numCharClasses; column++) {
         UnicodeString s;
         for (int32_t r = 1; r < (int32_t)fwtbl->fNumStates; r++) {
-            RBBIStateTableRow  *row = (RBBIStateTableRow *) (fwtbl->fTableData + (fwtbl->fRowLen * r));
-            s.append(row->fNextState[column]);
+            const char *rowData = fwtbl->fTableData + (fwtbl->fRowLen * r);
+            if (in8Bits) {
+                s.append(((const RBBIStateTableRow8 *)rowData)->fNextState[column]);
+            } else {
+                s.append(((const RBBIStateTableRow16 *)rowData)->fNextState[column]);
+            }
         }
         columns.push_back(s);
     }
@@ -4442,13 +4449,25 @@ void RBBITest::TestTableRedundancies() {
     std::vector<UnicodeString> rows;
     for (int32_t r=0; r < (int32_t)fwtbl->fNumStates; r++) {
         UnicodeString s;
-        RBBIStateTableRow  *row = (RBBIStateTableRow *) (fwtbl->fTableData + (fwtbl->fRowLen * r));
-        assertTrue(WHERE, row->fAccepting >= -1);
-        s.append(row->fAccepting + 1);   // values of -1 are expected.
-        s.append(row->fLookAhead);
-        s.append(row->fTagIdx);
-        for (int32_t column = 0; column < numCharClasses; column++) {
-            s.append(row->fNextState[column]);
+        const char *rowData = fwtbl->fTableData + (fwtbl->fRowLen * r);
+        if (in8Bits) {
+            const RBBIStateTableRow8 *row = (const RBBIStateTableRow8 *)rowData;
+            assertTrue(WHERE, row->fAccepting >= -1);
+            s.append(row->fAccepting + 1);   // values of -1 are expected.
+            s.append(row->fLookAhead);
+            s.append(row->fTagIdx);
+            for (int32_t column = 0; column < numCharClasses; column++) {
+                s.append(row->fNextState[column]);
+            }
+        } else {
+            const RBBIStateTableRow16 *row = (const RBBIStateTableRow16 *)rowData;
+            assertTrue(WHERE, row->fAccepting >= -1);
+            s.append(row->fAccepting + 1);   // values of -1 are expected.
+            s.append(row->fLookAhead);
+            s.append(row->fTagIdx);
+            for (int32_t column = 0; column < numCharClasses; column++) {
+                s.append(row->fNextState[column]);
+            }
         }
         rows.push_back(s);
     }
@@ -4583,6 +4602,163 @@ void RBBITest::TestBug13692() {
     assertSuccess(WHERE, status);
 }
 
+// State tables with no more than 255 states are stored with 8-bit rows,
+// larger ones with 16-bit rows. Check that both are chosen when expected, and both work.
+
+void RBBITest::TestTable8Bits() {
+    for (int32_t length : {4, 300}) {
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError pe;
+        // A rule matching a run of "length" a's needs about "length" states.
+        UnicodeString rules(length, (UChar32)u'a', length);
+        rules.append(u';');
+        RuleBasedBreakIterator bi(rules, pe, status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        const RBBIStateTable *fwtbl = bi.fData->fForwardTable;
+        bool expect8Bits = fwtbl->fNumStates <= 0xff;
+        assertEquals(WHERE, length < 0xff, expect8Bits);
+        assertEquals(WHERE, expect8Bits, (fwtbl->fFlags & RBBI_8BITS_ROWS) != 0);
+        assertTrue(WHERE, (bi.fData->fReverseTable->fFlags & RBBI_8BITS_ROWS) != 0);
+
+        UnicodeString text(2 * length, (UChar32)u'a', 2 * length);
+        bi.setText(text);
+        assertEquals(WHERE, length, bi.next());
+        assertEquals(WHERE, 2 * length, bi.next());
+        assertEquals(WHERE, BreakIterator::DONE, bi.next());
+        assertEquals(WHERE, length, bi.preceding(2 * length - 1));
+        assertTrue(WHERE, bi.isBoundary(length));
+        assertFalse(WHERE, bi.isBoundary(length + 1));
+    }
+}
+
+// handleNext() reads UTF-8 text directly rather than through the UText functions.
+// Check that all ways of reading the text give the same boundaries and rule status
+// values as a CharacterIterator, which goes through the UText functions.
+
+namespace {
+
+typedef std::vector<std::pair<int32_t, int32_t>> BoundaryList;
+
+BoundaryList getForwardBoundaries(BreakIterator &bi) {
+    BoundaryList boundaries;
+    for (int32_t b = bi.first(); b != BreakIterator::DONE; b = bi.next()) {
+        boundaries.push_back(std::make_pair(b, bi.getRuleStatus()));
+    }
+    return boundaries;
+}
+
+BoundaryList getFollowingBoundaries(BreakIterator &bi, int32_t limit) {
+    BoundaryList boundaries;
+    for (int32_t i = 0; i < limit; ++i) {
+        int32_t b = bi.following(i);
+        boundaries.push_back(std::make_pair(b, bi.getRuleStatus()));
+    }
+    return boundaries;
+}
+
+}  // namespace
+
+void RBBITest::TestDirectTextAccess() {
+    UnicodeString text = UNICODE_STRING_SIMPLE(
+        "Hello, world!\\r\\n123.45 don't \\u0e01\\u0e32\\u0e23\\u0e17\\u0e14\\u0e2a\\u0e2d\\u0e1a "
+        "\\U0001F600\\U0001F44D\\U0001F3FD x\\u0301 \\uD800a \\uDC00 end\\uD800").unescape();
+    std::string text8;
+    text.toUTF8String(text8);  // Unpaired surrogates become U+FFFD.
+    // UTF-8 with ill-formed sequences, and the equivalent UTF-16 text.
+    static const char illFormed8[] =
+        "ab\xC0\x80" "c\xED\xA0\x80" "d e\xE0\xA4" " \xF4\x90\x80\x80" "f\xE2\x82" "\xF0\x9F\x98";
+    UnicodeString illFormed16;
+    std::vector<int32_t> offsets8;  // UTF-8 offset for each UTF-16 offset
+    {
+        const uint8_t *s8 = reinterpret_cast<const uint8_t *>(illFormed8);
+        int32_t length8 = static_cast<int32_t>(strlen(illFormed8));
+        for (int32_t i = 0; i < length8;) {
+            int32_t start = i;
+            UChar32 c;
+            U8_NEXT_OR_FFFD(s8, i, length8, c);
+            illFormed16.append(c);
+            while (static_cast<int32_t>(offsets8.size()) < illFormed16.length()) {
+                offsets8.push_back(start);
+            }
+        }
+        offsets8.push_back(length8);
+    }
+
+    for (int32_t type = UBRK_CHARACTER; type <= UBRK_SENTENCE; ++type) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<BreakIterator> bi;
+        switch (type) {
+        case UBRK_CHARACTER:
+            bi.adoptInsteadAndCheckErrorCode(BreakIterator::createCharacterInstance(Locale::getEnglish(), status), status);
+            break;
+        case UBRK_WORD:
+            bi.adoptInsteadAndCheckErrorCode(BreakIterator::createWordInstance(Locale::getEnglish(), status), status);
+            break;
+        case UBRK_LINE:
+            bi.adoptInsteadAndCheckErrorCode(BreakIterator::createLineInstance(Locale::getEnglish(), status), status);
+            break;
+        default:
+            bi.adoptInsteadAndCheckErrorCode(BreakIterator::createSentenceInstance(Locale::getEnglish(), status), status);
+            break;
+        }
+        if (!assertSuccess(WHERE, status, true)) {
+            return;
+        }
+
+        // Reference: The UText functions on a CharacterIterator.
+        bi->adoptText(new StringCharacterIterator(text));
+        BoundaryList expected = getForwardBoundaries(*bi);
+        BoundaryList expectedFollowing = getFollowingBoundaries(*bi, text.length());
+
+        bi->setText(text);
+        assertTrue(WHERE, expected == getForwardBoundaries(*bi));
+        assertTrue(WHERE, expectedFollowing == getFollowingBoundaries(*bi, text.length()));
+
+        // NUL-terminated UChars.
+        LocalUTextPointer ut(utext_openUChars(nullptr, text.getTerminatedBuffer(), -1, &status));
+        bi->setText(ut.getAlias(), status);
+        assertSuccess(WHERE, status);
+        assertTrue(WHERE, expected == getForwardBoundaries(*bi));
+
+        // UTF-8: Same boundaries, at UTF-8 offsets.
+        // The unpaired surrogates became U+FFFD; compare with a reference text that has those too.
+        UnicodeString text16(text);
+        for (int32_t i = 0; i < text16.length(); ++i) {
+            if (U16_IS_SURROGATE(text16[i]) &&
+                    !(U16_IS_LEAD(text16[i]) && i + 1 < text16.length() && U16_IS_TRAIL(text16[i + 1])) &&
+                    !(U16_IS_TRAIL(text16[i]) && i > 0 && U16_IS_LEAD(text16[i - 1]))) {
+                text16.setCharAt(i, 0xfffd);
+            }
+        }
+        bi->adoptText(new StringCharacterIterator(text16));
+        BoundaryList expected8;
+        for (const auto &b : getForwardBoundaries(*bi)) {
+            int32_t length8;
+            status = U_ZERO_ERROR;
+            u_strToUTF8(nullptr, 0, &length8, text16.getBuffer(), b.first, &status);
+            expected8.push_back(std::make_pair(length8, b.second));
+        }
+        status = U_ZERO_ERROR;
+        utext_openUTF8(ut.getAlias(), text8.data(), static_cast<int64_t>(text8.length()), &status);
+        bi->setText(ut.getAlias(), status);
+        assertSuccess(WHERE, status);
+        assertTrue(WHERE, expected8 == getForwardBoundaries(*bi));
+
+        // Ill-formed UTF-8 is read like U+FFFD, one per maximal subpart.
+        bi->adoptText(new StringCharacterIterator(illFormed16));
+        BoundaryList expectedIllFormed;
+        for (const auto &b : getForwardBoundaries(*bi)) {
+            expectedIllFormed.push_back(std::make_pair(offsets8[b.first], b.second));
+        }
+        utext_openUTF8(ut.getAlias(), illFormed8, -1, &status);
+        bi->setText(ut.getAlias(), status);
+        assertSuccess(WHERE, status);
+        assertTrue(WHERE, expectedIllFormed == getForwardBoundaries(*bi));
+    }
+}
+
 //
 //  TestDebug    -  A place-holder test for debugging purposes.
 //                  For putting in fragments of other tests that can be invoked
@@ -30,7 +30,10 @@
 #include "unicode/unistr.h"
 #include "unicode/ucasemap.h"
 #include "unicode/ustring.h"
+#include "hash.h"
 #include "ucase.h"
+#include "ucasemap_imp.h"
+#include "ustr_imp.h"
 #include "ustrtest.h"
 #include "unicode/tstdtmod.h"
 #include "cmemory.h"
@@ -69,9 +72,14 @@ class StringCaseTest: public IntlTest {
     void TestInPlaceTitle();
     void TestCaseMapEditsIteratorDocs();
     void TestCaseMapGreekExtended();
+    void TestLongLatin1Runs();
+    void TestFoldHash();
+    void TestCaseCompareUTF8();
 
 private:
     void assertGreekUpper(const char16_t *s, const char16_t *expected);
+    void checkLatin1Runs(const char *name, int32_t which, const char *localeID, uint32_t options,
+                         const UnicodeString &s16);
 
     Locale GREEK_LOCALE_;
 };
@@ -115,6 +123,9 @@ StringCaseTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
 #endif
     TESTCASE_AUTO(TestCaseMapEditsIteratorDocs);
     TESTCASE_AUTO(TestCaseMapGreekExtended);
+    TESTCASE_AUTO(TestLongLatin1Runs);
+    TESTCASE_AUTO(TestFoldHash);
+    TESTCASE_AUTO(TestCaseCompareUTF8);
     TESTCASE_AUTO_END;
 }
 
@@ -1700,4 +1711,282 @@ void StringCaseTest::TestCaseMapGreekExtended() {
 #endif
 }
 
+namespace {
+
+// which: 0=lower 1=upper 2=fold
+int32_t mapUTF16(int32_t which, const char *localeID, uint32_t options,
+                 const char16_t *src, int32_t length, char16_t *dest, int32_t capacity,
+                 Edits *edits, UErrorCode &errorCode) {
+    switch (which) {
+    case 0:
+        return CaseMap::toLower(localeID, options, src, length, dest, capacity, edits, errorCode);
+    case 1:
+        return CaseMap::toUpper(localeID, options, src, length, dest, capacity, edits, errorCode);
+    default:
+        return CaseMap::fold(options, src, length, dest, capacity, edits, errorCode);
+    }
+}
+
+int32_t mapUTF8(int32_t which, const char *localeID, uint32_t options,
+                const char *src, int32_t length, char *dest, int32_t capacity,
+                Edits *edits, UErrorCode &errorCode) {
+    switch (which) {
+    case 0:
+        return CaseMap::utf8ToLower(localeID, options, src, length, dest, capacity, edits, errorCode);
+    case 1:
+        return CaseMap::utf8ToUpper(localeID, options, src, length, dest, capacity, edits, errorCode);
+    default:
+        return CaseMap::utf8Fold(options, src, length, dest, capacity, edits, errorCode);
+    }
+}
+
+}  // namespace
+
+void StringCaseTest::checkLatin1Runs(const char *name, int32_t which,
+                                     const char *localeID, uint32_t options,
+                                     const UnicodeString &s16) {
+    IcuTestErrorCode errorCode(*this, name);
+    // Map the whole string, where long runs take the vectorized paths,
+    // and compare with mapping one code point at a time.
+    char16_t dest16[2000];
+    Edits edits, expEdits;
+    int32_t length = mapUTF16(which, localeID, options, s16.getBuffer(), s16.length(),
+                              dest16, UPRV_LENGTHOF(dest16), &edits, errorCode);
+    UnicodeString expected;
+    for (int32_t i = 0; i < s16.length();) {
+        int32_t start = i;
+        i = s16.moveIndex32(i, 1);
+        char16_t part[10];
+        int32_t partLength = mapUTF16(which, localeID, options | U_EDITS_NO_RESET,
+                                      s16.getBuffer() + start, i - start,
+                                      part, UPRV_LENGTHOF(part), &expEdits, errorCode);
+        expected.append(part, partLength);
+    }
+    if (errorCode.errIfFailureAndReset("%s UTF-16", name)) { return; }
+    assertEquals(UnicodeString(name) + u" UTF-16", expected, UnicodeString(dest16, length));
+    Edits::Iterator ei = edits.getFineIterator(), expEi = expEdits.getFineIterator();
+    UBool hasNext;
+    int32_t count = 0;
+    while ((hasNext = expEi.next(errorCode)) == ei.next(errorCode) && hasNext) {
+        if (expEi.hasChange() != ei.hasChange() ||
+                expEi.oldLength() != ei.oldLength() || expEi.newLength() != ei.newLength()) {
+            break;
+        }
+        ++count;
+    }
+    assertFalse(UnicodeString(name) + u" UTF-16 same edits up to #" + count, hasNext);
+
+    std::string s8, expected8;
+    s16.toUTF8String(s8);
+    char dest8[4000];
+    edits.reset();
+    expEdits.reset();
+    length = mapUTF8(which, localeID, options, s8.data(), (int32_t)s8.length(),
+                     dest8, UPRV_LENGTHOF(dest8), &edits, errorCode);
+    for (int32_t i = 0; i < (int32_t)s8.length();) {
+        int32_t start = i;
+        U8_FWD_1(s8.data(), i, (int32_t)s8.length());
+        char part[20];
+        int32_t partLength = mapUTF8(which, localeID, options | U_EDITS_NO_RESET,
+                                     s8.data() + start, i - start,
+                                     part, UPRV_LENGTHOF(part), &expEdits, errorCode);
+        expected8.append(part, partLength);
+    }
+    if (errorCode.errIfFailureAndReset("%s UTF-8", name)) { return; }
+    assertTrue(UnicodeString(name) + u" UTF-8", expected8 == std::string(dest8, length));
+    ei = edits.getFineIterator();
+    expEi = expEdits.getFineIterator();
+    count = 0;
+    while ((hasNext = expEi.next(errorCode)) == ei.next(errorCode) && hasNext) {
+        if (expEi.hasChange() != ei.hasChange() ||
+                expEi.oldLength() != ei.oldLength() || expEi.newLength() != ei.newLength()) {
+            break;
+        }
+        ++count;
+    }
+    assertFalse(UnicodeString(name) + u" UTF-8 same edits up to #" + count, hasNext);
+}
+
+void StringCaseTest::TestLongLatin1Runs() {
+    // Runs of ASCII and Latin-1 text that case mapping leaves unchanged, or not,
+    // with a few other characters, in deterministic pseudo-random order.
+    static const char16_t *const runs[] = {
+        u"abcdefghijklmnopqrstuvwxyz0123456789.-_@ ",
+        u"ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+        u"\u00E0\u00E9\u00EE\u00F5\u00FC\u00E7\u00F8\u00FF\u00F7 a-z",
+        u"\u00C0\u00C9\u00CE\u00D5\u00DC\u00C7\u00D8\u00D7\u00DE",
+        u"\u00A0\u00A9\u00B5\u00BF\u00DF\u0080\u009F",
+        u"\u0101\u0130\u0131\u017F\u4E00\u20AC\uFB00\U0001F600",
+        u"iIjJ"
+    };
+    UnicodeString s;
+    uint32_t x = 1;
+    while (s.length() < 1500) {
+        x = x * 1103515245 + 12345;
+        UnicodeString run(runs[(x >> 16) % UPRV_LENGTHOF(runs)]);
+        x = x * 1103515245 + 12345;
+        int32_t runLength = 1 + (int32_t)((x >> 16) % 80);
+        for (int32_t i = 0; i < runLength; ++i) {
+            x = x * 1103515245 + 12345;
+            s.append(run.char32At(run.moveIndex32(0, (int32_t)((x >> 16) % run.countChar32()))));
+        }
+    }
+    checkLatin1Runs("lower root", 0, "", 0, s);
+    checkLatin1Runs("lower tr", 0, "tr", 0, s);
+    checkLatin1Runs("lower lt", 0, "lt", 0, s);
+    checkLatin1Runs("upper root", 1, "", 0, s);
+    checkLatin1Runs("upper tr", 1, "tr", 0, s);
+    checkLatin1Runs("fold", 2, "", U_FOLD_CASE_DEFAULT, s);
+    checkLatin1Runs("fold Turkic", 2, "", U_FOLD_CASE_EXCLUDE_SPECIAL_I, s);
+    // All of the text in one case.
+    UnicodeString lower(s), upper(s);
+    lower.toLower(Locale::getRoot());
+    upper.toUpper(Locale::getRoot());
+    checkLatin1Runs("lower of lowercase", 0, "", 0, lower);
+    checkLatin1Runs("upper of uppercase", 1, "", 0, upper);
+    checkLatin1Runs("fold of lowercase", 2, "", U_FOLD_CASE_DEFAULT, lower);
+}
+
+namespace {
+
+// Hashes every code unit, unlike ustr_hashUCharsN() which samples long strings.
+int32_t hashAllUnits(const UnicodeString &s) {
+    uint32_t hash = 0;
+    for (int32_t i = 0; i < s.length(); ++i) {
+        hash = hash * 37 + s.charAt(i);
+    }
+    return (int32_t)hash;
+}
+
+int32_t sign(int32_t value) {
+    return value < 0 ? -1 : value > 0 ? 1 : 0;
+}
+
+}  // namespace
+
+void StringCaseTest::TestFoldHash() {
+    IcuTestErrorCode errorCode(*this, "TestFoldHash");
+    UnicodeString lead((char16_t)0xd800), trail((char16_t)0xdc00), lonely;
+    lonely.append(u'a').append(trail).append(u'b').append((char16_t)0xdbff).append(lead);
+    const UnicodeString strings[] = {
+        u"",
+        u"Hello World",
+        u"Stra\u00DFe", u"STRASSE", u"strasse", u"STRA\u1E9EE",
+        u"\u039C\u00B5\u03BC",  // Greek capital mu, micro sign, small mu
+        u"\u03A3\u03C3\u03C2",  // sigmas
+        u"\uFB03", u"FFI",
+        u"I\u0130i\u0131",
+        u"\u017F\u212A\u00C5\u212B",  // long s, Kelvin, Angstrom
+        u"\U00010400\U00010428",  // Deseret
+        lead, lonely,  // unpaired surrogates
+        u"a very long Key with MORE than sixty-four code units, "
+        u"WHICH ustr_hashUCharsN() WOULD ONLY SAMPLE"
+    };
+    static const uint32_t options[] = { U_FOLD_CASE_DEFAULT, U_FOLD_CASE_EXCLUDE_SPECIAL_I };
+    for (int32_t j = 0; j < UPRV_LENGTHOF(options); ++j) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+            const UnicodeString &s = strings[i];
+            UnicodeString folded(s);
+            folded.foldCase(options[j]);
+            int32_t expected = hashAllUnits(folded);
+            assertEquals(UnicodeString(u"UTF-16 hash of ") + s,
+                         expected, ustr_hashFoldUCharsN(s.getBuffer(), s.length(), options[j]));
+            if (folded.length() < 64) {
+                assertEquals(UnicodeString(u"short key hash same as hashCode() of folded ") + s,
+                             ustr_hashUCharsN(folded.getBuffer(), folded.length()), expected);
+            }
+            // UTF-8 has U+FFFD instead of unpaired surrogates.
+            std::string s8;
+            s.toUTF8String(s8);
+            UnicodeString folded8 = UnicodeString::fromUTF8(s8);
+            folded8.foldCase(options[j]);
+            assertEquals(UnicodeString(u"UTF-8 hash of ") + s,
+                         hashAllUnits(folded8),
+                         ustr_hashFoldUTF8N(s8.data(), (int32_t)s8.length(), options[j]));
+        }
+    }
+    // Ill-formed UTF-8 hashes like U+FFFD.
+    assertEquals("ill-formed UTF-8",
+                 ustr_hashFoldUCharsN(u"a\uFFFDb\uFFFD\uFFFD", 5, U_FOLD_CASE_DEFAULT),
+                 ustr_hashFoldUTF8N("a\xC3" "B\xF0\x90\x80\xED", 7, U_FOLD_CASE_DEFAULT));
+
+    // Case-insensitive hash table keys.
+    Hashtable table(TRUE, errorCode);
+    table.puti(u"Stra\u00DFe", 1, errorCode);
+    table.puti(u"\u03C3\u03BF\u03C6\u03CC\u03C2", 2, errorCode);
+    errorCode.errIfFailureAndReset("Hashtable.puti()");
+    assertEquals("STRASSE", 1, table.geti(u"STRASSE"));
+    assertEquals("\u03A3\u039F\u03A6\u038C\u03A3", 2, table.geti(u"\u03A3\u039F\u03A6\u038C\u03A3"));
+    assertEquals("Strasser", 0, table.geti(u"Strasser"));
+}
+
+void StringCaseTest::TestCaseCompareUTF8() {
+    IcuTestErrorCode errorCode(*this, "TestCaseCompareUTF8");
+    // Pieces with case foldings of different lengths,
+    // and supplementary code points which sort differently in code unit order.
+    static const char16_t *const pieces[] = {
+        u"a", u"A", u"b", u"ss", u"SS", u"\u00DF", u"\u1E9E", u"s", u"\u017F",
+        u"\u00B5", u"\u03BC", u"\uFB00", u"ff", u"i", u"I", u"\u0130", u"\u0131",
+        u"\uFFFD", u"\uFF21", u"\U00010400", u"\U00010428", u"\U0001F600", u"\u0300"
+    };
+    static const uint32_t options[] = { U_FOLD_CASE_DEFAULT, U_FOLD_CASE_EXCLUDE_SPECIAL_I };
+    uint32_t x = 1;
+    for (int32_t n = 0; n < 2000; ++n) {
+        // Two strings with a shared prefix and random continuations.
+        UnicodeString prefix, s1, s2;
+        x = x * 1103515245 + 12345;
+        int32_t length = (int32_t)((x >> 16) % 4);
+        for (int32_t i = 0; i < length; ++i) {
+            x = x * 1103515245 + 12345;
+            prefix.append(pieces[(x >> 16) % UPRV_LENGTHOF(pieces)]);
+        }
+        s1 = s2 = prefix;
+        for (UnicodeString *s : { &s1, &s2 }) {
+            x = x * 1103515245 + 12345;
+            length = (int32_t)((x >> 16) % 4);
+            for (int32_t i = 0; i < length; ++i) {
+                x = x * 1103515245 + 12345;
+                s->append(pieces[(x >> 16) % UPRV_LENGTHOF(pieces)]);
+            }
+        }
+        std::string s1_8, s2_8;
+        s1.toUTF8String(s1_8);
+        s2.toUTF8String(s2_8);
+        for (int32_t j = 0; j < UPRV_LENGTHOF(options); ++j) {
+            int32_t expected = sign(u_strCaseCompare(s1.getBuffer(), s1.length(),
+                                                     s2.getBuffer(), s2.length(),
+                                                     options[j] | U_COMPARE_CODE_POINT_ORDER,
+                                                     errorCode));
+            int32_t actual = sign(u_strcmpFoldUTF8(s1_8.data(), (int32_t)s1_8.length(),
+                                                   s2_8.data(), (int32_t)s2_8.length(),
+                                                   options[j], errorCode));
+            if (expected != actual) {
+                errln(UnicodeString(u"u_strcmpFoldUTF8(") + s1 + u", " + s2 + u", options " +
+                      options[j] + u") = " + actual + u" but u_strCaseCompare() = " + expected);
+            }
+            if (expected == 0) {
+                assertEquals(UnicodeString(u"equal hashes for ") + s1 + u" & " + s2,
+                             ustr_hashFoldUTF8N(s1_8.data(), (int32_t)s1_8.length(), options[j]),
+                             ustr_hashFoldUTF8N(s2_8.data(), (int32_t)s2_8.length(), options[j]));
+            }
+        }
+    }
+    errorCode.errIfFailureAndReset("u_strCaseCompare()/u_strcmpFoldUTF8()");
+
+    // NUL-terminated strings, and ill-formed sequences which compare like U+FFFD
+    // also where they share a prefix with a well-formed sequence.
+    assertEquals("NUL-terminated", 0, u_strcmpFoldUTF8("Stra\xC3\x9F" "e", -1, "STRASSE", -1,
+                                                       U_FOLD_CASE_DEFAULT, errorCode));
+    assertEquals("ill-formed vs. U+FFFD", 0,
+                 u_strcmpFoldUTF8("x\xC3", 2, "X\xEF\xBF\xBD", 4, U_FOLD_CASE_DEFAULT, errorCode));
+    assertTrue("ill-formed prefix of a\\u0308 > a\\u00E4",
+               u_strcmpFoldUTF8("a\xC3", 2, "A\xC3\xA4", 3, U_FOLD_CASE_DEFAULT, errorCode) > 0);
+    assertTrue("a\\u00E4 < ill-formed prefix",
+               u_strcmpFoldUTF8("a\xC3\xA4", 3, "a\xC3", 2, U_FOLD_CASE_DEFAULT, errorCode) < 0);
+    assertTrue("truncated 4-byte sequence",
+               u_strcmpFoldUTF8("\xF0\x90\x90", 3, "\xF0\x90\x90\xA8", 4,
+                                U_FOLD_CASE_DEFAULT, errorCode) < 0);
+    errorCode.errIfFailureAndReset("u_strcmpFoldUTF8()");
+}
+
 //#endif
@@ -25,6 +25,7 @@
 #include "tsmthred.h"
 #include "unicode/ushape.h"
 #include "unicode/translit.h"
+#include "unicode/brkiter.h"
 #include "sharedobject.h"
 #include "unifiedcache.h"
 #include "uassert.h"
@@ -47,6 +48,7 @@ MultithreadTest::~MultithreadTest()
 #include <string.h>
 #include <ctype.h>    // tolower, toupper
 #include <memory>
+#include <vector>
 
 #include "unicode/putil.h"
 
@@ -86,6 +88,9 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(Test20104);
 #endif /* #if !UCONFIG_NO_FORMATTING */
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
+#if !UCONFIG_NO_BREAK_ITERATION
+    TESTCASE_AUTO(TestFilteredSentenceBreak);
+#endif
     TESTCASE_AUTO_END
 }
 
@@ -1585,3 +1590,74 @@ void MultithreadTest::Test20104() {
 #endif /* !UCONFIG_NO_FORMATTING */
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+#if !UCONFIG_NO_BREAK_ITERATION
+//
+//  Filtered sentence break iterators created on several threads.
+//     All instances for "en@ss=standard" are clones of one cached prototype,
+//     and share its suppression data.
+//
+
+static const UnicodeString *gFilteredBreakText;
+static const std::vector<int32_t> *gFilteredBreakExpected;
+
+class FilteredSentenceBreakThread : public SimpleThread {
+public:
+    FilteredSentenceBreakThread() {}
+    virtual void run();
+};
+
+void FilteredSentenceBreakThread::run() {
+    for (int32_t i = 0; i < 200; ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<BreakIterator> bi(
+            BreakIterator::createSentenceInstance(Locale("en@ss=standard"), status));
+        if (U_FAILURE(status)) {
+            IntlTest::gTest->errln("%s:%d %s", __FILE__, __LINE__, u_errorName(status));
+            return;
+        }
+        bi->setText(*gFilteredBreakText);
+        std::vector<int32_t> boundaries;
+        for (int32_t b = bi->first(); b != BreakIterator::DONE; b = bi->next()) {
+            boundaries.push_back(b);
+        }
+        if (boundaries != *gFilteredBreakExpected) {
+            IntlTest::gTest->errln("%s:%d Filtered sentence break threading failure.", __FILE__, __LINE__);
+            return;
+        }
+    }
+}
+
+void MultithreadTest::TestFilteredSentenceBreak() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString text(u"Mr. Smith met Dr. Jones. They went to St. Louis. Ph.D. students came, too.");
+    gFilteredBreakText = &text;
+
+    LocalPointer<BreakIterator> bi(
+        BreakIterator::createSentenceInstance(Locale("en@ss=standard"), status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    bi->setText(text);
+    std::vector<int32_t> expected;
+    for (int32_t b = bi->first(); b != BreakIterator::DONE; b = bi->next()) {
+        expected.push_back(b);
+    }
+    // "Mr." does not end a sentence.
+    assertTrue(WHERE, expected.size() >= 2 && expected[1] > text.indexOf(u"Smith"));
+    bi.adoptInstead(NULL);
+    gFilteredBreakExpected = &expected;
+
+    static constexpr int NUM_THREADS = 4;
+    FilteredSentenceBreakThread threads[NUM_THREADS];
+    for (auto &thread:threads) {
+        thread.start();
+    }
+    for (auto &thread:threads) {
+        thread.join();
+    }
+    gFilteredBreakText = NULL;
+    gFilteredBreakExpected = NULL;
+}
+#endif /* !UCONFIG_NO_BREAK_ITERATION */
@@ -13,6 +13,7 @@
 #include "unicode/uchar.h"
 #include "unicode/errorcode.h"
 #include "unicode/normlzr.h"
+#include "unicode/normstream.h"
 #include "unicode/stringoptions.h"
 #include "unicode/uniset.h"
 #include "unicode/usetiter.h"
@@ -60,6 +61,9 @@ void BasicNormalizerTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestNormalizeIllFormedText);
     TESTCASE_AUTO(TestComposeJamoTBase);
     TESTCASE_AUTO(TestComposeBoundaryAfter);
+    TESTCASE_AUTO(TestLongLowRuns);
+    TESTCASE_AUTO(TestStreaming);
+    TESTCASE_AUTO(TestNormalizeInParallel);
     TESTCASE_AUTO_END;
 }
 
@@ -1805,4 +1809,183 @@ BasicNormalizerTest::TestComposeBoundaryAfter() {
     assertFalse("U+FB2C boundary-after", nfkc->hasBoundaryAfter(0xFB2C));
 }
 
+void
+BasicNormalizerTest::TestLongLowRuns() {
+    // Runs of code points below the quick check thresholds are skipped in blocks.
+    // Put the one interesting character at every position relative to those blocks.
+    IcuTestErrorCode errorCode(*this, "TestLongLowRuns");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *fcd = Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() call failed")) {
+        return;
+    }
+    for (int32_t i = 1; i < 40; ++i) {
+        UnicodeString prefix(i, u'a', i);
+        UnicodeString decomposed = prefix + UnicodeString(u"\u0301") + prefix + UnicodeString(u"\u00E0");
+        UnicodeString composed = UnicodeString(i - 1, u'a', i - 1) +
+            UnicodeString(u"\u00E1") + prefix + UnicodeString(u"\u00E0");
+        std::string utf8Decomposed, utf8Composed, utf8Result;
+        decomposed.toUTF8String(utf8Decomposed);
+        composed.toUTF8String(utf8Composed);
+        std::string name("i=");
+        name += std::to_string(i);
+
+        assertEquals((name + " nfc").c_str(), composed, nfc->normalize(decomposed, errorCode));
+        assertFalse((name + " nfc.isNormalized").c_str(), nfc->isNormalized(decomposed, errorCode));
+        assertTrue((name + " nfc.isNormalized(composed)").c_str(), nfc->isNormalized(composed, errorCode));
+        assertEquals((name + " nfc.quickCheck").c_str(),
+                     UNORM_MAYBE, nfc->quickCheck(decomposed, errorCode));
+        assertEquals((name + " nfc.spanQuickCheckYes").c_str(),
+                     i - 1, nfc->spanQuickCheckYes(decomposed, errorCode));
+        StringByteSink<std::string> sink(&utf8Result);
+        nfc->normalizeUTF8(0, utf8Decomposed, sink, nullptr, errorCode);
+        assertEquals((name + " nfc.normalizeUTF8").c_str(), utf8Composed.c_str(), utf8Result.c_str());
+        assertFalse((name + " nfc.isNormalizedUTF8").c_str(),
+                    nfc->isNormalizedUTF8(utf8Decomposed, errorCode));
+        assertTrue((name + " nfc.isNormalizedUTF8(composed)").c_str(),
+                   nfc->isNormalizedUTF8(utf8Composed, errorCode));
+
+        UnicodeString nfdComposed = prefix + UnicodeString(u"\u0301") + prefix + UnicodeString(u"a\u0300");
+        assertEquals((name + " nfd").c_str(), nfdComposed, nfd->normalize(composed, errorCode));
+        assertEquals((name + " nfd.spanQuickCheckYes").c_str(),
+                     i - 1, nfd->spanQuickCheckYes(composed, errorCode));
+
+        UnicodeString notFCD = prefix + UnicodeString(u"\u0301\u0323") + prefix;
+        assertFalse((name + " fcd.isNormalized").c_str(), fcd->isNormalized(notFCD, errorCode));
+        assertEquals((name + " fcd.spanQuickCheckYes").c_str(),
+                     i, fcd->spanQuickCheckYes(notFCD, errorCode));
+        assertTrue((name + " fcd.isNormalized(composed)").c_str(), fcd->isNormalized(composed, errorCode));
+    }
+}
+
+void
+BasicNormalizerTest::TestStreaming() {
+    IcuTestErrorCode errorCode(*this, "TestStreaming");
+    const Normalizer2 *normalizers[] = {
+        Normalizer2::getNFCInstance(errorCode),
+        Normalizer2::getNFDInstance(errorCode),
+        Normalizer2::getNFKCInstance(errorCode),
+        Normalizer2::getNFKCCasefoldInstance(errorCode),
+        Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode),
+        Normalizer2::getInstance(nullptr, "nfc", UNORM2_COMPOSE_CONTIGUOUS, errorCode)
+    };
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() call failed")) {
+        return;
+    }
+    // Combining sequences, Hangul, supplementary code points,
+    // unpaired surrogates, and characters with boundaries only after them.
+    const UnicodeString strings[] = {
+        UnicodeString(u"a\u0323\u0301b\u00E7\u0306 \u1100\u1161\u11A8\uAC00\u11A8 \u01FAx"),
+        UnicodeString(u"\U0001D15E\U0001D165\U0001D16D\U0001D15F\u0301\U0001D16E\u05B0\u05B1\u0332."),
+        UnicodeString(u"\u0F71\u0F71\u0F71\u0F72\u0F80\u0F74\u0308\u0301\u0344"
+                      u"\uFB2C\u05BC\u05C1\u05C1a\u0323\u0300\u0301"),
+        UNICODE_STRING_SIMPLE("\\uD800\\u0301\\uDC00a\\U0010FFFF\\u0323\\u0344\\u0300\\u0302\\u0303z\\uDBFF").unescape(),
+        UnicodeString(u"\u00C5\u2126\u1E0D\u0307\u01C4\u0307\uFF76\uFF9E\u3099\u304C")
+    };
+    for (int32_t n = 0; n < UPRV_LENGTHOF(normalizers); ++n) {
+        const Normalizer2 &norm2 = *normalizers[n];
+        StreamingNormalizer stream(norm2);
+        for (int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+            const UnicodeString &s = strings[i];
+            UnicodeString expected = norm2.normalize(s, errorCode);
+            std::string s8, expected8;
+            s.toUTF8String(s8);
+            // Ill-formed UTF-8: a truncated sequence, and stray trail bytes.
+            s8.append("\xE1\x84" "a\x80\xBF\xF0\x9F\x98\x80");
+            StringByteSink<std::string> expectedSink(&expected8);
+            norm2.normalizeUTF8(0, s8, expectedSink, nullptr, errorCode);
+            for (int32_t chunkLength = 1; chunkLength <= 9; ++chunkLength) {
+                std::string name = "normalizer " + std::to_string(n) + " string " + std::to_string(i) +
+                    " chunk " + std::to_string(chunkLength);
+                UnicodeString result;
+                UnicodeStringAppendable appendable(result);
+                for (int32_t start = 0; start < s.length(); start += chunkLength) {
+                    stream.normalize(s.tempSubString(start, chunkLength), appendable, errorCode);
+                }
+                stream.finish(appendable, errorCode);
+                assertEquals(name.c_str(), expected, result);
+                assertEquals(name.c_str(), 0, stream.getPendingLength());
+
+                std::string result8;
+                StringByteSink<std::string> sink(&result8);
+                for (int32_t start = 0; start < (int32_t)s8.length(); start += chunkLength) {
+                    stream.normalizeUTF8(
+                        StringPiece(s8.data() + start, s8.length() - start < (size_t)chunkLength ?
+                                    (int32_t)(s8.length() - start) : chunkLength),
+                        sink, errorCode);
+                }
+                stream.finishUTF8(sink, errorCode);
+                assertEquals(name.c_str(), expected8.c_str(), result8.c_str());
+            }
+        }
+    }
+
+    // Most of a long text is written out before it is finished.
+    const Normalizer2 *nfc = normalizers[0];
+    StreamingNormalizer stream(*nfc);
+    std::string result8;
+    StringByteSink<std::string> sink(&result8);
+    for (int32_t i = 0; i < 1000; ++i) {
+        stream.normalizeUTF8("e\xCC\x81 e\xCC\x81", sink, errorCode);
+    }
+    assertTrue("held back only the tail", stream.getPendingLength() <= 3);
+    UnicodeString result;
+    UnicodeStringAppendable appendable(result);
+    stream.normalize(UnicodeString(u"x"), appendable, errorCode);
+    assertEquals("UTF-16 after unfinished UTF-8", U_INVALID_STATE_ERROR, errorCode.reset());
+    stream.finishUTF8(sink, errorCode);
+    assertEquals("UTF-8 length", 1000 * 5, (int32_t)result8.length());
+}
+
+void
+BasicNormalizerTest::TestNormalizeInParallel() {
+    IcuTestErrorCode errorCode(*this, "TestNormalizeInParallel");
+    const Normalizer2 *normalizers[] = {
+        Normalizer2::getNFCInstance(errorCode),
+        Normalizer2::getNFDInstance(errorCode),
+        Normalizer2::getNFKCCasefoldInstance(errorCode),
+        Normalizer2::getInstance(nullptr, "nfc", UNORM2_FCD, errorCode)
+    };
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFCInstance() call failed")) {
+        return;
+    }
+    // Long enough for several threads, with text of varying length between boundaries
+    // so that the split points fall on all kinds of characters.
+    const UnicodeString pieces[] = {
+        UnicodeString(u"Quick brown fox "),
+        UnicodeString(u"a\u0323\u0301\u0302"),
+        UnicodeString(u"\u1100\u1161\u11A8\uAC00\u11A8"),
+        UnicodeString(u"\U0001D15E\U0001D165\U0001D16D\U0001D15F\u0301"),
+        UnicodeString(u"\u0F71\u0F72\u0F80\u0F74\u0344\uFB2C\u05BC\u05C1"),
+        UnicodeString(u"\u00C5\u2126\u01C4\u0307\uFF76\uFF9E\u304C \u00DF\u03A3")
+    };
+    UnicodeString s;
+    for (int32_t i = 0; s.length() < 300000; ++i) {
+        s.append(pieces[i % UPRV_LENGTHOF(pieces)]);
+        s.append(pieces[(i * 7) % UPRV_LENGTHOF(pieces)], 0, i % 5);
+    }
+    std::string s8;
+    s.toUTF8String(s8);
+    for (int32_t n = 0; n < UPRV_LENGTHOF(normalizers); ++n) {
+        const Normalizer2 &norm2 = *normalizers[n];
+        UnicodeString expected = norm2.normalize(s, errorCode);
+        std::string expected8;
+        StringByteSink<std::string> expectedSink(&expected8);
+        norm2.normalizeUTF8(0, s8, expectedSink, nullptr, errorCode);
+        for (int32_t numThreads = 1; numThreads <= 5; numThreads += 2) {
+            std::string name = "normalizer " + std::to_string(n) + " threads " + std::to_string(numThreads);
+            UnicodeString result;
+            norm2.normalizeInParallel(s, result, numThreads, errorCode);
+            assertTrue(name.c_str(), expected == result);
+            std::string result8;
+            StringByteSink<std::string> sink(&result8);
+            norm2.normalizeUTF8InParallel(s8, sink, numThreads, errorCode);
+            assertTrue((name + " UTF-8").c_str(), expected8 == result8);
+        }
+    }
+    normalizers[0]->normalizeInParallel(s, s, 4, errorCode);
+    assertEquals("src=dest", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
@@ -53,6 +53,9 @@ class BasicNormalizerTest : public IntlTest {
     void TestNormalizeIllFormedText();
     void TestComposeJamoTBase();
     void TestComposeBoundaryAfter();
+    void TestLongLowRuns();
+    void TestStreaming();
+    void TestNormalizeInParallel();
 
 private:
     UnicodeString canonTests[24][3];
@@ -14,6 +14,7 @@
 #include <stdio.h>
 
 #include <string.h>
+#include <string>
 #include "unicode/utypes.h"
 #include "usettest.h"
 #include "unicode/ucnv.h"
@@ -27,6 +28,7 @@
 #include "unicode/utf16.h"
 #include "unicode/uversion.h"
 #include "cmemory.h"
+#include "cstr.h"
 #include "hash.h"
 
 #define TEST_ASSERT_SUCCESS(status) {if (U_FAILURE(status)) { \
@@ -88,6 +90,7 @@ UnicodeSetTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestFreezable);
     TESTCASE_AUTO(TestSpan);
     TESTCASE_AUTO(TestStringSpan);
+    TESTCASE_AUTO(TestSpanLongRuns);
     TESTCASE_AUTO(TestUCAUnsafeBackwards);
     TESTCASE_AUTO(TestIntOverflow);
     TESTCASE_AUTO(TestUnusedCcc);
@@ -3880,6 +3883,103 @@ void UnicodeSetTest::TestStringSpan() {
 #include "collationtailoring.h"
 #endif
 
+// Long runs of characters exercise the vectorized parts of BMPSet spans.
+// Compare frozen-set spans with those of a thawed copy of the set.
+void UnicodeSetTest::TestSpanLongRuns() {
+    static const char16_t *const patterns[]={
+        u"[:White_Space:]",
+        u"[:Letter:]",
+        u"[^\\u000A<\\&]",
+        u"[a-z]",
+        u"[\\u0080-\\u07FF]",
+        u"[\\u0000-\\u007F\\u0400-\\u04FF]",
+        u"[^\\u00E9]",
+        u"[\\u0430-\\u044F\\uFFFD]"
+    };
+    // Runs of text from these ranges: start, number of code points
+    static const UChar32 runRanges[][2]={
+        { 0x61, 26 }, { 0x20, 1 }, { 0x9, 5 }, { 0x21, 0x5e }, { 0xe0, 0x20 },
+        { 0x430, 0x20 }, { 0x3b1, 0x19 }, { 0x627, 0x10 }, { 0x4e00, 0x100 },
+        { 0x1f600, 0x40 }, { 0xd800, 0x800 }, { 0x3c, 1 }
+    };
+    // Ill-formed UTF-8 to be inserted into the UTF-8 text.
+    static const char *const illFormed[]={ "\x80", "\xe3\x81", "\xc0\xaf", "\xf0\x9f", "\xed\xa0\x80", "\xff" };
+
+    uint32_t random=0x5eed;
+    UnicodeString text;
+    std::string text8;
+    while(text.length()<4000) {
+        random=random*1103515245+12345;
+        const UChar32 *range=runRanges[(random>>16)%UPRV_LENGTHOF(runRanges)];
+        random=random*1103515245+12345;
+        int32_t runLength=1+(int32_t)((random>>16)%80);
+        UnicodeString run;
+        for(int32_t i=0; i<runLength; ++i) {
+            random=random*1103515245+12345;
+            run.append(range[0]+(UChar32)((random>>16)%range[1]));
+        }
+        text.append(run);
+        run.toUTF8String(text8);
+        random=random*1103515245+12345;
+        if(((random>>16)%4)==0) {
+            text8.append(illFormed[(random>>20)%UPRV_LENGTHOF(illFormed)]);
+        }
+    }
+    const UChar *s=text.getBuffer();
+    int32_t length=text.length();
+    const char *s8=text8.data();
+    int32_t length8=(int32_t)text8.length();
+
+    IcuTestErrorCode errorCode(*this, "TestSpanLongRuns");
+    for(int32_t i=0; i<UPRV_LENGTHOF(patterns); ++i) {
+        UnicodeSet thawed(UnicodeString(patterns[i]), errorCode);
+        if(errorCode.errIfFailureAndReset("UnicodeSet(%s)", CStr(UnicodeString(patterns[i]))())) {
+            continue;
+        }
+        UnicodeSet frozen(thawed);
+        frozen.freeze();
+        for(int32_t c=USET_SPAN_NOT_CONTAINED; c<=USET_SPAN_CONTAINED; ++c) {
+            USetSpanCondition condition=(USetSpanCondition)c;
+            for(int32_t start=0; start<length; start+=5) {
+                int32_t expected=thawed.span(s+start, length-start, condition);
+                int32_t actual=frozen.span(s+start, length-start, condition);
+                if(actual!=expected) {
+                    errln("%s.span(UTF-16 text+%d, %d) = %d != %d",
+                          CStr(UnicodeString(patterns[i]))(), (int)start, (int)c,
+                          (int)actual, (int)expected);
+                    break;
+                }
+                expected=thawed.spanBack(s, length-start, condition);
+                actual=frozen.spanBack(s, length-start, condition);
+                if(actual!=expected) {
+                    errln("%s.spanBack(UTF-16 text, %d, %d) = %d != %d",
+                          CStr(UnicodeString(patterns[i]))(), (int)(length-start), (int)c,
+                          (int)actual, (int)expected);
+                    break;
+                }
+            }
+            for(int32_t start=0; start<length8; start+=7) {
+                int32_t expected=thawed.spanUTF8(s8+start, length8-start, condition);
+                int32_t actual=frozen.spanUTF8(s8+start, length8-start, condition);
+                if(actual!=expected) {
+                    errln("%s.spanUTF8(text+%d, %d) = %d != %d",
+                          CStr(UnicodeString(patterns[i]))(), (int)start, (int)c,
+                          (int)actual, (int)expected);
+                    break;
+                }
+                expected=thawed.spanBackUTF8(s8, length8-start, condition);
+                actual=frozen.spanBackUTF8(s8, length8-start, condition);
+                if(actual!=expected) {
+                    errln("%s.spanBackUTF8(text, %d, %d) = %d != %d",
+                          CStr(UnicodeString(patterns[i]))(), (int)(length8-start), (int)c,
+                          (int)actual, (int)expected);
+                    break;
+                }
+            }
+        }
+    }
+}
+
 void UnicodeSetTest::TestUCAUnsafeBackwards() {
 #if U_PLATFORM_HAS_WIN32_API
     infoln("Skipping TestUCAUnsafeBackwards() - can't include collationroot.h on Windows without language extensions!");
@@ -90,6 +90,8 @@ class UnicodeSetTest: public IntlTest {
 
     void TestStringSpan();
 
+    void TestSpanLongRuns();
+
     void TestUCAUnsafeBackwards();
     void TestIntOverflow();
     void TestUnusedCcc();
@@ -328,6 +328,163 @@ long GetSortKey::getOperationsPerIteration()
     return source->count;
 }
 
+//
+// Test case taking a single test data array, calling ucol_getSortKeys or
+// ucol_getSortKeysUTF8 once for all of the strings
+//
+template<typename CA, typename Char>
+class GetSortKeys : public UPerfFunction
+{
+public:
+    GetSortKeys(const UCollator* coll, const CA* source, int32_t numThreads);
+    ~GetSortKeys();
+    virtual void call(UErrorCode* status);
+    virtual long getOperationsPerIteration();
+
+private:
+    int32_t getSortKeys(uint8_t *dest, int32_t capacity, UErrorCode *status);
+
+    const UCollator *coll;
+    const CA *source;
+    int32_t numThreads;
+    const Char **strings;
+    int32_t *lengths;
+    int32_t *offsets;
+    uint8_t *keys;
+    int32_t keysCapacity;
+};
+
+template<typename CA, typename Char>
+GetSortKeys<CA, Char>::GetSortKeys(const UCollator* coll, const CA* source, int32_t numThreads)
+    :   coll(coll),
+        source(source),
+        numThreads(numThreads),
+        strings(NULL),
+        lengths(NULL),
+        offsets(NULL),
+        keys(NULL),
+        keysCapacity(0)
+{
+    strings = (const Char **)malloc(source->count * sizeof(const Char *));
+    lengths = (int32_t *)malloc(source->count * sizeof(int32_t));
+    offsets = (int32_t *)malloc((source->count + 1) * sizeof(int32_t));
+    for (int32_t i = 0; i < source->count; i++) {
+        strings[i] = source->dataOf(i);
+        lengths[i] = source->lengthOf(i);
+    }
+    // Preflight once, outside of the timed calls.
+    UErrorCode status = U_ZERO_ERROR;
+    keysCapacity = getSortKeys(NULL, 0, &status);
+    keys = (uint8_t *)malloc(keysCapacity > 0 ? keysCapacity : 1);
+}
+
+template<typename CA, typename Char>
+GetSortKeys<CA, Char>::~GetSortKeys()
+{
+    free(strings);
+    free(lengths);
+    free(offsets);
+    free(keys);
+}
+
+template<>
+int32_t GetSortKeys<CA_uchar, UChar>::getSortKeys(uint8_t *dest, int32_t capacity, UErrorCode *status)
+{
+    return ucol_getSortKeys(coll, strings, lengths, source->count,
+                            dest, capacity, offsets, numThreads, status);
+}
+
+template<>
+int32_t GetSortKeys<CA_char, char>::getSortKeys(uint8_t *dest, int32_t capacity, UErrorCode *status)
+{
+    return ucol_getSortKeysUTF8(coll, strings, lengths, source->count,
+                                dest, capacity, offsets, numThreads, status);
+}
+
+template<typename CA, typename Char>
+void GetSortKeys<CA, Char>::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    getSortKeys(keys, keysCapacity, status);
+}
+
+template<typename CA, typename Char>
+long GetSortKeys<CA, Char>::getOperationsPerIteration()
+{
+    return source->count;
+}
+
+//
+// Test case taking a single test data array, sorting all of the strings with
+// ucol_sortStrings or ucol_sortStringsUTF8
+//
+template<typename CA, typename Char>
+class SortStrings : public UPerfFunction
+{
+public:
+    SortStrings(const UCollator* coll, const CA* source, int32_t numThreads);
+    ~SortStrings();
+    virtual void call(UErrorCode* status);
+    virtual long getOperationsPerIteration();
+
+private:
+    const UCollator *coll;
+    const CA *source;
+    int32_t numThreads;
+    const Char **strings;
+    int32_t *lengths;
+    int32_t *indexes;
+};
+
+template<typename CA, typename Char>
+SortStrings<CA, Char>::SortStrings(const UCollator* coll, const CA* source, int32_t numThreads)
+    :   coll(coll),
+        source(source),
+        numThreads(numThreads),
+        strings(NULL),
+        lengths(NULL),
+        indexes(NULL)
+{
+    strings = (const Char **)malloc(source->count * sizeof(const Char *));
+    lengths = (int32_t *)malloc(source->count * sizeof(int32_t));
+    indexes = (int32_t *)malloc(source->count * sizeof(int32_t));
+    for (int32_t i = 0; i < source->count; i++) {
+        strings[i] = source->dataOf(i);
+        lengths[i] = source->lengthOf(i);
+    }
+}
+
+template<typename CA, typename Char>
+SortStrings<CA, Char>::~SortStrings()
+{
+    free(strings);
+    free(lengths);
+    free(indexes);
+}
+
+template<>
+void SortStrings<CA_uchar, UChar>::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    ucol_sortStrings(coll, strings, lengths, source->count, indexes, numThreads, status);
+}
+
+template<>
+void SortStrings<CA_char, char>::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    ucol_sortStringsUTF8(coll, strings, lengths, source->count, indexes, numThreads, status);
+}
+
+template<typename CA, typename Char>
+long SortStrings<CA, Char>::getOperationsPerIteration()
+{
+    return source->count;
+}
+
 //
 // Test case taking a single test data array in UTF-16, calling ucol_nextSortKeyPart for each for the
 // given buffer size
@@ -1094,6 +1251,15 @@ class CollPerf2Test : public UPerfTest
     UPerfFunction* TestGetSortKey();
     UPerfFunction* TestGetSortKeyNull();
 
+    UPerfFunction* TestGetSortKeys();
+    UPerfFunction* TestGetSortKeys_4Threads();
+    UPerfFunction* TestGetSortKeysUTF8();
+    UPerfFunction* TestGetSortKeysUTF8_4Threads();
+    UPerfFunction* TestSortStrings();
+    UPerfFunction* TestSortStrings_4Threads();
+    UPerfFunction* TestSortStringsUTF8();
+    UPerfFunction* TestSortStringsUTF8_4Threads();
+
     UPerfFunction* TestNextSortKeyPart_4All();
     UPerfFunction* TestNextSortKeyPart_4x2();
     UPerfFunction* TestNextSortKeyPart_4x4();
@@ -1403,6 +1569,15 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
     TESTCASE_AUTO(TestGetSortKey);
     TESTCASE_AUTO(TestGetSortKeyNull);
 
+    TESTCASE_AUTO(TestGetSortKeys);
+    TESTCASE_AUTO(TestGetSortKeys_4Threads);
+    TESTCASE_AUTO(TestGetSortKeysUTF8);
+    TESTCASE_AUTO(TestGetSortKeysUTF8_4Threads);
+    TESTCASE_AUTO(TestSortStrings);
+    TESTCASE_AUTO(TestSortStrings_4Threads);
+    TESTCASE_AUTO(TestSortStringsUTF8);
+    TESTCASE_AUTO(TestSortStringsUTF8_4Threads);
+
     TESTCASE_AUTO(TestNextSortKeyPart_4All);
     TESTCASE_AUTO(TestNextSortKeyPart_4x4);
     TESTCASE_AUTO(TestNextSortKeyPart_4x8);
@@ -1528,6 +1703,86 @@ UPerfFunction* CollPerf2Test::TestGetSortKeyNull()
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestGetSortKeys()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *source = getData16(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new GetSortKeys<CA_uchar, UChar>(coll, source, 1 /* numThreads */);
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeys_4Threads()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *source = getData16(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new GetSortKeys<CA_uchar, UChar>(coll, source, 4 /* numThreads */);
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeysUTF8()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_char *source = getData8(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new GetSortKeys<CA_char, char>(coll, source, 1 /* numThreads */);
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeysUTF8_4Threads()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_char *source = getData8(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new GetSortKeys<CA_char, char>(coll, source, 4 /* numThreads */);
+}
+
+UPerfFunction* CollPerf2Test::TestSortStrings()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *source = getData16(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new SortStrings<CA_uchar, UChar>(coll, source, 1 /* numThreads */);
+}
+
+UPerfFunction* CollPerf2Test::TestSortStrings_4Threads()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *source = getData16(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new SortStrings<CA_uchar, UChar>(coll, source, 4 /* numThreads */);
+}
+
+UPerfFunction* CollPerf2Test::TestSortStringsUTF8()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_char *source = getData8(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new SortStrings<CA_char, char>(coll, source, 1 /* numThreads */);
+}
+
+UPerfFunction* CollPerf2Test::TestSortStringsUTF8_4Threads()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_char *source = getData8(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    return new SortStrings<CA_char, char>(coll, source, 4 /* numThreads */);
+}
+
 UPerfFunction* CollPerf2Test::TestNextSortKeyPart_4All()
 {
     UErrorCode status = U_ZERO_ERROR;
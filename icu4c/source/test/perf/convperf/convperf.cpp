@@ -116,6 +116,15 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        TESTCASE(54,TestICU_ASCIIRuns_Windows1252_ToUnicode);
+        TESTCASE(55,TestICU_ASCIIRuns_Windows1252_FromUnicode);
+        TESTCASE(56,TestICU_ASCIIRuns_Windows1252_ToUnicodeWithOffsets);
+        TESTCASE(57,TestICU_ASCIIRuns_Windows1252_FromUnicodeWithOffsets);
+        TESTCASE(58,TestICU_ASCIIRuns_SJIS_ToUnicode);
+        TESTCASE(59,TestICU_ASCIIRuns_SJIS_FromUnicode);
+        TESTCASE(60,TestICU_ASCIIRuns_SJIS_ToUnicodeWithOffsets);
+        TESTCASE(61,TestICU_ASCIIRuns_SJIS_FromUnicodeWithOffsets);
+
         default: 
             name = ""; 
             return NULL;
@@ -657,3 +666,77 @@ UPerfFunction*  ConverterPerformanceTest::TestWinANSI_ISO2022JP_ToUnicode(){
     }
     return pf;
 }
+
+//#################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ASCIIRuns_Windows1252_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("windows-1252",(char*)asciiRuns_windows1252_encSource, UPRV_LENGTHOF(asciiRuns_windows1252_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ASCIIRuns_Windows1252_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUFromUnicodePerfFunction("windows-1252",asciiRuns_windows1252_uniSource, UPRV_LENGTHOF(asciiRuns_windows1252_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ASCIIRuns_Windows1252_ToUnicodeWithOffsets(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("windows-1252",(char*)asciiRuns_windows1252_encSource, UPRV_LENGTHOF(asciiRuns_windows1252_encSource), status, TRUE);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ASCIIRuns_Windows1252_FromUnicodeWithOffsets(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUFromUnicodePerfFunction("windows-1252",asciiRuns_windows1252_uniSource, UPRV_LENGTHOF(asciiRuns_windows1252_uniSource), status, TRUE);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ASCIIRuns_SJIS_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("Shift_JIS",(char*)asciiRuns_sjis_encSource, UPRV_LENGTHOF(asciiRuns_sjis_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ASCIIRuns_SJIS_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUFromUnicodePerfFunction("Shift_JIS",asciiRuns_sjis_uniSource, UPRV_LENGTHOF(asciiRuns_sjis_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ASCIIRuns_SJIS_ToUnicodeWithOffsets(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("Shift_JIS",(char*)asciiRuns_sjis_encSource, UPRV_LENGTHOF(asciiRuns_sjis_encSource), status, TRUE);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ASCIIRuns_SJIS_FromUnicodeWithOffsets(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUFromUnicodePerfFunction("Shift_JIS",asciiRuns_sjis_uniSource, UPRV_LENGTHOF(asciiRuns_sjis_uniSource), status, TRUE);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
@@ -32,18 +32,21 @@ class ICUToUnicodePerfFunction : public UPerfFunction{
     int32_t srcLen;
     UChar* target;
     UChar* targetLimit;
+    int32_t* offsets;
     
 public:
-    ICUToUnicodePerfFunction(const char* name,  const char* source, int32_t sourceLen, UErrorCode& status){
+    ICUToUnicodePerfFunction(const char* name,  const char* source, int32_t sourceLen, UErrorCode& status,
+                             UBool withOffsets = FALSE){
         conv = ucnv_open(name,&status);
         src = source;
         srcLen = sourceLen;
+        target = NULL;
+        targetLimit = NULL;
+        offsets = NULL;
         if(U_FAILURE(status)){
             conv = NULL;
             return;
         }
-        target = NULL;
-        targetLimit = NULL;
         int32_t reqdLen = ucnv_toUChars(conv,   target, 0,
                                         source, srcLen, &status);
         if(status==U_BUFFER_OVERFLOW_ERROR) {
@@ -54,18 +57,26 @@ class ICUToUnicodePerfFunction : public UPerfFunction{
                 status = U_MEMORY_ALLOCATION_ERROR;
                 return;
             }
+            if(withOffsets) {
+                offsets=(int32_t*)malloc(reqdLen * sizeof(int32_t));
+                if(offsets == NULL){
+                    status = U_MEMORY_ALLOCATION_ERROR;
+                    return;
+                }
+            }
         }
     }
     virtual void call(UErrorCode* status){
         const char* mySrc = src;
         const char* sourceLimit = src + srcLen;
         UChar* myTarget = target;
-        ucnv_toUnicode(conv, &myTarget, targetLimit, &mySrc, sourceLimit, NULL, TRUE, status);
+        ucnv_toUnicode(conv, &myTarget, targetLimit, &mySrc, sourceLimit, offsets, TRUE, status);
     }
     virtual long getOperationsPerIteration(void){
         return srcLen;
     }
     ~ICUToUnicodePerfFunction(){
+        free(offsets);
         free(target);
         ucnv_close(conv);
     }
@@ -77,19 +88,22 @@ class ICUFromUnicodePerfFunction : public UPerfFunction{
     int32_t srcLen;
     char* target;
     char* targetLimit;
+    int32_t* offsets;
     const char* name;
     
 public:
-    ICUFromUnicodePerfFunction(const char* name,  const UChar* source, int32_t sourceLen, UErrorCode& status){
+    ICUFromUnicodePerfFunction(const char* name,  const UChar* source, int32_t sourceLen, UErrorCode& status,
+                               UBool withOffsets = FALSE){
         conv = ucnv_open(name,&status);
         src = source;
         srcLen = sourceLen;
+        target = NULL;
+        targetLimit = NULL;
+        offsets = NULL;
         if(U_FAILURE(status)){
             conv = NULL;
             return;
         }
-        target = NULL;
-        targetLimit = NULL;
         int32_t reqdLen = ucnv_fromUChars(conv,   target, 0,
                                           source, srcLen, &status);
         if(status==U_BUFFER_OVERFLOW_ERROR) {
@@ -100,18 +114,26 @@ class ICUFromUnicodePerfFunction : public UPerfFunction{
                 status = U_MEMORY_ALLOCATION_ERROR;
                 return;
             }
+            if(withOffsets) {
+                offsets=(int32_t*)malloc(reqdLen * sizeof(int32_t));
+                if(offsets == NULL){
+                    status = U_MEMORY_ALLOCATION_ERROR;
+                    return;
+                }
+            }
         }
     }
     virtual void call(UErrorCode* status){
         const UChar* mySrc = src;
         const UChar* sourceLimit = src + srcLen;
         char* myTarget = target;
-        ucnv_fromUnicode(conv,&myTarget, targetLimit, &mySrc, sourceLimit, NULL, TRUE, status);
+        ucnv_fromUnicode(conv,&myTarget, targetLimit, &mySrc, sourceLimit, offsets, TRUE, status);
     }
     virtual long getOperationsPerIteration(void){
         return srcLen;
     }
     ~ICUFromUnicodePerfFunction(){
+        free(offsets);
         free(target);
         ucnv_close(conv);
     }
@@ -566,6 +588,15 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinIML2_ISO2022JP_ToUnicode();
     UPerfFunction* TestWinIML2_ISO2022JP_FromUnicode(); 
 
+    UPerfFunction* TestICU_ASCIIRuns_Windows1252_ToUnicode();
+    UPerfFunction* TestICU_ASCIIRuns_Windows1252_FromUnicode();
+    UPerfFunction* TestICU_ASCIIRuns_Windows1252_ToUnicodeWithOffsets();
+    UPerfFunction* TestICU_ASCIIRuns_Windows1252_FromUnicodeWithOffsets();
+    UPerfFunction* TestICU_ASCIIRuns_SJIS_ToUnicode();
+    UPerfFunction* TestICU_ASCIIRuns_SJIS_FromUnicode();
+    UPerfFunction* TestICU_ASCIIRuns_SJIS_ToUnicodeWithOffsets();
+    UPerfFunction* TestICU_ASCIIRuns_SJIS_FromUnicodeWithOffsets();
+
 };
 
 #endif
@@ -2731,5 +2731,593 @@ unsigned char utf8_encSmSource[]={
     0xE3,0x80,0x80,0xE3,0x80,0x81,0xE3,0x80,0x82,0x20,0xEF,0xBC,0x8E,0xE3,0x83,0xBB,
     0xEF,0xBC,0x9A,0xEF,0xBC,0x9B,0x0D,0x0A
 };
+
+/*
+ * Mostly-ASCII text with occasional non-ASCII characters,
+ * for the bulk ASCII paths of SBCS and MBCS converters.
+ */
+unsigned char asciiRuns_windows1252_encSource[]={
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x30,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x32,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x33,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x34,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x35,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x36,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x37,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x38,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x39,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,
+    0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,
+    0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x30,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,
+    0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,
+    0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,
+    0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,
+    0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x31,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,
+    0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,
+    0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,
+    0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,
+    0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x32,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,
+    0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,
+    0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,
+    0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,
+    0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x33,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,
+    0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,
+    0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,
+    0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,
+    0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x34,0x20,0x73,0x68,0x69,0x70,0x70,0x65,
+    0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,
+    0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,
+    0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,
+    0x75,0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x35,0x20,0x73,0x68,0x69,0x70,0x70,
+    0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,
+    0x20,0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,
+    0x69,0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,
+    0x66,0x75,0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x36,0x20,0x73,0x68,0x69,0x70,
+    0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,
+    0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,0xE9,
+    0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,0x6E,
+    0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x37,0x20,0x73,0x68,0x69,
+    0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,0x61,
+    0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,0x66,
+    0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,0x69,
+    0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x38,0x20,0x73,0x68,
+    0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,0x72,
+    0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,0x61,
+    0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,0x20,
+    0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x39,0x20,0x73,
+    0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,0x74,
+    0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,0x63,
+    0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,0x64,
+    0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x32,0x30,0x20,
+    0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,0x53,
+    0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,0x20,
+    0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,0x69,
+    0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x32,0x31,
+    0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,0x20,
+    0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,0x65,
+    0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,0x61,
+    0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x32,
+    0x32,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x2C,
+    0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,0x68,
+    0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,0x70,
+    0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,
+    0x32,0x33,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,
+    0x2C,0x20,0x53,0x74,0x72,0x61,0xDF,0x65,0x20,0x31,0x32,0x2C,0x20,0x4B,0xF6,0x6C,0x6E,0x3B,0x20,0x74,
+    0x68,0x65,0x20,0x63,0x61,0x66,0xE9,0x20,0x69,0x6E,0x76,0x6F,0x69,0x63,0x65,0x20,0x77,0x61,0x73,0x20,
+    0x70,0x61,0x69,0x64,0x20,0x69,0x6E,0x20,0x66,0x75,0x6C,0x6C,0x2E,0x20
+};
+WCHAR asciiRuns_windows1252_uniSource[]={
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0030,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0032,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0033,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0034,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0035,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0036,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0037,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0038,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0039,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,0x0030,0x0020,
+    0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,
+    0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,
+    0x0074,0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,
+    0x004B,0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,
+    0x0063,0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,
+    0x0063,0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,
+    0x0064,0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,
+    0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,0x0031,
+    0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,
+    0x006F,0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,
+    0x0053,0x0074,0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,
+    0x0020,0x004B,0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,
+    0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,
+    0x0069,0x0063,0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,
+    0x0069,0x0064,0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,
+    0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,
+    0x0032,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,
+    0x0074,0x006F,0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,
+    0x0020,0x0053,0x0074,0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,
+    0x002C,0x0020,0x004B,0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,
+    0x0065,0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,
+    0x006F,0x0069,0x0063,0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,
+    0x0061,0x0069,0x0064,0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,
+    0x006C,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,
+    0x0031,0x0033,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,
+    0x0020,0x0074,0x006F,0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,
+    0x002C,0x0020,0x0053,0x0074,0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,
+    0x0032,0x002C,0x0020,0x004B,0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,
+    0x0068,0x0065,0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,
+    0x0076,0x006F,0x0069,0x0063,0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,
+    0x0070,0x0061,0x0069,0x0064,0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,
+    0x006C,0x006C,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,
+    0x0023,0x0031,0x0034,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,
+    0x0064,0x0020,0x0074,0x006F,0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,
+    0x0072,0x002C,0x0020,0x0053,0x0074,0x0072,0x0061,0x00DF,0x0065,0x0020,
+    0x0031,0x0032,0x002C,0x0020,0x004B,0x00F6,0x006C,0x006E,0x003B,0x0020,
+    0x0074,0x0068,0x0065,0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,0x0069,
+    0x006E,0x0076,0x006F,0x0069,0x0063,0x0065,0x0020,0x0077,0x0061,0x0073,
+    0x0020,0x0070,0x0061,0x0069,0x0064,0x0020,0x0069,0x006E,0x0020,0x0066,
+    0x0075,0x006C,0x006C,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,
+    0x0020,0x0023,0x0031,0x0035,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,
+    0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x004D,0x00FC,0x006C,0x006C,
+    0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,0x0072,0x0061,0x00DF,0x0065,
+    0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,0x00F6,0x006C,0x006E,0x003B,
+    0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,
+    0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,0x0065,0x0020,0x0077,0x0061,
+    0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,0x0020,0x0069,0x006E,0x0020,
+    0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,
+    0x0072,0x0020,0x0023,0x0031,0x0036,0x0020,0x0073,0x0068,0x0069,0x0070,
+    0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x004D,0x00FC,0x006C,
+    0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,0x0072,0x0061,0x00DF,
+    0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,0x00F6,0x006C,0x006E,
+    0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,0x0061,0x0066,0x00E9,
+    0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,0x0065,0x0020,0x0077,
+    0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,0x0020,0x0069,0x006E,
+    0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,0x004F,0x0072,0x0064,
+    0x0065,0x0072,0x0020,0x0023,0x0031,0x0037,0x0020,0x0073,0x0068,0x0069,
+    0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x004D,0x00FC,
+    0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,0x0072,0x0061,
+    0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,0x00F6,0x006C,
+    0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,0x0061,0x0066,
+    0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,0x0065,0x0020,
+    0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,0x0020,0x0069,
+    0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,0x004F,0x0072,
+    0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,0x0038,0x0020,0x0073,0x0068,
+    0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x004D,
+    0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,0x0072,
+    0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,0x00F6,
+    0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,0x0061,
+    0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,0x0065,
+    0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,0x0020,
+    0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,0x004F,
+    0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,0x0039,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,0x0074,
+    0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,0x004B,
+    0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,0x0063,
+    0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,0x0063,
+    0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,0x0064,
+    0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0032,0x0030,0x0020,
+    0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,
+    0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,0x0053,
+    0x0074,0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,0x0020,
+    0x004B,0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,0x0020,
+    0x0063,0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,0x0069,
+    0x0063,0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,0x0069,
+    0x0064,0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,0x002E,
+    0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0032,0x0031,
+    0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,
+    0x006F,0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,0x0020,
+    0x0053,0x0074,0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,0x002C,
+    0x0020,0x004B,0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,0x0065,
+    0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,0x006F,
+    0x0069,0x0063,0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,0x0061,
+    0x0069,0x0064,0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,0x006C,
+    0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0032,
+    0x0032,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,
+    0x0074,0x006F,0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x002C,
+    0x0020,0x0053,0x0074,0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,0x0032,
+    0x002C,0x0020,0x004B,0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,0x0068,
+    0x0065,0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,0x0076,
+    0x006F,0x0069,0x0063,0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,0x0070,
+    0x0061,0x0069,0x0064,0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,0x006C,
+    0x006C,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,
+    0x0032,0x0033,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,
+    0x0020,0x0074,0x006F,0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,
+    0x002C,0x0020,0x0053,0x0074,0x0072,0x0061,0x00DF,0x0065,0x0020,0x0031,
+    0x0032,0x002C,0x0020,0x004B,0x00F6,0x006C,0x006E,0x003B,0x0020,0x0074,
+    0x0068,0x0065,0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,0x0069,0x006E,
+    0x0076,0x006F,0x0069,0x0063,0x0065,0x0020,0x0077,0x0061,0x0073,0x0020,
+    0x0070,0x0061,0x0069,0x0064,0x0020,0x0069,0x006E,0x0020,0x0066,0x0075,
+    0x006C,0x006C,0x002E,0x0020
+};
+unsigned char asciiRuns_sjis_encSource[]={
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x30,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,
+    0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,
+    0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,
+    0x30,0x30,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,
+    0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,
+    0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,
+    0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,
+    0x43,0x2D,0x31,0x30,0x30,0x31,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x32,0x20,0x73,0x68,0x69,
+    0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,
+    0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,
+    0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,
+    0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x30,0x32,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x33,
+    0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,
+    0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,
+    0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,
+    0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x30,0x33,0x2E,0x20,0x4F,0x72,0x64,0x65,
+    0x72,0x20,0x23,0x34,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,
+    0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,
+    0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,
+    0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x30,0x34,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x35,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,
+    0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,
+    0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,
+    0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,
+    0x30,0x35,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x36,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,
+    0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,
+    0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,
+    0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,
+    0x43,0x2D,0x31,0x30,0x30,0x36,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x37,0x20,0x73,0x68,0x69,
+    0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,
+    0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,
+    0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,
+    0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x30,0x37,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x38,
+    0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,
+    0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,
+    0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,
+    0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x30,0x38,0x2E,0x20,0x4F,0x72,0x64,0x65,
+    0x72,0x20,0x23,0x39,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,
+    0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,
+    0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,
+    0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x30,0x39,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x30,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,
+    0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,
+    0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,
+    0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,
+    0x30,0x31,0x30,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x31,0x20,0x73,0x68,0x69,0x70,0x70,
+    0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,
+    0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,
+    0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,
+    0x41,0x42,0x43,0x2D,0x31,0x30,0x31,0x31,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x32,0x20,
+    0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,
+    0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,
+    0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,
+    0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x31,0x32,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,
+    0x20,0x23,0x31,0x33,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,
+    0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,
+    0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,
+    0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x31,0x33,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x34,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,
+    0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,
+    0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,
+    0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,
+    0x30,0x31,0x34,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x35,0x20,0x73,0x68,0x69,0x70,0x70,
+    0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,
+    0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,
+    0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,
+    0x41,0x42,0x43,0x2D,0x31,0x30,0x31,0x35,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x36,0x20,
+    0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,
+    0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,
+    0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,
+    0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x31,0x36,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,
+    0x20,0x23,0x31,0x37,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,
+    0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,
+    0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,
+    0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x31,0x37,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x38,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,
+    0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,
+    0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,
+    0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,
+    0x30,0x31,0x38,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x31,0x39,0x20,0x73,0x68,0x69,0x70,0x70,
+    0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,
+    0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,
+    0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,
+    0x41,0x42,0x43,0x2D,0x31,0x30,0x31,0x39,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x32,0x30,0x20,
+    0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,
+    0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,
+    0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,
+    0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x32,0x30,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,
+    0x20,0x23,0x32,0x31,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,
+    0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,
+    0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,
+    0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,0x30,0x32,0x31,0x2E,0x20,
+    0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x32,0x32,0x20,0x73,0x68,0x69,0x70,0x70,0x65,0x64,0x20,0x74,0x6F,
+    0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,0x20,0x65,0x78,0x70,0x72,
+    0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,0x91,0x97,0x8D,0xCF,0x82,
+    0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,0x41,0x42,0x43,0x2D,0x31,
+    0x30,0x32,0x32,0x2E,0x20,0x4F,0x72,0x64,0x65,0x72,0x20,0x23,0x32,0x33,0x20,0x73,0x68,0x69,0x70,0x70,
+    0x65,0x64,0x20,0x74,0x6F,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x8D,0x60,0x8B,0xE6,0x20,0x76,0x69,0x61,
+    0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x3B,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x3A,0x20,0x94,0x7A,
+    0x91,0x97,0x8D,0xCF,0x82,0xDD,0x2C,0x20,0x74,0x72,0x61,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x64,0x20,
+    0x41,0x42,0x43,0x2D,0x31,0x30,0x32,0x33,0x2E,0x20
+};
+WCHAR asciiRuns_sjis_uniSource[]={
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0030,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,
+    0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,
+    0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,
+    0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,
+    0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,
+    0x0030,0x0030,0x0030,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,
+    0x0020,0x0023,0x0031,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,
+    0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,
+    0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,
+    0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,
+    0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,
+    0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,
+    0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0030,0x0031,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0032,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,
+    0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,
+    0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,
+    0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,
+    0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,
+    0x0030,0x0030,0x0032,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,
+    0x0020,0x0023,0x0033,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,
+    0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,
+    0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,
+    0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,
+    0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,
+    0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,
+    0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0030,0x0033,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0034,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,
+    0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,
+    0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,
+    0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,
+    0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,
+    0x0030,0x0030,0x0034,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,
+    0x0020,0x0023,0x0035,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,
+    0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,
+    0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,
+    0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,
+    0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,
+    0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,
+    0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0030,0x0035,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0036,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,
+    0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,
+    0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,
+    0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,
+    0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,
+    0x0030,0x0030,0x0036,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,
+    0x0020,0x0023,0x0037,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,
+    0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,
+    0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,
+    0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,
+    0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,
+    0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,
+    0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0030,0x0037,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0038,0x0020,0x0073,
+    0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,
+    0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,
+    0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,
+    0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,
+    0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,
+    0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,
+    0x0030,0x0030,0x0038,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,
+    0x0020,0x0023,0x0039,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,
+    0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,
+    0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,
+    0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,
+    0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,
+    0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,
+    0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0030,0x0039,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,0x0030,0x0020,
+    0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,
+    0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,
+    0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,
+    0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,
+    0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,
+    0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,
+    0x0031,0x0030,0x0031,0x0030,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,
+    0x0072,0x0020,0x0023,0x0031,0x0031,0x0020,0x0073,0x0068,0x0069,0x0070,
+    0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,
+    0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,
+    0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,
+    0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,
+    0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,
+    0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0031,0x0031,
+    0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,
+    0x0032,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,
+    0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,
+    0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,
+    0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,
+    0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,
+    0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,
+    0x0043,0x002D,0x0031,0x0030,0x0031,0x0032,0x002E,0x0020,0x004F,0x0072,
+    0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,0x0033,0x0020,0x0073,0x0068,
+    0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,
+    0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,
+    0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,
+    0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,
+    0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,
+    0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,
+    0x0031,0x0033,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,
+    0x0023,0x0031,0x0034,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,
+    0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,
+    0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,
+    0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,
+    0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,
+    0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,
+    0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0031,0x0034,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,0x0035,0x0020,
+    0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,
+    0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,
+    0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,
+    0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,
+    0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,
+    0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,
+    0x0031,0x0030,0x0031,0x0035,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,
+    0x0072,0x0020,0x0023,0x0031,0x0036,0x0020,0x0073,0x0068,0x0069,0x0070,
+    0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,
+    0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,
+    0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,
+    0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,
+    0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,
+    0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0031,0x0036,
+    0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,
+    0x0037,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,
+    0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,
+    0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,
+    0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,
+    0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,
+    0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,
+    0x0043,0x002D,0x0031,0x0030,0x0031,0x0037,0x002E,0x0020,0x004F,0x0072,
+    0x0064,0x0065,0x0072,0x0020,0x0023,0x0031,0x0038,0x0020,0x0073,0x0068,
+    0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,
+    0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,
+    0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,
+    0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,
+    0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,
+    0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,
+    0x0031,0x0038,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,
+    0x0023,0x0031,0x0039,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,
+    0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,
+    0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,
+    0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,
+    0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,
+    0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,
+    0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0031,0x0039,0x002E,0x0020,
+    0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0032,0x0030,0x0020,
+    0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,
+    0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,
+    0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,
+    0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,
+    0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,
+    0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,
+    0x0031,0x0030,0x0032,0x0030,0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,
+    0x0072,0x0020,0x0023,0x0032,0x0031,0x0020,0x0073,0x0068,0x0069,0x0070,
+    0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,
+    0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,
+    0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,
+    0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,
+    0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,
+    0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,0x0032,0x0031,
+    0x002E,0x0020,0x004F,0x0072,0x0064,0x0065,0x0072,0x0020,0x0023,0x0032,
+    0x0032,0x0020,0x0073,0x0068,0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,
+    0x0074,0x006F,0x0020,0x6771,0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,
+    0x0069,0x0061,0x0020,0x0065,0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,
+    0x003B,0x0020,0x0073,0x0074,0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,
+    0x914D,0x9001,0x6E08,0x307F,0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,
+    0x006B,0x0069,0x006E,0x0067,0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,
+    0x0043,0x002D,0x0031,0x0030,0x0032,0x0032,0x002E,0x0020,0x004F,0x0072,
+    0x0064,0x0065,0x0072,0x0020,0x0023,0x0032,0x0033,0x0020,0x0073,0x0068,
+    0x0069,0x0070,0x0070,0x0065,0x0064,0x0020,0x0074,0x006F,0x0020,0x6771,
+    0x4EAC,0x90FD,0x6E2F,0x533A,0x0020,0x0076,0x0069,0x0061,0x0020,0x0065,
+    0x0078,0x0070,0x0072,0x0065,0x0073,0x0073,0x003B,0x0020,0x0073,0x0074,
+    0x0061,0x0074,0x0075,0x0073,0x003A,0x0020,0x914D,0x9001,0x6E08,0x307F,
+    0x002C,0x0020,0x0074,0x0072,0x0061,0x0063,0x006B,0x0069,0x006E,0x0067,
+    0x0020,0x0069,0x0064,0x0020,0x0041,0x0042,0x0043,0x002D,0x0031,0x0030,
+    0x0032,0x0033,0x002E,0x0020
+};
 #endif
 
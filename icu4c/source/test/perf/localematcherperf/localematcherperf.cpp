@@ -0,0 +1,224 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*   file name:  localematcherperf.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Performance test program for negotiating a locale from
+*   HTTP Accept-Language header values, with LocaleMatcher
+*   and with uloc_acceptLanguageFromHTTP() for comparison.
+*
+* Usage from within <ICU build tree>/test/perf/localematcherperf/ :
+* (Linux)
+*  make
+*  export LD_LIBRARY_PATH=../../../lib:../../../stubdata:../../../tools/ctestfw
+*  ./localematcherperf --passes 3 --iterations 1000
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unicode/localematcher.h"
+#include "unicode/uenum.h"
+#include "unicode/uloc.h"
+#include "unicode/uperf.h"
+#include "cmemory.h" // for UPRV_LENGTHOF
+
+// Accept-Language values as sent by common browsers and HTTP clients.
+static const char *const headers[] = {
+    "en-US,en;q=0.9",
+    "en-GB,en-US;q=0.9,en;q=0.8",
+    "de-DE,de;q=0.9,en-US;q=0.8,en;q=0.7",
+    "fr-FR,fr;q=0.9,en-US;q=0.8,en;q=0.7",
+    "es-ES,es;q=0.9",
+    "es-MX,es;q=0.9,en;q=0.8",
+    "pt-BR,pt;q=0.9,en-US;q=0.8,en;q=0.7",
+    "ja,en-US;q=0.9,en;q=0.8",
+    "zh-CN,zh;q=0.9",
+    "zh-TW,zh;q=0.9,en-US;q=0.8,en;q=0.7",
+    "zh-HK,zh-TW;q=0.9,zh;q=0.8,en;q=0.7",
+    "ko-KR,ko;q=0.9,en-US;q=0.8,en;q=0.7",
+    "ru-RU,ru;q=0.9,en-US;q=0.8,en;q=0.7",
+    "nl-NL,nl;q=0.9,en-US;q=0.8,en;q=0.7",
+    "en-AU,en;q=0.9",
+    "en-IN,en-GB;q=0.9,en-US;q=0.8,en;q=0.7,hi;q=0.6",
+    "de-CH,de;q=0.9,fr-CH;q=0.8,fr;q=0.7,en;q=0.6",
+    "nb-NO,nb;q=0.9,no;q=0.8,nn;q=0.7,en-US;q=0.6,en;q=0.5",
+    "sv-SE,sv;q=0.9,en-US;q=0.8,en;q=0.7",
+    "ar-SA,ar;q=0.9,en;q=0.8",
+    "he-IL,he;q=0.9,en-US;q=0.8,en;q=0.7",
+    "tr-TR,tr;q=0.9,en-US;q=0.8,en;q=0.7",
+    "pl-PL,pl;q=0.9,en-US;q=0.8,en;q=0.7",
+    "uk-UA,uk;q=0.9,ru;q=0.8,en-US;q=0.7,en;q=0.6",
+    "da, en-gb;q=0.8, en;q=0.7",
+    "fr-CA,fr;q=0.8,en-US;q=0.6,en;q=0.4",
+    "gsw-CH,de-CH;q=0.9,de;q=0.8",
+    "*"
+};
+
+// A typical set of locales that a web application is translated into.
+static const char *const supportedIDs[] = {
+    "en", "en_GB", "de", "fr", "fr_CA", "es", "es_419", "it", "pt", "pt_PT",
+    "nl", "sv", "da", "nb", "fi", "pl", "cs", "ru", "uk", "tr",
+    "ar", "he", "hi", "th", "id", "vi", "ja", "ko", "zh", "zh_TW"
+};
+
+// Test object.
+class LocaleMatcherPerfTest : public UPerfTest {
+public:
+    LocaleMatcherPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, NULL, 0, "", status), matcher(NULL) {
+        if (U_FAILURE(status)) {
+            return;
+        }
+        for (int32_t i = 0; i < UPRV_LENGTHOF(supportedIDs); ++i) {
+            supported[i] = icu::Locale(supportedIDs[i]);
+        }
+        matcher = new icu::LocaleMatcher(supported, UPRV_LENGTHOF(supported), status);
+        for (int32_t i = 0; i < UPRV_LENGTHOF(headers) && U_SUCCESS(status); ++i) {
+            const icu::Locale *best = matcher->getBestMatchForListString(headers[i], status);
+            if (U_SUCCESS(status) && verbose) {
+                printf("%s -> %s\n", headers[i], best->getName());
+            }
+        }
+    }
+
+    virtual ~LocaleMatcherPerfTest() {
+        delete matcher;
+    }
+
+    virtual UPerfFunction *runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+
+    icu::Locale supported[UPRV_LENGTHOF(supportedIDs)];
+    icu::LocaleMatcher *matcher;
+};
+
+// Performance test function object.
+class Command : public UPerfFunction {
+protected:
+    Command(const LocaleMatcherPerfTest &testcase) : testcase(testcase) {}
+
+public:
+    virtual ~Command() {}
+
+    virtual long getOperationsPerIteration() {
+        return UPRV_LENGTHOF(headers);
+    }
+
+    const LocaleMatcherPerfTest &testcase;
+};
+
+// LocaleMatcher::getBestMatchForListString() on each header.
+class MatchListString : public Command {
+protected:
+    MatchListString(const LocaleMatcherPerfTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const LocaleMatcherPerfTest &testcase) {
+        return new MatchListString(testcase);
+    }
+    virtual void call(UErrorCode *pErrorCode) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(headers); ++i) {
+            testcase.matcher->getBestMatchForListString(headers[i], *pErrorCode);
+        }
+    }
+};
+
+// LocaleMatcher::getBestMatch() on the first language tag of each header, already parsed.
+class MatchLocale : public Command {
+protected:
+    MatchLocale(const LocaleMatcherPerfTest &testcase) : Command(testcase) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(headers); ++i) {
+            char tag[32];
+            int32_t length = (int32_t)strcspn(headers[i], ",;");
+            uprv_memcpy(tag, headers[i], length);
+            tag[length] = 0;
+            UErrorCode errorCode = U_ZERO_ERROR;
+            desired[i] = icu::Locale::forLanguageTag(tag, errorCode);
+        }
+    }
+
+public:
+    static UPerfFunction* get(const LocaleMatcherPerfTest &testcase) {
+        return new MatchLocale(testcase);
+    }
+    virtual void call(UErrorCode *pErrorCode) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(headers); ++i) {
+            testcase.matcher->getBestMatch(desired[i], *pErrorCode);
+        }
+    }
+
+    icu::Locale desired[UPRV_LENGTHOF(headers)];
+};
+
+// uloc_acceptLanguageFromHTTP() on each header, which only does locale ID fallback.
+class AcceptLanguageFromHTTP : public Command {
+protected:
+    AcceptLanguageFromHTTP(const LocaleMatcherPerfTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const LocaleMatcherPerfTest &testcase) {
+        return new AcceptLanguageFromHTTP(testcase);
+    }
+    virtual void call(UErrorCode *pErrorCode) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(headers); ++i) {
+            UEnumeration *available = uenum_openCharStringsEnumeration(
+                supportedIDs, UPRV_LENGTHOF(supportedIDs), pErrorCode);
+            char result[ULOC_FULLNAME_CAPACITY];
+            UAcceptResult outResult;
+            uloc_acceptLanguageFromHTTP(result, UPRV_LENGTHOF(result), &outResult,
+                                        headers[i], available, pErrorCode);
+            uenum_close(available);
+        }
+    }
+};
+
+// Constructing a LocaleMatcher for the supported locales.
+class CreateMatcher : public Command {
+protected:
+    CreateMatcher(const LocaleMatcherPerfTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const LocaleMatcherPerfTest &testcase) {
+        return new CreateMatcher(testcase);
+    }
+    virtual long getOperationsPerIteration() {
+        return 1;
+    }
+    virtual void call(UErrorCode *pErrorCode) {
+        icu::LocaleMatcher matcher(testcase.supported, UPRV_LENGTHOF(supportedIDs), *pErrorCode);
+    }
+};
+
+UPerfFunction *LocaleMatcherPerfTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char * /*par*/) {
+    switch (index) {
+        case 0: name = "MatchListString";           if (exec) return MatchListString::get(*this); break;
+        case 1: name = "MatchLocale";               if (exec) return MatchLocale::get(*this); break;
+        case 2: name = "AcceptLanguageFromHTTP";    if (exec) return AcceptLanguageFromHTTP::get(*this); break;
+        case 3: name = "CreateMatcher";             if (exec) return CreateMatcher::get(*this); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    LocaleMatcherPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)) {
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE) {
+        fprintf(stderr, "FAILED: Tests could not be run, please check the "
+                        "arguments.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -66,6 +66,13 @@ UPerfFunction* NormalizerPerformanceTest::runIndexedTest(int32_t index, UBool ex
         TESTCASE(31,TestIsNormalized_FCD_NFC_Text);
         TESTCASE(32,TestIsNormalized_FCD_Orig_Text);
 
+        TESTCASE(33,TestSpanQCYes_NFC_NFC_Text);
+        TESTCASE(34,TestSpanQCYes_NFD_NFD_Text);
+
+        TESTCASE(35,TestIsNormalizedUTF8_NFC_NFC_Text);
+        TESTCASE(36,TestICUUTF8_NFC_NFC_Text);
+        TESTCASE(37,TestICUUTF8_NFC_Orig_Text);
+
         default: 
             name = ""; 
             return NULL;
@@ -494,6 +501,55 @@ UPerfFunction* NormalizerPerformanceTest::TestIsNormalized_FCD_Orig_Text(){
     }
 }
 
+// Test spanQuickCheckYes Performance
+UPerfFunction* NormalizerPerformanceTest::TestSpanQCYes_NFC_NFC_Text(){
+    if(line_mode){
+        QuickCheckPerfFunction* func = new QuickCheckPerfFunction(ICUSpanQuickCheckYes,NFCFileLines, numLines, UNORM_NFC, options,uselen);
+        return func;
+    }else{
+        QuickCheckPerfFunction* func = new QuickCheckPerfFunction(ICUSpanQuickCheckYes,NFCBuffer, NFCBufferLen, UNORM_NFC, options,uselen);
+        return func;
+    }
+}
+UPerfFunction* NormalizerPerformanceTest::TestSpanQCYes_NFD_NFD_Text(){
+    if(line_mode){
+        QuickCheckPerfFunction* func = new QuickCheckPerfFunction(ICUSpanQuickCheckYes,NFDFileLines, numLines, UNORM_NFD, options,uselen);
+        return func;
+    }else{
+        QuickCheckPerfFunction* func = new QuickCheckPerfFunction(ICUSpanQuickCheckYes,NFDBuffer, NFDBufferLen, UNORM_NFD, options,uselen);
+        return func;
+    }
+}
+
+// Test UTF-8 Performance
+UPerfFunction* NormalizerPerformanceTest::TestIsNormalizedUTF8_NFC_NFC_Text(){
+    UErrorCode errorCode = U_ZERO_ERROR;
+    const icu::Normalizer2* nfc = icu::Normalizer2::getNFCInstance(errorCode);
+    if(line_mode){
+        return new UTF8NormPerfFunction(nfc, FALSE, NFCFileLines, numLines);
+    }else{
+        return new UTF8NormPerfFunction(nfc, FALSE, NFCBuffer, NFCBufferLen);
+    }
+}
+UPerfFunction* NormalizerPerformanceTest::TestICUUTF8_NFC_NFC_Text(){
+    UErrorCode errorCode = U_ZERO_ERROR;
+    const icu::Normalizer2* nfc = icu::Normalizer2::getNFCInstance(errorCode);
+    if(line_mode){
+        return new UTF8NormPerfFunction(nfc, TRUE, NFCFileLines, numLines);
+    }else{
+        return new UTF8NormPerfFunction(nfc, TRUE, NFCBuffer, NFCBufferLen);
+    }
+}
+UPerfFunction* NormalizerPerformanceTest::TestICUUTF8_NFC_Orig_Text(){
+    UErrorCode errorCode = U_ZERO_ERROR;
+    const icu::Normalizer2* nfc = icu::Normalizer2::getNFCInstance(errorCode);
+    if(line_mode){
+        return new UTF8NormPerfFunction(nfc, TRUE, lines, numLines);
+    }else{
+        return new UTF8NormPerfFunction(nfc, TRUE, buffer, bufferLen);
+    }
+}
+
 int main(int argc, const char* argv[]){
     UErrorCode status = U_ZERO_ERROR;
     NormalizerPerformanceTest test(argc, argv, status);
@@ -14,6 +14,9 @@
 
 #include "unicode/unorm.h"
 #include "unicode/ustring.h"
+#include "unicode/bytestream.h"
+#include "unicode/normalizer2.h"
+#include "unicode/unorm2.h"
 
 #include "unicode/uperf.h"
 #include <stdlib.h>
@@ -178,6 +181,80 @@ class NormPerfFunction : public UPerfFunction{
 
 
 
+// Normalizer2 on UTF-8 text: normalizeUTF8() if normalize is TRUE, otherwise isNormalizedUTF8().
+class UTF8NormPerfFunction : public UPerfFunction{
+private:
+    const icu::Normalizer2* n2;
+    UBool normalize;
+    char* utf8;         // all of the lines, back to back
+    int32_t* limits;    // end of each line in utf8
+    int32_t numLines;
+    int32_t utf16Length;
+    char* dest;
+    int32_t destCapacity;
+
+    void init(const ULine* srcLines, int32_t srcNumLines){
+        UErrorCode errorCode = U_ZERO_ERROR;
+        int32_t utf8Length = 0;
+        utf16Length = 0;
+        for(int32_t i = 0; i < srcNumLines; i++){
+            int32_t length = 0;
+            errorCode = U_ZERO_ERROR;
+            u_strToUTF8(NULL, 0, &length, srcLines[i].name, srcLines[i].len, &errorCode);
+            utf8Length += length;
+            utf16Length += srcLines[i].len;
+        }
+        utf8 = new char[utf8Length + 1];
+        limits = new int32_t[srcNumLines];
+        numLines = srcNumLines;
+        int32_t start = 0;
+        for(int32_t i = 0; i < srcNumLines; i++){
+            int32_t length = 0;
+            errorCode = U_ZERO_ERROR;
+            u_strToUTF8(utf8 + start, utf8Length + 1 - start, &length,
+                        srcLines[i].name, srcLines[i].len, &errorCode);
+            limits[i] = start += length;
+        }
+        // NFC of NFC text has the same length; other text may grow.
+        destCapacity = 3 * utf8Length + 16;
+        dest = new char[destCapacity];
+    }
+
+public:
+    virtual void call(UErrorCode* status){
+        int32_t start = 0;
+        for(int32_t i = 0; i < numLines; i++){
+            icu::StringPiece s(utf8 + start, limits[i] - start);
+            if(normalize){
+                icu::CheckedArrayByteSink sink(dest, destCapacity);
+                n2->normalizeUTF8(0, s, sink, NULL, *status);
+            }else{
+                n2->isNormalizedUTF8(s, *status);
+            }
+            start = limits[i];
+        }
+    }
+    virtual long getOperationsPerIteration(){
+        return utf16Length;
+    }
+    UTF8NormPerfFunction(const icu::Normalizer2* normalizer2, UBool doNormalize, const ULine* srcLines, int32_t srcNumLines)
+            : n2(normalizer2), normalize(doNormalize) {
+        init(srcLines, srcNumLines);
+    }
+    UTF8NormPerfFunction(const icu::Normalizer2* normalizer2, UBool doNormalize, const UChar* source, int32_t sourceLen)
+            : n2(normalizer2), normalize(doNormalize) {
+        ULine line;
+        line.name = (UChar*)source;
+        line.len = sourceLen;
+        init(&line, 1);
+    }
+    ~UTF8NormPerfFunction(){
+        delete[] utf8;
+        delete[] limits;
+        delete[] dest;
+    }
+};
+
 class  NormalizerPerformanceTest : public UPerfTest{
 private:
     ULine* NFDFileLines;
@@ -249,6 +326,15 @@ class  NormalizerPerformanceTest : public UPerfTest{
     UPerfFunction* TestIsNormalized_FCD_NFC_Text();
     UPerfFunction* TestIsNormalized_FCD_Orig_Text();
 
+    /* spanQuickCheckYes performance */
+    UPerfFunction* TestSpanQCYes_NFC_NFC_Text();
+    UPerfFunction* TestSpanQCYes_NFD_NFD_Text();
+
+    /* UTF-8 performance */
+    UPerfFunction* TestIsNormalizedUTF8_NFC_NFC_Text();
+    UPerfFunction* TestICUUTF8_NFC_NFC_Text();
+    UPerfFunction* TestICUUTF8_NFC_Orig_Text();
+
 };
 
 //---------------------------------------------------------------------------------------
@@ -288,6 +374,11 @@ int32_t ICUIsNormalized(const UChar* src,int32_t srcLen, UNormalizationMode mode
     return unorm_isNormalized(src,srcLen,mode,status);
 }
 
+int32_t ICUSpanQuickCheckYes(const UChar* src,int32_t srcLen, UNormalizationMode mode, int32_t options, UErrorCode* status){
+    const UNormalizer2* n2 = mode == UNORM_NFD ? unorm2_getNFDInstance(status) : unorm2_getNFCInstance(status);
+    return unorm2_spanQuickCheckYes(n2,src,srcLen,status);
+}
+
 
 #else
 
@@ -317,6 +408,10 @@ int32_t ICUQuickCheck(const UChar* src,int32_t srcLen, UNormalizationMode mode,
 int32_t ICUIsNormalized(const UChar* src,int32_t srcLen, UNormalizationMode mode, int32_t options, UErrorCode* status){
     return 0;
 }
+
+int32_t ICUSpanQuickCheckYes(const UChar* src,int32_t srcLen, UNormalizationMode mode, int32_t options, UErrorCode* status){
+    return 0;
+}
 #endif
 
 #if U_PLATFORM_HAS_WIN32_API
@@ -0,0 +1,201 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*   file name:  resperf.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Performance test program for opening and closing resource bundles,
+*   from one thread and from several threads at once.
+*
+* Usage from within <ICU build tree>/test/perf/resperf/ :
+* (Linux)
+*  make
+*  export LD_LIBRARY_PATH=../../../lib:../../../stubdata:../../../tools/ctestfw
+*  ./resperf --threads 8 --passes 3 --iterations 1000
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include "unicode/uperf.h"
+#include "unicode/ures.h"
+#include "uoptions.h"
+#include "cmemory.h" // for UPRV_LENGTHOF
+#include "uresimp.h" // for ures_getByKeyWithFallback()
+
+// Command-line options specific to resperf.
+// Options do not have abbreviations: Force readable command lines.
+// (Using U+0001 for abbreviation characters.)
+enum {
+    THREADS,
+    RESPERF_OPTIONS_COUNT
+};
+
+static UOption options[RESPERF_OPTIONS_COUNT]={
+    UOPTION_DEF("threads", '\x01', UOPT_REQUIRES_ARG)
+};
+
+static const char *const resperf_usage =
+    "\t--threads   Number of threads for the *Threads tests.\n"
+    "\t            Default: 4\n";
+
+// A mix of locale IDs with different fallback chains, including an alias (iw).
+static const char *const locales[] = {
+    "en", "en_US", "en_GB", "de", "de_AT", "fr_CA", "ja", "zh_Hant_TW",
+    "ru", "ar_EG", "es_419", "pt_BR", "iw", "sr_Latn", "", "th"
+};
+
+// Test object.
+class ResourceBundlePerfTest : public UPerfTest {
+public:
+    ResourceBundlePerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, options, UPRV_LENGTHOF(options), resperf_usage, status),
+              numThreads(4) {
+        if (U_SUCCESS(status)) {
+            numThreads = atoi(options[THREADS].value);
+            if (numThreads <= 0) {
+                numThreads = 1;
+            }
+            // Warm up the cache so that all of the tests measure cache hits.
+            for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+                UErrorCode errorCode = U_ZERO_ERROR;
+                ures_close(ures_open(NULL, locales[i], &errorCode));
+            }
+        }
+    }
+
+    virtual UPerfFunction *runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+
+    int32_t numThreads;
+};
+
+// Performance test function object.
+class Command : public UPerfFunction {
+protected:
+    Command(const ResourceBundlePerfTest &testcase, int32_t threads) :
+            testcase(testcase), threads(threads) {}
+
+public:
+    virtual ~Command() {}
+
+    virtual long getOperationsPerIteration() {
+        return (long)threads * UPRV_LENGTHOF(locales);
+    }
+
+    virtual void call(UErrorCode *pErrorCode) {
+        run(pErrorCode);
+    }
+
+    // With several threads, start them once and have each one call run() n times.
+    virtual double time(int32_t n, UErrorCode *pErrorCode) {
+        if (threads == 1) {
+            return UPerfFunction::time(n, pErrorCode);
+        }
+        std::thread *workers = new std::thread[threads];
+        UErrorCode *errorCodes = new UErrorCode[threads];
+        UTimer start, stop;
+        utimer_getTime(&start);
+        for (int32_t i = 0; i < threads; ++i) {
+            errorCodes[i] = U_ZERO_ERROR;
+            workers[i] = std::thread(&Command::runLoop, this, n, &errorCodes[i]);
+        }
+        for (int32_t i = 0; i < threads; ++i) {
+            workers[i].join();
+        }
+        utimer_getTime(&stop);
+        for (int32_t i = 0; i < threads; ++i) {
+            if (U_FAILURE(errorCodes[i]) && U_SUCCESS(*pErrorCode)) {
+                *pErrorCode = errorCodes[i];
+            }
+        }
+        delete[] errorCodes;
+        delete[] workers;
+        return utimer_getDeltaSeconds(&start, &stop);
+    }
+
+    void runLoop(int32_t n, UErrorCode *pErrorCode) {
+        while (n-- > 0) {
+            run(pErrorCode);
+        }
+    }
+
+    // Work done by each thread.
+    virtual void run(UErrorCode *pErrorCode) = 0;
+
+    const ResourceBundlePerfTest &testcase;
+    int32_t threads;
+};
+
+// ures_open() and ures_close() each locale.
+class OpenClose : public Command {
+protected:
+    OpenClose(const ResourceBundlePerfTest &testcase, int32_t threads) : Command(testcase, threads) {}
+
+public:
+    static UPerfFunction* get(const ResourceBundlePerfTest &testcase, int32_t threads) {
+        return new OpenClose(testcase, threads);
+    }
+    virtual void run(UErrorCode *pErrorCode) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+            UResourceBundle *rb = ures_open(NULL, locales[i], pErrorCode);
+            ures_close(rb);
+        }
+    }
+};
+
+// ures_open() each locale, look up a string that is usually inherited, and ures_close().
+class OpenGetClose : public Command {
+protected:
+    OpenGetClose(const ResourceBundlePerfTest &testcase, int32_t threads) : Command(testcase, threads) {}
+
+public:
+    static UPerfFunction* get(const ResourceBundlePerfTest &testcase, int32_t threads) {
+        return new OpenGetClose(testcase, threads);
+    }
+    virtual void run(UErrorCode *pErrorCode) {
+        for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+            UResourceBundle *rb = ures_open(NULL, locales[i], pErrorCode);
+            UErrorCode errorCode = U_ZERO_ERROR;
+            UResourceBundle *ns = ures_getByKeyWithFallback(rb, "NumberElements/default", NULL, &errorCode);
+            ures_close(ns);
+            ures_close(rb);
+        }
+    }
+};
+
+UPerfFunction *ResourceBundlePerfTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char * /*par*/) {
+    switch (index) {
+        case 0: name = "OpenClose";             if (exec) return OpenClose::get(*this, 1); break;
+        case 1: name = "OpenCloseThreads";      if (exec) return OpenClose::get(*this, numThreads); break;
+        case 2: name = "OpenGetClose";          if (exec) return OpenGetClose::get(*this, 1); break;
+        case 3: name = "OpenGetCloseThreads";   if (exec) return OpenGetClose::get(*this, numThreads); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[])
+{
+    // Default values for command-line options.
+    options[THREADS].value = "4";
+
+    UErrorCode status = U_ZERO_ERROR;
+    ResourceBundlePerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)) {
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE) {
+        fprintf(stderr, "FAILED: Tests could not be run, please check the "
+                        "arguments.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -78,6 +78,18 @@
     [
         "TestNames_Thai.txt",
         "th18057.txt"
+    ],
+    # Chinese and Japanese text is segmented by the CJK dictionary break engine
+    # for word and line breaks.
+    "ja",
+    [
+        "TestNames_Japanese.txt",
+        "TestNames_Japanese_h.txt",
+        "TestNames_Japanese_k.txt"
+    ],
+    "zh",
+    [
+        "TestNames_Chinese.txt"
     ]
 };
 
@@ -92,6 +104,9 @@
     "TestIsBoundWord",      ["$p1,$m2,TestICUIsBound", "$p2,$m2,TestICUIsBound"],
     "TestIsBoundLine",      ["$p1,$m3,TestICUIsBound", "$p2,$m3,TestICUIsBound"],
     "TestIsBoundSentence",  ["$p1,$m4,TestICUIsBound", "$p2,$m4,TestICUIsBound"],
+
+    # Long runs of Thai etc. divided up into words on one vs. four threads.
+    "TestForwardWordThreads", ["$p2,$m2 -T 1,TestICUForwardThreads", "$p2,$m2 -T 4,TestICUForwardThreads"],
 };
 
 runTests($options, $tests, $dataFiles);
@@ -24,6 +24,7 @@
 #include "ubrkperf.h"
 #include "uoptions.h"
 #include <stdio.h>
+#include <stdlib.h>
 
 
 #if 0
@@ -160,6 +161,26 @@ UPerfFunction* BreakIteratorPerformanceTest::TestICUIsBound()
   return new ICUIsBound(locale, m_mode_, m_file_, m_fileLen_);
 }
 
+UPerfFunction* BreakIteratorPerformanceTest::TestICUForwardStatus()
+{
+  return new ICUForwardStatus(locale, m_mode_, m_file_, m_fileLen_);
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICUForwardBulk()
+{
+  return new ICUForwardBulk(locale, m_mode_, m_file_, m_fileLen_);
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICUForwardUTF8()
+{
+  return new ICUForwardUTF8(locale, m_mode_, m_file_, m_fileLen_);
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICUForwardThreads()
+{
+  return new ICUForwardThreads(locale, m_mode_, m_file_, m_fileLen_, m_threads_);
+}
+
 UPerfFunction* BreakIteratorPerformanceTest::TestDarwinForward()
 {
   return NULL;
@@ -179,6 +200,10 @@ UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool
 		TESTCASE(1, TestICUIsBound);
 		TESTCASE(2, TestDarwinForward);
 		TESTCASE(3, TestDarwinIsBound);
+		TESTCASE(4, TestICUForwardStatus);
+		TESTCASE(5, TestICUForwardBulk);
+		TESTCASE(6, TestICUForwardUTF8);
+		TESTCASE(7, TestICUForwardThreads);
         default: 
             name = ""; 
             return NULL;
@@ -187,20 +212,23 @@ UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool
 }
 
 UOption options[]={
-                      UOPTION_DEF( "mode",        'm', UOPT_REQUIRES_ARG)
+                      UOPTION_DEF( "mode",        'm', UOPT_REQUIRES_ARG),
+                      UOPTION_DEF( "threads",     'T', UOPT_REQUIRES_ARG)
                   };
 
+static const char *const ubrkperf_usage =
+    "\t-m or --mode        Required mode for breakiterator: char, word, line or sentence\n"
+    "\t-T or --threads     Maximum number of threads for one run of dictionary text\n"
+    "\t                    in TestICUForwardThreads; default 1\n";
+
 
 BreakIteratorPerformanceTest::BreakIteratorPerformanceTest(int32_t argc, const char* argv[], UErrorCode& status)
-: UPerfTest(argc,argv,status),
+: UPerfTest(argc,argv,options,UPRV_LENGTHOF(options),ubrkperf_usage,status),
 m_mode_(NULL),
 m_file_(NULL),
-m_fileLen_(0)
+m_fileLen_(0),
+m_threads_(1)
 {
-
-    _remainingArgc = u_parseArgs(_remainingArgc, (char**)argv, UPRV_LENGTHOF(options), options);
-
-
     if(options[0].doesOccur) {
       m_mode_ = options[0].value;
       switch(options[0].value[0]) {
@@ -217,6 +245,10 @@ m_fileLen_(0)
       status = U_ILLEGAL_ARGUMENT_ERROR;
     }
 
+    if(options[1].doesOccur) {
+      m_threads_ = atoi(options[1].value);
+    }
+
     m_file_ = getBuffer(m_fileLen_, status);
 
     if(status== U_ILLEGAL_ARGUMENT_ERROR){
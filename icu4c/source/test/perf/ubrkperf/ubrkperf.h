@@ -15,6 +15,10 @@
 #include "unicode/uperf.h"
 
 #include <unicode/brkiter.h>
+#include <unicode/rbbi.h>
+#include <unicode/utext.h>
+#include <string>
+#include "cmemory.h"
 
 class ICUBreakFunction : public UPerfFunction {
 protected:
@@ -107,6 +111,110 @@ class ICUForward : public ICUBreakFunction {
   }
 };
 
+class ICUForwardBulk : public ICUBreakFunction {
+  RuleBasedBreakIterator *m_rbbi_;
+  int32_t m_boundaries_[256];
+  int32_t m_statuses_[256];
+public:
+  ICUForwardBulk(const char *locale, const char *mode, const UChar *file, int32_t file_len) :
+      ICUBreakFunction(locale, mode, file, file_len),
+      m_rbbi_(dynamic_cast<RuleBasedBreakIterator *>(m_brkIt_))
+  {
+    if(U_SUCCESS(m_status_) && m_rbbi_ == NULL) {
+      m_status_ = U_UNSUPPORTED_ERROR;
+      return;
+    }
+    m_brkIt_->setText(UnicodeString(m_file_, m_fileLen_));
+    UErrorCode status = U_ZERO_ERROR;
+    call(&status);
+  }
+  virtual void call(UErrorCode *status) 
+  {
+    m_noBreaks_ = 0;
+    m_rbbi_->first();
+    int32_t n;
+    while((n = m_rbbi_->nextBoundaries(m_boundaries_, UPRV_LENGTHOF(m_boundaries_), m_statuses_)) > 0) {
+      m_noBreaks_ += n;
+    }
+  }
+};
+
+class ICUForwardUTF8 : public ICUBreakFunction {
+  std::string m_file8_;
+  UText *m_text_;
+public:
+  ICUForwardUTF8(const char *locale, const char *mode, const UChar *file, int32_t file_len) :
+      ICUBreakFunction(locale, mode, file, file_len),
+      m_text_(NULL)
+  {
+    UnicodeString(m_file_, m_fileLen_).toUTF8String(m_file8_);
+    m_text_ = utext_openUTF8(NULL, m_file8_.data(), (int64_t)m_file8_.length(), &m_status_);
+    m_brkIt_->setText(m_text_, m_status_);
+    UErrorCode status = U_ZERO_ERROR;
+    call(&status);
+  }
+  ~ICUForwardUTF8() { utext_close(m_text_); }
+  virtual void call(UErrorCode *status) 
+  {
+    m_noBreaks_ = 0;
+    m_brkIt_->first();
+    while(m_brkIt_->next() != BreakIterator::DONE) {
+      m_noBreaks_++;
+    }
+  }
+};
+
+// Dictionary-based segmentation of long runs of text with setDictionaryThreadCount().
+// Each call sets the text again so that the dictionary boundaries are not reused from the cache.
+class ICUForwardThreads : public ICUBreakFunction {
+  UText *m_text_;
+public:
+  ICUForwardThreads(const char *locale, const char *mode, const UChar *file, int32_t file_len,
+                    int32_t numThreads) :
+      ICUBreakFunction(locale, mode, file, file_len),
+      m_text_(NULL)
+  {
+    RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(m_brkIt_);
+    if (rbbi != NULL) {
+      rbbi->setDictionaryThreadCount(numThreads);
+    }
+    m_text_ = utext_openUChars(NULL, m_file_, m_fileLen_, &m_status_);
+    UErrorCode status = U_ZERO_ERROR;
+    call(&status);
+  }
+  ~ICUForwardThreads() { utext_close(m_text_); }
+  virtual void call(UErrorCode *status) 
+  {
+    m_noBreaks_ = 0;
+    m_brkIt_->setText(m_text_, *status);
+    while(m_brkIt_->next() != BreakIterator::DONE) {
+      m_noBreaks_++;
+    }
+  }
+};
+
+class ICUForwardStatus : public ICUBreakFunction {
+public:
+  ICUForwardStatus(const char *locale, const char *mode, const UChar *file, int32_t file_len) :
+      ICUBreakFunction(locale, mode, file, file_len)
+  {
+    m_brkIt_->setText(UnicodeString(m_file_, m_fileLen_));
+    UErrorCode status = U_ZERO_ERROR;
+    call(&status);
+  }
+  virtual void call(UErrorCode *status) 
+  {
+    m_noBreaks_ = 0;
+    int32_t statusSum = 0;
+    m_brkIt_->first();
+    while(m_brkIt_->next() != BreakIterator::DONE) {
+      statusSum += m_brkIt_->getRuleStatus();
+      m_noBreaks_++;
+    }
+    (void)statusSum;
+  }
+};
+
 class DarwinBreakFunction : public UPerfFunction {
 public:
   virtual void call(UErrorCode *status) {};
@@ -117,6 +225,7 @@ class BreakIteratorPerformanceTest : public UPerfTest {
   const char* m_mode_;
   const UChar* m_file_;
   int32_t m_fileLen_;
+  int32_t m_threads_;
 
 public:
   BreakIteratorPerformanceTest(int32_t argc, const char* argv[], UErrorCode& status);
@@ -127,6 +236,10 @@ class BreakIteratorPerformanceTest : public UPerfTest {
 
   UPerfFunction* TestICUForward();
   UPerfFunction* TestICUIsBound();
+  UPerfFunction* TestICUForwardStatus();
+  UPerfFunction* TestICUForwardBulk();
+  UPerfFunction* TestICUForwardUTF8();
+  UPerfFunction* TestICUForwardThreads();
 
   UPerfFunction* TestDarwinForward();
   UPerfFunction* TestDarwinIsBound();
@@ -91,3 +91,41 @@
 };
 
 runTests($options, $tests, $dataFiles);
+
+# Frozen sets with short spans (word/space alternation) and long spans
+# (whole lines) for the vectorized BMPSet span loops.
+$options = {
+    "title"=>"UnicodeSet span() performance: frozen sets, short and long spans",
+    "headers"=>"WhiteSpace NotLtGtLF",
+    "operationIs"=>"tested Unicode code point",
+    "passes"=>"3",
+    "time"=>"2",
+    #"outputType"=>"HTML",
+    "dataDir"=>$UDHRDataPath,
+    "outputDir"=>"../results"
+};
+
+$tests = {
+    "SpanUTF16",
+    [
+        "$p,SpanUTF16 --type fast --pattern [:White_Space:]",
+        "$p,SpanUTF16 --type fast --pattern [^<>\\u000A]"
+    ],
+    "SpanBackUTF16",
+    [
+        "$p,SpanBackUTF16 --type fast --pattern [:White_Space:]",
+        "$p,SpanBackUTF16 --type fast --pattern [^<>\\u000A]"
+    ],
+    "SpanUTF8",
+    [
+        "$p,SpanUTF8 --type fast --pattern [:White_Space:]",
+        "$p,SpanUTF8 --type fast --pattern [^<>\\u000A]"
+    ],
+    "SpanBackUTF8",
+    [
+        "$p,SpanBackUTF8 --type fast --pattern [:White_Space:]",
+        "$p,SpanBackUTF8 --type fast --pattern [^<>\\u000A]"
+    ]
+};
+
+runTests($options, $tests, $dataFiles);
@@ -75,5 +75,46 @@
 
 runTests($options, $tests, $dataFiles);
 
+$options = {
+    "title"=>"Unicode String case mapping performance: UTF-16 vs. UTF-8",
+    "headers"=>"UTF-16 UTF-8",
+    "operationIs"=>"code unit",
+    "eventIs"=>"string",
+    "passes"=>"5",
+    "time"=>"2",
+    #"outputType"=>"HTML",
+    "dataDir"=>$CollationDataPath,
+    "outputDir"=>"../results"
+};
+
+$tests = {
+    "Lowercasing",                            ["$p,TestToLower"            , "$p,TestUTF8ToLower"  ],
+    "Uppercasing",                            ["$p,TestToUpper"            , "$p,TestUTF8ToUpper"  ],
+    "Case Folding",                           ["$p,TestFoldCase"           , "$p,TestUTF8FoldCase" ],
+};
+
+runTests($options, $tests, $dataFiles);
+
+$options = {
+    "title"=>"Unicode String case-insensitive hashing and comparison: fold first vs. fold on the fly",
+    "headers"=>"FoldFirst OnTheFly",
+    "operationIs"=>"code unit",
+    "eventIs"=>"string",
+    "passes"=>"5",
+    "time"=>"2",
+    #"outputType"=>"HTML",
+    "dataDir"=>$CollationDataPath,
+    "outputDir"=>"../results"
+};
+
+$tests = {
+    "Hash UTF-16",                            ["$p,TestFoldThenHash"       , "$p,TestFoldHash"          ],
+    "Hash UTF-8",                             ["$p,TestUTF8FoldThenHash"   , "$p,TestUTF8FoldHash"      ],
+    "Compare UTF-16",                         ["$p,TestFoldThenCompare"    , "$p,TestCaseCompare"       ],
+    "Compare UTF-8",                          ["$p,TestUTF8FoldThenCompare", "$p,TestUTF8CaseCompare"   ],
+};
+
+runTests($options, $tests, $dataFiles);
+
 # The whole command line would be something like:
 # 	stringperf.exe -p 5 -t 2 -f c:/src/data/perf/TestNames_Asian.txt -l -u TestStdLibCatenate
@@ -153,6 +153,22 @@ UPerfFunction* StringPerformanceTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(22, TestStdLibScan1);
         TESTCASE(23, TestStdLibScan2);
 
+        TESTCASE(24, TestToLower);
+        TESTCASE(25, TestToUpper);
+        TESTCASE(26, TestFoldCase);
+        TESTCASE(27, TestUTF8ToLower);
+        TESTCASE(28, TestUTF8ToUpper);
+        TESTCASE(29, TestUTF8FoldCase);
+
+        TESTCASE(30, TestFoldThenHash);
+        TESTCASE(31, TestFoldHash);
+        TESTCASE(32, TestUTF8FoldThenHash);
+        TESTCASE(33, TestUTF8FoldHash);
+        TESTCASE(34, TestFoldThenCompare);
+        TESTCASE(35, TestCaseCompare);
+        TESTCASE(36, TestUTF8FoldThenCompare);
+        TESTCASE(37, TestUTF8CaseCompare);
+
         default: 
             name = ""; 
             return NULL;
@@ -379,4 +395,90 @@ UPerfFunction* StringPerformanceTest::TestStdLibScan2()
     }
 }
 
+UPerfFunction* StringPerformanceTest::caseMapFunction(CaseMapFnType fnType, UBool utf8)
+{
+    if (line_mode) {
+        return new CaseMapPerfFunction(fnType, utf8, filelines_, numLines);
+    } else {
+        return new CaseMapPerfFunction(fnType, utf8, StrBuffer, StrBufferLen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestToLower()
+{
+    return caseMapFunction(Fn_LOWER, FALSE);
+}
 
+UPerfFunction* StringPerformanceTest::TestToUpper()
+{
+    return caseMapFunction(Fn_UPPER, FALSE);
+}
+
+UPerfFunction* StringPerformanceTest::TestFoldCase()
+{
+    return caseMapFunction(Fn_FOLD, FALSE);
+}
+
+UPerfFunction* StringPerformanceTest::TestUTF8ToLower()
+{
+    return caseMapFunction(Fn_LOWER, TRUE);
+}
+
+UPerfFunction* StringPerformanceTest::TestUTF8ToUpper()
+{
+    return caseMapFunction(Fn_UPPER, TRUE);
+}
+
+UPerfFunction* StringPerformanceTest::TestUTF8FoldCase()
+{
+    return caseMapFunction(Fn_FOLD, TRUE);
+}
+
+UPerfFunction* StringPerformanceTest::caselessFunction(CaselessFnType fnType, UBool utf8)
+{
+    if (line_mode) {
+        return new CaselessPerfFunction(fnType, utf8, filelines_, numLines);
+    } else {
+        return new CaselessPerfFunction(fnType, utf8, StrBuffer, StrBufferLen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestFoldThenHash()
+{
+    return caselessFunction(Fn_FOLD_THEN_HASH, FALSE);
+}
+
+UPerfFunction* StringPerformanceTest::TestFoldHash()
+{
+    return caselessFunction(Fn_FOLD_HASH, FALSE);
+}
+
+UPerfFunction* StringPerformanceTest::TestUTF8FoldThenHash()
+{
+    return caselessFunction(Fn_FOLD_THEN_HASH, TRUE);
+}
+
+UPerfFunction* StringPerformanceTest::TestUTF8FoldHash()
+{
+    return caselessFunction(Fn_FOLD_HASH, TRUE);
+}
+
+UPerfFunction* StringPerformanceTest::TestFoldThenCompare()
+{
+    return caselessFunction(Fn_FOLD_THEN_COMPARE, FALSE);
+}
+
+UPerfFunction* StringPerformanceTest::TestCaseCompare()
+{
+    return caselessFunction(Fn_CASE_COMPARE, FALSE);
+}
+
+UPerfFunction* StringPerformanceTest::TestUTF8FoldThenCompare()
+{
+    return caselessFunction(Fn_FOLD_THEN_COMPARE, TRUE);
+}
+
+UPerfFunction* StringPerformanceTest::TestUTF8CaseCompare()
+{
+    return caselessFunction(Fn_CASE_COMPARE, TRUE);
+}
@@ -12,7 +12,12 @@
 #define _STRINGPERF_H
 
 #include "cmemory.h"
+#include "ucasemap_imp.h"
+#include "ustr_imp.h"
 #include "unicode/utypes.h"
+#include "unicode/casemap.h"
+#include "unicode/edits.h"
+#include "unicode/locid.h"
 #include "unicode/unistr.h"
 
 #include "unicode/uperf.h"
@@ -20,6 +25,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string>
 
 typedef std::wstring stlstring;	
 
@@ -345,6 +351,269 @@ class StringPerfFunction : public UPerfFunction
 };
 
 
+enum CaseMapFnType { Fn_LOWER, Fn_UPPER, Fn_FOLD };
+
+/*
+ * Lowercases, uppercases or case-folds each line or the whole buffer
+ * with the CaseMap functions, recording Edits,
+ * in UTF-16 or on a UTF-8 copy of the text.
+ */
+class CaseMapPerfFunction : public UPerfFunction
+{
+public:
+    CaseMapPerfFunction(CaseMapFnType fnType, UBool utf8, ULine* srcLines, int32_t srcNumLines)
+            : fnType_(fnType), utf8_(utf8), numStrings_(srcNumLines), numChars_(0) {
+        init();
+        for(int32_t i=0; i<numStrings_; i++) {
+            setString(i, srcLines[i].name, srcLines[i].len);
+        }
+    }
+
+    CaseMapPerfFunction(CaseMapFnType fnType, UBool utf8, const UChar* source, int32_t sourceLen)
+            : fnType_(fnType), utf8_(utf8), numStrings_(1), numChars_(0) {
+        init();
+        setString(0, source, sourceLen);
+    }
+
+    ~CaseMapPerfFunction()
+    {
+        delete[] strings_;
+        delete[] strings8_;
+        delete[] dest_;
+        delete[] dest8_;
+    }
+
+    virtual void call(UErrorCode* status)
+    {
+        for(int32_t i=0; i<numStrings_ && U_SUCCESS(*status); i++) {
+            if(utf8_) {
+                const std::string &s=strings8_[i];
+                switch(fnType_) {
+                case Fn_LOWER:
+                    CaseMap::utf8ToLower("", 0, s.data(), (int32_t)s.length(),
+                                         dest8_, destCapacity_, &edits_, *status);
+                    break;
+                case Fn_UPPER:
+                    CaseMap::utf8ToUpper("", 0, s.data(), (int32_t)s.length(),
+                                         dest8_, destCapacity_, &edits_, *status);
+                    break;
+                default:
+                    CaseMap::utf8Fold(0, s.data(), (int32_t)s.length(),
+                                      dest8_, destCapacity_, &edits_, *status);
+                    break;
+                }
+            } else {
+                const UnicodeString &s=strings_[i];
+                switch(fnType_) {
+                case Fn_LOWER:
+                    CaseMap::toLower("", 0, s.getBuffer(), s.length(),
+                                     dest_, destCapacity_, &edits_, *status);
+                    break;
+                case Fn_UPPER:
+                    CaseMap::toUpper("", 0, s.getBuffer(), s.length(),
+                                     dest_, destCapacity_, &edits_, *status);
+                    break;
+                default:
+                    CaseMap::fold(0, s.getBuffer(), s.length(),
+                                  dest_, destCapacity_, &edits_, *status);
+                    break;
+                }
+            }
+        }
+    }
+
+    virtual long getOperationsPerIteration()
+    {
+        return numChars_;
+    }
+
+    virtual long getEventsPerIteration()
+    {
+        return numStrings_;
+    }
+
+private:
+    void init() {
+        strings_=new UnicodeString[numStrings_];
+        strings8_=new std::string[numStrings_];
+        destCapacity_=0;
+        dest_=NULL;
+        dest8_=NULL;
+    }
+
+    void setString(int32_t i, const UChar* s, int32_t length) {
+        strings_[i].setTo(s, length);
+        strings_[i].toUTF8String(strings8_[i]);
+        numChars_+=length;
+        // Case mapping can triple the length, and UTF-8 needs up to 3 bytes per UChar.
+        int32_t capacity=(int32_t)strings8_[i].length()*3+1;
+        if(capacity>destCapacity_) {
+            delete[] dest_;
+            delete[] dest8_;
+            destCapacity_=capacity;
+            dest_=new UChar[capacity];
+            dest8_=new char[capacity];
+        }
+    }
+
+    CaseMapFnType fnType_;
+    UBool utf8_;
+    int32_t numStrings_;
+    long numChars_;
+    UnicodeString* strings_;
+    std::string* strings8_;
+    UChar* dest_;
+    char* dest8_;
+    int32_t destCapacity_;
+    Edits edits_;
+};
+
+enum CaselessFnType { Fn_FOLD_THEN_HASH, Fn_FOLD_HASH, Fn_FOLD_THEN_COMPARE, Fn_CASE_COMPARE };
+
+/*
+ * Case-insensitive hashing and comparison of each line or the whole buffer,
+ * either by case-folding copies first or by folding on the fly,
+ * in UTF-16 or on a UTF-8 copy of the text.
+ * Each string is compared with its uppercase version, which compares equal,
+ * as when probing a hash table with case-insensitive keys.
+ */
+class CaselessPerfFunction : public UPerfFunction
+{
+public:
+    CaselessPerfFunction(CaselessFnType fnType, UBool utf8, ULine* srcLines, int32_t srcNumLines)
+            : fnType_(fnType), utf8_(utf8), numStrings_(srcNumLines), numChars_(0), sum_(0) {
+        init();
+        for(int32_t i=0; i<numStrings_; i++) {
+            setString(i, srcLines[i].name, srcLines[i].len);
+        }
+    }
+
+    CaselessPerfFunction(CaselessFnType fnType, UBool utf8, const UChar* source, int32_t sourceLen)
+            : fnType_(fnType), utf8_(utf8), numStrings_(1), numChars_(0), sum_(0) {
+        init();
+        setString(0, source, sourceLen);
+    }
+
+    ~CaselessPerfFunction()
+    {
+        delete[] strings_;
+        delete[] strings8_;
+        delete[] upper_;
+        delete[] upper8_;
+        delete[] folded8_;
+        delete[] otherFolded8_;
+    }
+
+    virtual void call(UErrorCode* status)
+    {
+        for(int32_t i=0; i<numStrings_ && U_SUCCESS(*status); i++) {
+            if(utf8_) {
+                const std::string &s=strings8_[i];
+                const std::string &t=upper8_[i];
+                switch(fnType_) {
+                case Fn_FOLD_THEN_HASH:
+                    sum_+=ustr_hashCharsN(folded8_, fold8(s, folded8_, *status));
+                    break;
+                case Fn_FOLD_HASH:
+                    sum_+=ustr_hashFoldUTF8N(s.data(), (int32_t)s.length(), U_FOLD_CASE_DEFAULT);
+                    break;
+                case Fn_FOLD_THEN_COMPARE: {
+                    int32_t length=fold8(s, folded8_, *status);
+                    sum_+=length==fold8(t, otherFolded8_, *status) &&
+                        uprv_memcmp(folded8_, otherFolded8_, length)==0;
+                    break;
+                }
+                default:
+                    sum_+=u_strcmpFoldUTF8(s.data(), (int32_t)s.length(),
+                                           t.data(), (int32_t)t.length(),
+                                           U_FOLD_CASE_DEFAULT, status);
+                    break;
+                }
+            } else {
+                const UnicodeString &s=strings_[i];
+                const UnicodeString &t=upper_[i];
+                switch(fnType_) {
+                case Fn_FOLD_THEN_HASH: {
+                    UnicodeString folded(s);
+                    sum_+=folded.foldCase().hashCode();
+                    break;
+                }
+                case Fn_FOLD_HASH:
+                    sum_+=ustr_hashFoldUCharsN(s.getBuffer(), s.length(), U_FOLD_CASE_DEFAULT);
+                    break;
+                case Fn_FOLD_THEN_COMPARE: {
+                    UnicodeString folded(s), otherFolded(t);
+                    sum_+=folded.foldCase()==otherFolded.foldCase();
+                    break;
+                }
+                default:
+                    sum_+=u_strCaseCompare(s.getBuffer(), s.length(), t.getBuffer(), t.length(),
+                                           U_FOLD_CASE_DEFAULT, status);
+                    break;
+                }
+            }
+        }
+    }
+
+    virtual long getOperationsPerIteration()
+    {
+        return numChars_;
+    }
+
+    virtual long getEventsPerIteration()
+    {
+        return numStrings_;
+    }
+
+private:
+    void init() {
+        strings_=new UnicodeString[numStrings_];
+        strings8_=new std::string[numStrings_];
+        upper_=new UnicodeString[numStrings_];
+        upper8_=new std::string[numStrings_];
+        foldedCapacity_=0;
+        folded8_=NULL;
+        otherFolded8_=NULL;
+    }
+
+    void setString(int32_t i, const UChar* s, int32_t length) {
+        strings_[i].setTo(s, length);
+        strings_[i].toUTF8String(strings8_[i]);
+        upper_[i]=strings_[i];
+        upper_[i].toUpper(Locale::getRoot());
+        upper_[i].toUTF8String(upper8_[i]);
+        numChars_+=length;
+        // Case folding can triple the length.
+        int32_t capacity=(int32_t)upper8_[i].length()*3+1;
+        if(capacity>foldedCapacity_) {
+            delete[] folded8_;
+            delete[] otherFolded8_;
+            foldedCapacity_=capacity;
+            folded8_=new char[capacity];
+            otherFolded8_=new char[capacity];
+        }
+    }
+
+    // Folds into a preallocated buffer, as a careful caller would.
+    int32_t fold8(const std::string &s, char *folded, UErrorCode &errorCode) {
+        return CaseMap::utf8Fold(0, s.data(), (int32_t)s.length(),
+                                 folded, foldedCapacity_, NULL, errorCode);
+    }
+
+    CaselessFnType fnType_;
+    UBool utf8_;
+    int32_t numStrings_;
+    long numChars_;
+    UnicodeString* strings_;
+    std::string* strings8_;
+    UnicodeString* upper_;
+    std::string* upper8_;
+    char* folded8_;
+    char* otherFolded8_;
+    int32_t foldedCapacity_;
+    int32_t sum_;
+};
+
 class StringPerformanceTest : public UPerfTest
 {
 public:
@@ -379,7 +648,25 @@ class StringPerformanceTest : public UPerfTest
     UPerfFunction* TestStdLibScan1();
     UPerfFunction* TestStdLibScan2();
 
+    UPerfFunction* TestToLower();
+    UPerfFunction* TestToUpper();
+    UPerfFunction* TestFoldCase();
+    UPerfFunction* TestUTF8ToLower();
+    UPerfFunction* TestUTF8ToUpper();
+    UPerfFunction* TestUTF8FoldCase();
+    UPerfFunction* TestFoldThenHash();
+    UPerfFunction* TestFoldHash();
+    UPerfFunction* TestUTF8FoldThenHash();
+    UPerfFunction* TestUTF8FoldHash();
+    UPerfFunction* TestFoldThenCompare();
+    UPerfFunction* TestCaseCompare();
+    UPerfFunction* TestUTF8FoldThenCompare();
+    UPerfFunction* TestUTF8CaseCompare();
+
 private:
+    UPerfFunction* caseMapFunction(CaseMapFnType fnType, UBool utf8);
+    UPerfFunction* caselessFunction(CaselessFnType fnType, UBool utf8);
+
     long COUNT_;
     ULine* filelines_;
     UChar* StrBuffer;
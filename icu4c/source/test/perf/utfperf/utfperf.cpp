@@ -328,11 +328,53 @@ class FromUTF8 : public Command {
     int32_t input8Length;
 };
 
+// Test u_strFromUTF8WithSub() UTF-8->UTF-16, without a converter.
+class StrFromUTF8 : public UPerfFunction {
+public:
+    StrFromUTF8(const UtfPerformanceTest &testcase) : testcase(testcase) {}
+    virtual void call(UErrorCode* pErrorCode){
+        u_strFromUTF8WithSub(output, OUTPUT_CAPACITY, &outputLength,
+                             utf8, utf8Length, 0xfffd, NULL, pErrorCode);
+        if(U_SUCCESS(*pErrorCode) && outputLength!=testcase.getBufferLen()) {
+            fprintf(stderr, "error: u_strFromUTF8WithSub() outputLength %d!=inputLength %d\n",
+                    (int)outputLength, (int)testcase.getBufferLen());
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+        }
+    }
+    virtual long getOperationsPerIteration(){
+        return countInputCodePoints;
+    }
+private:
+    const UtfPerformanceTest &testcase;
+};
+
+// Test u_strToUTF8WithSub() UTF-16->UTF-8, without a converter.
+class StrToUTF8 : public UPerfFunction {
+public:
+    StrToUTF8(const UtfPerformanceTest &testcase) : testcase(testcase) {}
+    virtual void call(UErrorCode* pErrorCode){
+        u_strToUTF8WithSub(intermediate, OUTPUT_CAPACITY, &encodedLength,
+                           testcase.getBuffer(), testcase.getBufferLen(), 0xfffd, NULL, pErrorCode);
+        if(U_SUCCESS(*pErrorCode) && encodedLength!=utf8Length) {
+            fprintf(stderr, "error: u_strToUTF8WithSub() encodedLength %d!=utf8Length %d\n",
+                    (int)encodedLength, (int)utf8Length);
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+        }
+    }
+    virtual long getOperationsPerIteration(){
+        return countInputCodePoints;
+    }
+private:
+    const UtfPerformanceTest &testcase;
+};
+
 UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "StrFromUTF8";   if (exec) return new StrFromUTF8(*this); break;
+        case 4: name = "StrToUTF8";     if (exec) return new StrToUTF8(*this); break;
         default: name = ""; break;
     }
     return NULL;
@@ -67,11 +67,40 @@ static RBBIStateTable get(ByteBuffer bytes, int length) throws IOException {
             This.fRowLen    = bytes.getInt();
             This.fFlags     = bytes.getInt();
             This.fReserved  = bytes.getInt();
+            if ((This.fFlags & RBBI_8BITS_ROWS) != 0) {
+                This.widen8BitRows(bytes, length - 16);
+                return This;
+            }
             int lengthOfShorts = length - 16;   // length in bytes.
             This.fTable     = ICUBinary.getShorts(bytes, lengthOfShorts / 2, lengthOfShorts & 1);
             return This;
         }
 
+        /**
+         * Reads a table with 8-bit rows (format version 6) into the same short[] form
+         * as a table with 16-bit rows, including the padding to a multiple of 8 bytes,
+         * so that it equals the table built from the same rules.
+         * The row header fields are signed, the next-state values unsigned.
+         */
+        private void widen8BitRows(ByteBuffer bytes, int lengthOfBytes) throws IOException {
+            int rowBytes = fNumStates * fRowLen;
+            if (rowBytes > lengthOfBytes) {
+                throw new IOException("Invalid RBBI state table length.");
+            }
+            int tableLength = (((16 + 2 * rowBytes) + 7) & ~7) - 16;    // in bytes
+            fTable = new short[tableLength / 2];
+            int i = 0;
+            for (int state = 0; state < fNumStates; state++) {
+                for (int column = 0; column < fRowLen; column++) {
+                    byte b = bytes.get();
+                    fTable[i++] = column < NEXTSTATES ? (short)b : (short)(b & 0xff);
+                }
+            }
+            ICUBinary.skipBytes(bytes, lengthOfBytes - rowBytes);
+            fRowLen *= 2;
+            fFlags &= ~RBBI_8BITS_ROWS;
+        }
+
         public int put(DataOutputStream bytes) throws IOException {
             bytes.writeInt(fNumStates);
             bytes.writeInt(fRowLen);
@@ -139,13 +168,16 @@ static public boolean equals(RBBIStateTable left, RBBIStateTable right) {
     public int     fStatusTable[];
 
     public static final int DATA_FORMAT = 0x42726b20;     // "Brk "
-    public static final int FORMAT_VERSION = 0x05000000;  // 4.0.0.0
+    public static final int FORMAT_VERSION = 0x06000000;  // 6.0.0.0
+    // Version 6 adds state tables with 8-bit rows (RBBI_8BITS_ROWS).
+    // Otherwise it is the same as version 5, which is still accepted.
+    private static final int FORMAT_VERSION_16BIT_ROWS_ONLY = 0x05000000;
 
     private static final class IsAcceptable implements Authenticate {
         @Override
         public boolean isDataVersionAcceptable(byte version[]) {
             int intVersion = (version[0] << 24) + (version[1] << 16) + (version[2] << 8) + version[3];
-            return intVersion == FORMAT_VERSION;
+            return intVersion == FORMAT_VERSION || intVersion == FORMAT_VERSION_16BIT_ROWS_ONLY;
         }
     }
     private static final IsAcceptable IS_ACCEPTABLE = new IsAcceptable();
@@ -200,6 +232,8 @@ public boolean isDataVersionAcceptable(byte version[]) {
     //
     public final static int      RBBI_LOOKAHEAD_HARD_BREAK = 1;
     public final static int      RBBI_BOF_REQUIRED         = 2;
+    /** The stored table has rows of 8-bit values. Only in data read from ICU4C, converted when loaded. */
+    public final static int      RBBI_8BITS_ROWS           = 4;
 
     /**
      * Data Header.  A struct-like class with the fields from the RBBI data file header.